@@ -0,0 +1,99 @@
+// Measures throughput of parsing a detailed commit log (as read by CommitsLogManager::getCommitsLogDetailed)
+// with the runtime pretty format parser and with the format known at compile time.
+//
+// Usage: CppGit_commit_log_parser_benchmark [commits] [iterations]
+
+#include <CppGit/Commit.hpp>
+#include <CppGit/_details/Parser/CommitLogFormat.hpp>
+#include <CppGit/_details/Parser/CommitParser.hpp>
+#include <CppGit/_details/StreamRecordsSplitter.hpp>
+#include <chrono>
+#include <cstddef>
+#include <cstdlib>
+#include <functional>
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace {
+
+constexpr auto RECORD_END = std::string_view{ "$:>\n" };
+constexpr auto CHUNK_SIZE = std::size_t{ 64 * 1024 };
+
+// The runtime format has message and description (%s and %b), the detailed log format has tree hash and raw message (%T and %B)
+auto createLog(const int commits, const std::string_view separator, const bool detailedFormat) -> std::string
+{
+    auto log = std::string{};
+    for (auto i = 0; i < commits; ++i)
+    {
+        const auto hash = std::string(40, static_cast<char>('a' + i % 6));
+        const auto parent = std::string(40, static_cast<char>('a' + (i + 1) % 6));
+        const auto fields = std::vector<std::string>{ hash, parent, "Author Name", "author@email.com", "1722791195 +0200", "Committer Name", "committer@email.com", "1722791195 +0200" };
+        for (const auto& field : fields)
+        {
+            log += field;
+            log += separator;
+        }
+        if (detailedFormat)
+        {
+            log += hash;
+            log += separator;
+        }
+        log += "Commit message " + std::to_string(i);
+        log += detailedFormat ? std::string_view{ "\n\n" } : separator;
+        log += "Description of commit " + std::to_string(i) + "\n";
+        log += RECORD_END;
+    }
+
+    return log;
+}
+
+auto measure(const std::string_view name, const std::string_view log, const int commits, const int iterations, const std::function<CppGit::Commit(std::string_view)>& parse) -> void
+{
+    auto parsedCommits = std::size_t{ 0 };
+
+    const auto start = std::chrono::steady_clock::now();
+    for (auto i = 0; i < iterations; ++i)
+    {
+        auto commitsLog = std::vector<CppGit::Commit>{};
+        commitsLog.reserve(static_cast<std::size_t>(commits));
+        auto recordsSplitter = CppGit::_details::StreamRecordsSplitter{ std::string{ RECORD_END }, 0, [&commitsLog, &parse](const std::string_view commitLog) {
+                                                                           if (!commitLog.empty())
+                                                                           {
+                                                                               commitsLog.push_back(parse(commitLog));
+                                                                           }
+                                                                       } };
+        for (auto offset = std::size_t{ 0 }; offset < log.size(); offset += CHUNK_SIZE)
+        {
+            recordsSplitter.feed(log.substr(offset, CHUNK_SIZE));
+        }
+        recordsSplitter.finish();
+        parsedCommits += commitsLog.size();
+    }
+    const auto seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count() / iterations;
+
+    std::cout << name << " | " << parsedCommits / static_cast<std::size_t>(iterations) << " | " << seconds * 1000.0 << " | " << static_cast<double>(commits) / seconds << "\n";
+}
+
+} // namespace
+
+auto main(int argc, char* argv[]) -> int
+{
+    const auto commits = argc > 1 ? std::atoi(argv[1]) : 1'000'000;
+    const auto iterations = argc > 2 ? std::atoi(argv[2]) : 3;
+
+    const auto runtimeFormatLog = createLog(commits, CppGit::CommitParser::COMMIT_LOG_DEFAULT_DELIMITER, false);
+    const auto compileTimeFormatLog = createLog(commits, std::string_view{ &CppGit::DetailedCommitLogFormat::FIELD_SEPARATOR, 1 }, true);
+
+    std::cout << "parser | commits | time [ms] | throughput [commits/s]\n";
+
+    measure("parseCommit_PrettyFormat", runtimeFormatLog, commits, iterations, [](const std::string_view commitLog) {
+        return CppGit::CommitParser::parseCommit_PrettyFormat(commitLog);
+    });
+    measure("CommitLogFormat::parse", compileTimeFormatLog, commits, iterations, [](const std::string_view commitLog) {
+        return CppGit::DetailedCommitLogFormat::parse(commitLog);
+    });
+
+    return 0;
+}
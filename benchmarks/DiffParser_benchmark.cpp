@@ -0,0 +1,111 @@
+// Measures throughput of DiffParser on a synthetic diff with many files of every kind
+// (modified, added, deleted, renamed, mode changed and binary).
+//
+// Usage: CppGit_diff_parser_benchmark [files] [iterations]
+
+#include <CppGit/DiffFile.hpp>
+#include <CppGit/_details/Parser/DiffParser.hpp>
+#include <chrono>
+#include <cstddef>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace {
+
+constexpr auto CHUNK_SIZE = std::size_t{ 64 * 1024 };
+
+auto createFileDiff(std::string& diff, const int index) -> void
+{
+    const auto file = "dir/file" + std::to_string(index) + ".txt";
+    const auto hash = std::string(40, static_cast<char>('a' + index % 6));
+
+    diff += "diff --git a/" + file + " b/" + file + "\n";
+
+    switch (index % 6)
+    {
+    case 0:
+        diff += "new file mode 100644\n";
+        diff += "index 0000000000000000000000000000000000000000.." + hash + "\n";
+        diff += "--- /dev/null\n+++ b/" + file + "\n";
+        diff += "@@ -0,0 +1,3 @@\n+Line 1\n+Line 2\n+Line 3\n";
+        break;
+    case 1:
+        diff += "deleted file mode 100644\n";
+        diff += "index " + hash + "..0000000000000000000000000000000000000000\n";
+        diff += "--- a/" + file + "\n+++ /dev/null\n";
+        diff += "@@ -1,2 +0,0 @@\n-Line 1\n-Line 2\n";
+        break;
+    case 2:
+        diff += "similarity index 87%\n";
+        diff += "rename from " + file + "\n";
+        diff += "rename to " + file + ".renamed\n";
+        diff += "index " + hash + ".." + hash + " 100644\n";
+        diff += "--- a/" + file + "\n+++ b/" + file + ".renamed\n";
+        diff += "@@ -1,3 +1,3 @@\n Line 1\n-Line 2\n+Line 2 changed\n Line 3\n";
+        break;
+    case 3:
+        diff += "old mode 100644\nnew mode 100755\n";
+        break;
+    case 4:
+        diff += "index " + hash + ".." + hash + "\n";
+        diff += "Binary files differ\n";
+        break;
+    default:
+        diff += "index " + hash + ".." + hash + " 100644\n";
+        diff += "--- a/" + file + "\n+++ b/" + file + "\n";
+        diff += "@@ -1,7 +1,7 @@\n Line 1\n Line 2\n Line 3\n-Line 4\n+Line 4 changed\n Line 5\n Line 6\n Line 7\n";
+        diff += "@@ -20,6 +20,7 @@ int main()\n Line 20\n Line 21\n Line 22\n+Line 22a\n Line 23\n Line 24\n Line 25\n";
+        break;
+    }
+}
+
+auto measure(const std::string_view name, const std::string_view diff, const int iterations, const bool chunked) -> void
+{
+    auto parsedFiles = std::size_t{ 0 };
+
+    const auto start = std::chrono::steady_clock::now();
+    for (auto i = 0; i < iterations; ++i)
+    {
+        auto diffParser = CppGit::DiffParser{ [&parsedFiles](CppGit::DiffFile&&) { ++parsedFiles; } };
+        if (chunked)
+        {
+            for (auto offset = std::size_t{ 0 }; offset < diff.size(); offset += CHUNK_SIZE)
+            {
+                diffParser.feed(diff.substr(offset, CHUNK_SIZE));
+            }
+        }
+        else
+        {
+            diffParser.feed(diff);
+        }
+        diffParser.finish();
+    }
+    const auto seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count() / iterations;
+
+    const auto megabytes = static_cast<double>(diff.size()) / (1024.0 * 1024.0);
+    std::cout << name << " | " << parsedFiles / static_cast<std::size_t>(iterations) << " | " << megabytes << " | " << seconds * 1000.0 << " | " << megabytes / seconds << "\n";
+}
+
+} // namespace
+
+auto main(int argc, char* argv[]) -> int
+{
+    const auto files = argc > 1 ? std::atoi(argv[1]) : 100'000;
+    const auto iterations = argc > 2 ? std::atoi(argv[2]) : 3;
+
+    auto diff = std::string{};
+    for (auto i = 0; i < files; ++i)
+    {
+        createFileDiff(diff, i);
+    }
+
+    std::cout << "input | files | size [MB] | time [ms] | throughput [MB/s]\n";
+
+    measure("whole", diff, iterations, false);
+    measure("64 KiB chunks", diff, iterations, true);
+
+    return 0;
+}
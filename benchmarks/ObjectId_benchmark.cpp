@@ -0,0 +1,90 @@
+// Measures throughput of ObjectId hex parsing, formatting, validation, comparison with hex strings and hashing.
+// Ids are taken in turns from a pool of random SHA-1 hashes, so the input doesn't have to fit all of them.
+//
+// Usage: CppGit_object_id_benchmark [ids] [iterations]
+
+#include <CppGit/ObjectId.hpp>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <functional>
+#include <iostream>
+#include <random>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace {
+
+constexpr auto POOL_SIZE = std::size_t{ 1 << 20 };
+constexpr auto HEX_SIZE = CppGit::ObjectId::SHA1_SIZE * 2;
+
+auto createHexPool() -> std::string
+{
+    constexpr auto HEX_DIGITS = std::string_view{ "0123456789abcdef" };
+
+    auto randomEngine = std::mt19937_64{ 42 };
+    auto hexPool = std::string(POOL_SIZE * HEX_SIZE, '\0');
+    for (auto& character : hexPool)
+    {
+        character = HEX_DIGITS[randomEngine() % HEX_DIGITS.size()];
+    }
+
+    return hexPool;
+}
+
+auto measure(const std::string_view name, const std::size_t ids, const int iterations, const std::function<std::size_t(std::size_t)>& operation) -> void
+{
+    auto checksum = std::size_t{ 0 };
+
+    const auto start = std::chrono::steady_clock::now();
+    for (auto i = 0; i < iterations; ++i)
+    {
+        for (auto id = std::size_t{ 0 }; id < ids; ++id)
+        {
+            checksum += operation(id % POOL_SIZE);
+        }
+    }
+    const auto seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count() / iterations;
+
+    std::cout << name << " | " << ids << " | " << seconds * 1000.0 << " | " << static_cast<double>(ids) / seconds / 1'000'000.0 << " | " << checksum % 10 << "\n";
+}
+
+} // namespace
+
+auto main(int argc, char* argv[]) -> int
+{
+    const auto ids = argc > 1 ? static_cast<std::size_t>(std::atoll(argv[1])) : std::size_t{ 10'000'000 };
+    const auto iterations = argc > 2 ? std::atoi(argv[2]) : 3;
+
+    const auto hexPool = createHexPool();
+    const auto getHex = [&hexPool](const std::size_t index) { return std::string_view{ hexPool }.substr(index * HEX_SIZE, HEX_SIZE); };
+
+    auto objectIds = std::vector<CppGit::ObjectId>{};
+    objectIds.reserve(POOL_SIZE);
+    for (auto index = std::size_t{ 0 }; index < POOL_SIZE; ++index)
+    {
+        objectIds.push_back(CppGit::ObjectId::fromHex(getHex(index)));
+    }
+
+    std::cout << "operation | ids | time [ms] | throughput [M ids/s] | checksum\n";
+
+    measure("fromHex", ids, iterations, [&](const std::size_t index) {
+        return CppGit::ObjectId::fromHex(getHex(index)).getBytes()[0];
+    });
+    measure("toHex", ids, iterations, [&](const std::size_t index) {
+        return static_cast<std::size_t>(objectIds[index].toHex()[0]);
+    });
+    measure("isHex", ids, iterations, [&](const std::size_t index) {
+        return static_cast<std::size_t>(CppGit::ObjectId::isHex(getHex(index)));
+    });
+    measure("== hex", ids, iterations, [&](const std::size_t index) {
+        return static_cast<std::size_t>(objectIds[index] == getHex((index + 1) % POOL_SIZE) || objectIds[index] == getHex(index));
+    });
+    measure("std::hash", ids, iterations, [&](const std::size_t index) {
+        return std::hash<CppGit::ObjectId>{}(objectIds[index]);
+    });
+
+    return 0;
+}
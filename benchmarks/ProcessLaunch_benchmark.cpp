@@ -0,0 +1,60 @@
+// Compares cost of a single git call started with fork and with posix_spawn
+// for several sizes of the calling process.
+//
+// Usage: CppGit_process_launch_benchmark [iterations]
+
+#include <CppGit/_details/GitCommandExecutor/GitCommandExecutorUnix.hpp>
+#include <chrono>
+#include <cstddef>
+#include <cstdlib>
+#include <filesystem>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace {
+
+auto measure(const CppGit::GitCommandExecutorUnix::LaunchMethod launchMethod, const int iterations) -> double
+{
+    auto executor = CppGit::GitCommandExecutorUnix{ launchMethod };
+    const auto repoPath = std::filesystem::current_path().string();
+
+    const auto start = std::chrono::steady_clock::now();
+    for (auto i = 0; i < iterations; ++i)
+    {
+        executor.execute(std::vector<std::string>{}, repoPath, "--version");
+    }
+    const auto elapsed = std::chrono::steady_clock::now() - start;
+
+    return std::chrono::duration<double, std::micro>(elapsed).count() / iterations;
+}
+
+} // namespace
+
+auto main(int argc, char* argv[]) -> int
+{
+    const auto iterations = argc > 1 ? std::atoi(argv[1]) : 200;
+    constexpr auto MEGABYTE = std::size_t{ 1024 * 1024 };
+    constexpr auto PAGE_SIZE = std::size_t{ 4096 };
+
+    std::cout << "parent RSS [MiB] | fork [us/call] | posix_spawn [us/call]\n";
+
+    for (const auto sizeMb : { 0, 256, 1024, 2048 })
+    {
+        // Touch every page, so the memory is really resident and its page tables exist
+        const auto size = static_cast<std::size_t>(sizeMb) * MEGABYTE;
+        auto ballast = std::make_unique<char[]>(size); // NOLINT(cppcoreguidelines-avoid-c-arrays, modernize-avoid-c-arrays)
+        for (auto offset = std::size_t{ 0 }; offset < size; offset += PAGE_SIZE)
+        {
+            ballast[offset] = 1;
+        }
+
+        const auto forkTime = measure(CppGit::GitCommandExecutorUnix::LaunchMethod::Fork, iterations);
+        const auto spawnTime = measure(CppGit::GitCommandExecutorUnix::LaunchMethod::PosixSpawn, iterations);
+
+        std::cout << sizeMb << " | " << forkTime << " | " << spawnTime << "\n";
+    }
+
+    return 0;
+}
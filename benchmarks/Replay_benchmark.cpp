@@ -0,0 +1,102 @@
+// Measures parsing and orchestration cost of CppGit operations without process noise.
+// Commands are recorded once on a generated repository and then replayed from memory.
+// Operations that read repository files directly instead of running git (e.g. index listing) aren't measured here.
+//
+// Usage: CppGit_replay_benchmark [files] [commits] [iterations]
+
+#include <CppGit/BranchesManager.hpp>
+#include <CppGit/CommitsManager.hpp>
+#include <CppGit/IndexManager.hpp>
+#include <CppGit/Merger.hpp>
+#include <CppGit/Rebaser.hpp>
+#include <CppGit/Repository.hpp>
+#include <CppGit/_details/FileUtility.hpp>
+#include <CppGit/_details/GitCommandExecutor/GitCommandExecutorRecording.hpp>
+#include <CppGit/_details/GitCommandExecutor/GitCommandExecutorReplay.hpp>
+#include <CppGit/_details/GitCommandExecutor/GitCommandExecutorUnix.hpp>
+#include <chrono>
+#include <cstdlib>
+#include <filesystem>
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <string_view>
+
+namespace {
+
+auto prepareRepository(const std::filesystem::path& repositoryPath, const int files, const int commits) -> void
+{
+    const auto repository = CppGit::Repository{ repositoryPath };
+    repository.initRepository();
+    const auto indexManager = repository.IndexManager();
+    const auto commitsManager = repository.CommitsManager();
+
+    for (auto i = 0; i < files; ++i)
+    {
+        CppGit::_details::FileUtility::createOrOverwriteFile(repositoryPath / ("file" + std::to_string(i) + ".txt"), "content");
+    }
+    indexManager.add(".");
+    commitsManager.createCommit("Initial commit");
+
+    repository.BranchesManager().createBranch("feature");
+
+    for (auto i = 0; i < commits; ++i)
+    {
+        CppGit::_details::FileUtility::createOrOverwriteFile(repositoryPath / "file0.txt", "content " + std::to_string(i));
+        indexManager.add("file0.txt");
+        commitsManager.createCommit("Commit " + std::to_string(i), "Description of commit " + std::to_string(i));
+    }
+}
+
+auto measure(const std::filesystem::path& repositoryPath, const std::string_view name, const int iterations, const std::function<void(const CppGit::Repository&)>& operation) -> void
+{
+    auto recordingExecutor = std::make_shared<CppGit::GitCommandExecutorRecording>(std::make_shared<CppGit::GitCommandExecutorUnix>());
+
+    const auto recordingStart = std::chrono::steady_clock::now();
+    operation(CppGit::Repository{ repositoryPath, recordingExecutor });
+    const auto recordingTime = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - recordingStart).count();
+
+    const auto records = recordingExecutor->getRecords();
+    auto replayExecutor = std::make_shared<CppGit::GitCommandExecutorReplay>(records);
+
+    // Fresh repository for every iteration, so `cat-file --batch` session is started again and replayed from the beginning
+    const auto replayStart = std::chrono::steady_clock::now();
+    for (auto i = 0; i < iterations; ++i)
+    {
+        replayExecutor->rewind();
+        operation(CppGit::Repository{ repositoryPath, replayExecutor });
+    }
+    const auto replayTime = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - replayStart).count() / iterations;
+
+    std::cout << name << " | " << records.size() << " | " << recordingTime << " | " << replayTime << "\n";
+}
+
+} // namespace
+
+auto main(int argc, char* argv[]) -> int
+{
+    const auto files = argc > 1 ? std::atoi(argv[1]) : 10'000;
+    const auto commits = argc > 2 ? std::atoi(argv[2]) : 1'000;
+    const auto iterations = argc > 3 ? std::atoi(argv[3]) : 20;
+
+    const auto repositoryPath = std::filesystem::temp_directory_path() / "CppGit_replay_benchmark";
+    std::filesystem::remove_all(repositoryPath);
+    prepareRepository(repositoryPath, files, commits);
+
+    std::cout << "operation | commands | with git [us] | replayed [us]\n";
+
+    measure(repositoryPath, "IndexManager::isDirty", iterations, [](const CppGit::Repository& repository) {
+        static_cast<void>(repository.IndexManager().isDirty());
+    });
+    measure(repositoryPath, "Merger::canFastForward", iterations, [](const CppGit::Repository& repository) {
+        static_cast<void>(repository.Merger().canFastForward("feature"));
+    });
+    measure(repositoryPath, "Rebaser::getDefaultTodoCommands", iterations, [](const CppGit::Repository& repository) {
+        static_cast<void>(repository.Rebaser().getDefaultTodoCommands("feature"));
+    });
+
+    std::filesystem::remove_all(repositoryPath);
+
+    return 0;
+}
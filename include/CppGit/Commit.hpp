@@ -1,18 +1,27 @@
 #pragma once
 
+#include "ObjectId.hpp"
 #include "Signature.hpp"
+#include "Timestamp.hpp"
 
+#include <optional>
 #include <string>
 #include <vector>
 
 namespace CppGit {
 
 class CommitsManager;
+class CommitParser;
 
 /// @brief Represents a single commit
+///     Hashes are stored as ObjectId, dates are parsed once and signatures are shared between commits,
+///     so a commit takes little memory even in long histories.
+///     String getters of hashes and dates build the strings on every call.
+///     String constructors throw std::runtime_error for hashes which aren't hex and dates which aren't in git raw format.
 class Commit
 {
     friend CommitsManager;
+    friend CommitParser;
 
 public:
     Commit(std::string hash,
@@ -36,27 +45,43 @@ public:
            std::string description,
            std::string treeHash);
 
-    [[nodiscard]] auto getHash() const -> const std::string&;
-    [[nodiscard]] auto getParents() const -> const std::vector<std::string>&;
+    [[nodiscard]] auto getHash() const -> std::string;
+    [[nodiscard]] auto getParents() const -> std::vector<std::string>;
     [[nodiscard]] auto getAuthor() const -> const Signature&;
-    [[nodiscard]] auto getAuthorDate() const -> const std::string&;
+    [[nodiscard]] auto getAuthorDate() const -> std::string;
     [[nodiscard]] auto getCommitter() const -> const Signature&;
-    [[nodiscard]] auto getCommitterDate() const -> const std::string&;
+    [[nodiscard]] auto getCommitterDate() const -> std::string;
     [[nodiscard]] auto getMessage() const -> const std::string&;
     [[nodiscard]] auto getDescription() const -> const std::string&;
     [[nodiscard]] auto getMessageAndDescription() const -> std::string;
-    [[nodiscard]] auto getTreeHash() const -> const std::string&;
+    [[nodiscard]] auto getTreeHash() const -> std::string;
+
+    [[nodiscard]] auto getId() const -> const ObjectId&;
+    [[nodiscard]] auto getParentIds() const -> const std::vector<ObjectId>&;
+    [[nodiscard]] auto getTreeId() const -> const ObjectId&;
+    [[nodiscard]] auto getAuthorTimestamp() const -> const std::optional<Timestamp>&;
+    [[nodiscard]] auto getCommitterTimestamp() const -> const std::optional<Timestamp>&;
 
 private:
-    std::string hash;
-    std::string authorDate;
-    std::string committerDate;
+    Commit(const ObjectId& hash,
+           std::vector<ObjectId> parents,
+           const Signature& author,
+           const std::optional<Timestamp>& authorDate,
+           const Signature& committer,
+           const std::optional<Timestamp>& committerDate,
+           std::string message,
+           std::string description,
+           const ObjectId& treeHash);
+
+    ObjectId hash;
+    ObjectId treeHash;
+    std::optional<Timestamp> authorDate;
+    std::optional<Timestamp> committerDate;
+    const Signature* author;
+    const Signature* committer;
+    std::vector<ObjectId> parents;
     std::string message;
     std::string description;
-    std::string treeHash;
-    Signature author;
-    Signature committer;
-    std::vector<std::string> parents;
 };
 
 } // namespace CppGit
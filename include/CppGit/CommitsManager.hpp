@@ -38,6 +38,7 @@ public:
     [[nodiscard]] auto getHeadCommitHash() const -> std::string;
 
     /// @brief Get the commit object for the given commit hash with detailed informations
+    ///     Commits are cached by the repository, so full hashes of already read commits are resolved without git
     /// @param commitHash Hash of the commit
     /// @return Commit object
     [[nodiscard]] auto getCommitInfo(const std::string_view commitHash) const -> Commit;
@@ -10,8 +10,10 @@
 #include "DiffGenerator.hpp"
 #include "IndexManager.hpp"
 #include "Merger.hpp"
+#include "ObjectId.hpp"
 #include "RebaseTodoCommand.hpp"
 #include "Rebaser.hpp"
 #include "Repository.hpp"
 #include "Resetter.hpp"
 #include "Signature.hpp"
+#include "Timestamp.hpp"
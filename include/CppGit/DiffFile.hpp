@@ -23,6 +23,15 @@ enum class DiffStatus : uint8_t
     BINARY_CHANGED        ///< Binary file changed
 };
 
+/// @brief Enum class to represent the algorithm used to compute line differences
+enum class DiffAlgorithm : uint8_t
+{
+    MYERS,    ///< Myers' algorithm with heuristics for expensive inputs (git's default)
+    MINIMAL,  ///< Myers' algorithm without heuristics, always finds the smallest diff
+    PATIENCE, ///< Lines unique in both files are matched first, the rest is diffed between them
+    HISTOGRAM ///< Extension of patience diff matching lines that occur the least often first
+};
+
 /// @brief A file in a diff
 struct DiffFile
 {
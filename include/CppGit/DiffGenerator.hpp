@@ -2,9 +2,9 @@
 
 #include "DiffFile.hpp"
 #include "Repository.hpp"
-#include "_details/GitCommandExecutor/GitCommandOutput.hpp"
 
 #include <filesystem>
+#include <functional>
 #include <string_view>
 #include <vector>
 
@@ -14,6 +14,8 @@ namespace CppGit {
 class DiffGenerator
 {
 public:
+    using DiffFileConsumer = std::function<void(DiffFile&&)>;
+
     /// @param repo The repository to work with
     explicit DiffGenerator(const Repository& repository);
 
@@ -33,6 +35,13 @@ public:
     /// @return A vector of DiffFile
     [[nodiscard]] auto getDiff(const std::string_view commitHashA, const std::string_view commitHashB) const -> std::vector<DiffFile>;
 
+    /// @brief Get the diff between two commits, file by file
+    ///     Every file's diff is passed to the consumer as soon as it is parsed, so the whole diff is never kept in memory
+    /// @param commitHashA The hash of the first commit
+    /// @param commitHashB The hash of the second commit
+    /// @param diffFileConsumer Consumer of every file's diff
+    auto getDiff(const std::string_view commitHashA, const std::string_view commitHashB, const DiffFileConsumer& diffFileConsumer) const -> void;
+
     /// @brief Get the diff of a file in the last commit
     /// @param path The path of the file
     /// @return A vector of DiffFile
@@ -51,9 +60,39 @@ public:
     /// @return A vector of DiffFile
     [[nodiscard]] auto getDiffFile(const std::string_view commitHashA, const std::string_view commitHashB, const std::filesystem::path& path) const -> std::vector<DiffFile>;
 
+    /// @brief Get the diff of two contents, computed in-process
+    /// @param oldContent The content before the change
+    /// @param newContent The content after the change
+    /// @param algorithm The algorithm to find differences with
+    /// @return A vector of DiffFile, empty if the contents are the same
+    [[nodiscard]] auto getContentsDiff(const std::string_view oldContent, const std::string_view newContent, const DiffAlgorithm algorithm = DiffAlgorithm::MYERS) const -> std::vector<DiffFile>;
+
+    /// @brief Get the diff of two blobs, computed in-process
+    /// @details Blobs have no paths, so fileA and fileB hold the blob hashes instead
+    /// @param oldBlobHash The hash of the blob before the change
+    /// @param newBlobHash The hash of the blob after the change
+    /// @param algorithm The algorithm to find differences with
+    /// @return A vector of DiffFile, empty if the blobs are the same
+    [[nodiscard]] auto getBlobsDiff(const std::string_view oldBlobHash, const std::string_view newBlobHash, const DiffAlgorithm algorithm = DiffAlgorithm::MYERS) const -> std::vector<DiffFile>;
+
+    /// @brief Get the diff of a blob and a file in the worktree, computed in-process
+    /// @param blobHash The hash of the blob before the change
+    /// @param path The path of the file, relative to the repository root
+    /// @param algorithm The algorithm to find differences with
+    /// @return A vector of DiffFile, empty if the file content is the same as the blob
+    /// @throws std::runtime_error If the repository is bare and has no worktree
+    [[nodiscard]] auto getBlobWorktreeFileDiff(const std::string_view blobHash, const std::filesystem::path& path, const DiffAlgorithm algorithm = DiffAlgorithm::MYERS) const -> std::vector<DiffFile>;
+
 private:
     const Repository* repository;
 
-    static auto getDiffFilesFromOutput(const GitCommandOutput& output) -> std::vector<DiffFile>;
+    auto readBlob(const std::string_view blobHash) const -> GitObject;
+    static auto createContentsDiff(DiffFile diffFile, const std::string_view oldContent, const std::string_view newContent, const DiffAlgorithm algorithm) -> std::vector<DiffFile>;
+
+    template <typename... Args>
+    auto getDiffFilesStreaming(const std::string_view command, Args&&... args) const -> std::vector<DiffFile>;
+
+    template <typename... Args>
+    auto parseDiffStreaming(const DiffFileConsumer& diffFileConsumer, const std::string_view command, Args&&... args) const -> void;
 };
 } // namespace CppGit
@@ -0,0 +1,106 @@
+#pragma once
+
+#include <cstdint>
+#include <filesystem>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace CppGit {
+
+/// @brief Scope of the config entry, from the least to the most important
+enum class GitConfigScope : uint8_t
+{
+    SYSTEM,   ///< System-wide config (/etc/gitconfig or GIT_CONFIG_SYSTEM)
+    GLOBAL,   ///< User config (~/.gitconfig, ~/.config/git/config or GIT_CONFIG_GLOBAL)
+    LOCAL,    ///< Repository config (.git/config)
+    WORKTREE, ///< Worktree config (.git/config.worktree), only if extensions.worktreeConfig is enabled
+    COMMAND   ///< Config passed through GIT_CONFIG_COUNT, GIT_CONFIG_KEY_<n> and GIT_CONFIG_VALUE_<n> environment variables
+};
+
+/// @brief Single entry of the config snapshot
+struct GitConfigSnapshotEntry
+{
+    std::string key;                  ///< Key in the canonical form <section>[.<subsection>].<name>, section and name are lowercased
+    std::optional<std::string> value; ///< Value or std::nullopt if the key has no value (implicit true)
+    GitConfigScope scope;             ///< Scope of the file the entry comes from
+    bool included;                    ///< Whether the entry comes from a file included by include.path or includeIf.<condition>.path
+};
+
+/// @brief Stamp of the config file, used to detect whether the file has changed since it was read
+struct GitConfigFileStamp
+{
+    std::filesystem::path path;    ///< Path to the file
+    bool exists;                   ///< Whether the file existed when it was read
+    std::int64_t modificationTime; ///< Modification time in nanoseconds
+    std::uintmax_t size;           ///< Size of the file
+};
+
+/// @brief Immutable snapshot of the effective git config (system, global, local, worktree and command scopes)
+///     Entries are indexed by key, so lookups don't depend on the config size.
+class GitConfigSnapshot
+{
+public:
+    /// @param entries Entries in the order git reads them
+    /// @param fileStamps Stamps of all the files which have been read or checked for existence
+    GitConfigSnapshot(std::vector<GitConfigSnapshotEntry> entries, std::vector<GitConfigFileStamp> fileStamps);
+
+    /// @brief Get all entries in the order git reads them
+    /// @return All entries
+    [[nodiscard]] auto getEntries() const -> const std::vector<GitConfigSnapshotEntry>&;
+
+    /// @brief Check whether the key is set
+    /// @param key Config key (e.g. core.bare, remote.origin.url)
+    /// @return True if the key is set in any scope, false otherwise
+    [[nodiscard]] auto hasKey(const std::string_view key) const -> bool;
+
+    /// @brief Get value of the key, the last one wins if the key is set multiple times
+    /// @param key Config key (e.g. user.name)
+    /// @return Value (empty for keys without value) or std::nullopt if the key is not set
+    [[nodiscard]] auto getString(const std::string_view key) const -> std::optional<std::string>;
+
+    /// @brief Get all values of the multi-valued key
+    /// @param key Config key (e.g. remote.origin.fetch)
+    /// @return Values in the order git reads them, empty if the key is not set
+    [[nodiscard]] auto getAll(const std::string_view key) const -> std::vector<std::string>;
+
+    /// @brief Get value of the key as boolean, the same way as `git config --type=bool` does
+    /// @param key Config key (e.g. core.bare)
+    /// @return Value or std::nullopt if the key is not set
+    /// @throws std::runtime_error If the value is not a valid boolean
+    [[nodiscard]] auto getBool(const std::string_view key) const -> std::optional<bool>;
+
+    /// @brief Parse config value as boolean, the same way as `git config --type=bool` does
+    ///     Case is ignored and any non-zero integer is true
+    /// @param key Config key or environment variable name, used in the error message
+    /// @param value Value or std::nullopt for a key without value (implicit true)
+    /// @return Parsed value
+    /// @throws std::runtime_error If the value is not a valid boolean
+    [[nodiscard]] static auto parseBool(const std::string_view key, const std::optional<std::string>& value) -> bool;
+
+    /// @brief Get value of the key as integer, the same way as `git config --type=int` does (with k, m, g suffixes)
+    /// @param key Config key (e.g. core.bigFileThreshold)
+    /// @return Value or std::nullopt if the key is not set
+    /// @throws std::runtime_error If the value is not a valid integer
+    [[nodiscard]] auto getInt(const std::string_view key) const -> std::optional<std::int64_t>;
+
+    /// @brief Check whether none of the read files has changed (by modification time and size)
+    /// @return True if the snapshot is up to date, false otherwise
+    [[nodiscard]] auto isUpToDate() const -> bool;
+
+    /// @brief Create stamp of the file in its current state
+    /// @param path Path to the file
+    /// @return Stamp of the file
+    [[nodiscard]] static auto createFileStamp(const std::filesystem::path& path) -> GitConfigFileStamp;
+
+private:
+    std::vector<GitConfigSnapshotEntry> entries;
+    std::vector<GitConfigFileStamp> fileStamps;
+    std::unordered_map<std::string, std::vector<std::size_t>> entriesIndex;
+
+    [[nodiscard]] auto getLastEntry(const std::string_view key) const -> const GitConfigSnapshotEntry*;
+};
+
+} // namespace CppGit
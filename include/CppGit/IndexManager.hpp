@@ -1,8 +1,10 @@
 #pragma once
+#include "ObjectId.hpp"
 #include "Repository.hpp"
 
 #include <cstdint>
 #include <filesystem>
+#include <optional>
 #include <string>
 #include <string_view>
 #include <vector>
@@ -14,7 +16,7 @@ struct IndexEntry
 {
     int fileMode;               ///< File mode (100644 - regular file, 100755 - executable file, 120000 - symbolic link)
     int stageNumber;            ///< Stage number (0 - regular, 1 - base, 2 - ours, 3 - theirs)
-    std::string objectHash;     ///< Object hash
+    ObjectId objectHash;        ///< Object hash
     std::filesystem::path path; ///< Path to the file
 };
 
@@ -143,10 +145,11 @@ public:
 private:
     const Repository* repository;
 
-    auto getHeadFilesHashForGivenFiles(std::vector<DiffIndexEntry>& files) const -> std::vector<std::string>;
-    auto getUntrackedAndIndexFilesList(const std::string_view pattern = "") const -> std::vector<std::string>;
+    auto getUntrackedAndIndexFilesNulList(const std::string_view pattern = "") const -> std::string;
 
     auto getStagedFilesListOutput(const std::string_view filePattern = "") const -> std::string;
+
+    auto readIndexFileEntries(const std::string_view filePattern, const bool unmergedOnly) const -> std::optional<std::vector<IndexEntry>>;
 };
 
 } // namespace CppGit
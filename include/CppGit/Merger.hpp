@@ -4,12 +4,16 @@
 #include "Repository.hpp"
 #include "_details/GitFilesHelper.hpp"
 #include "_details/IndexWorktreeManager.hpp"
+#include "_details/MergeBaseFinder.hpp"
 #include "_details/ThreeWayMerger.hpp"
 
 #include <cstdint>
 #include <expected>
+#include <memory>
 #include <string>
 #include <string_view>
+#include <utility>
+#include <vector>
 
 namespace CppGit {
 
@@ -70,6 +74,33 @@ public:
     /// @return True if there is anything to merge, otherwise false
     [[nodiscard]] auto isAnythingToMerge(const std::string_view sourceBranch, const std::string_view targetBranch) const -> bool;
 
+    /// @brief Find the best common ancestor of two branches (the same one as `git merge-base` prints)
+    ///     History is walked in-process (using the commit-graph if present), git is only asked about revision expressions.
+    ///     Walked commits are kept by the merger (and its copies), so later calls on the same merger don't read them again.
+    /// @param firstBranch First branch name or commit hash
+    /// @param secondBranch Second branch name or commit hash
+    /// @return Merge base commit hash, empty if branches don't have common ancestor
+    [[nodiscard]] auto getMergeBase(const std::string_view firstBranch, const std::string_view secondBranch) const -> std::string;
+
+    /// @brief Find merge bases of many pairs of branches, reading every commit of the shared history only once
+    ///     Pairs sharing a branch (e.g. many branches against main) are answered by a single walk of the history
+    /// @param branchesPairs Pairs of branch names or commit hashes
+    /// @return Merge base commit hash for every pair (empty if branches don't have common ancestor), in the same order as the pairs
+    [[nodiscard]] auto getMergeBases(const std::vector<std::pair<std::string, std::string>>& branchesPairs) const -> std::vector<std::string>;
+
+    /// @brief Check whether the commit is an ancestor of the other one (or the same commit)
+    /// @param ancestor Possible ancestor branch name or commit hash
+    /// @param descendant Possible descendant branch name or commit hash
+    /// @return True if ancestor is reachable from descendant, otherwise false
+    [[nodiscard]] auto isAncestor(const std::string_view ancestor, const std::string_view descendant) const -> bool;
+
+    /// @brief Check which of the branches are ancestors of the descendant, walking the history only once
+    ///     Useful to check many branches against the main one, e.g. which of them are already merged.
+    /// @param ancestors Possible ancestors branch names or commit hashes
+    /// @param descendant Possible descendant branch name or commit hash
+    /// @return For every possible ancestor whether it's reachable from descendant, in the same order as the ancestors
+    [[nodiscard]] auto areAncestors(const std::vector<std::string>& ancestors, const std::string_view descendant) const -> std::vector<bool>;
+
     /// @brief Check whether there is a merge in progress
     /// @return True if there is a merge in progress, otherwise false
     [[nodiscard]] auto isMergeInProgress() const -> bool;
@@ -91,8 +122,9 @@ private:
     _details::ThreeWayMerger threeWayMerger;
     _details::IndexWorktreeManager indexWorktreeManager;
     _details::GitFilesHelper gitFilesHelper;
+    std::shared_ptr<_details::MergeBaseFinder> mergeBaseFinder;
 
-    auto getAncestor(const std::string_view sourceBranch, const std::string_view targetBranch) const -> std::string;
+    auto getMergeBaseWithGit(const std::string_view firstBranch, const std::string_view secondBranch) const -> std::string;
     auto createMergeCommit(const std::string_view sourceBranchRef, const std::string_view targetBranchRef, const std::string_view message, const std::string_view description) const -> std::string;
     auto startMergeConflict(const std::vector<IndexEntry>& unmergedFilesEntries, const std::string_view sourceBranchRef, const std::string_view sourceLabel, const std::string_view targetLabel, const std::string_view message, const std::string_view description) const -> void;
 
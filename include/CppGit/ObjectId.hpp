@@ -0,0 +1,78 @@
+#pragma once
+
+#include <array>
+#include <compare>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <span>
+#include <string>
+#include <string_view>
+
+namespace CppGit {
+
+/// @brief Identifier (hash) of a git object, stored as bytes instead of hex string
+///     Holds SHA-1 and SHA-256 hashes, as well as abbreviated ones (also with odd number of hex digits),
+///     so it fits in a fixed size and doesn't allocate.
+class ObjectId
+{
+public:
+    static constexpr auto SHA1_SIZE = std::size_t{ 20 };   ///< Number of bytes of SHA-1 hash
+    static constexpr auto SHA256_SIZE = std::size_t{ 32 }; ///< Number of bytes of SHA-256 hash
+
+    /// @brief Create an empty object id
+    ObjectId() = default;
+
+    /// @brief Create object id from a hex string
+    /// @param hex Full or abbreviated hash, lower or upper case
+    /// @return Object id, empty if the string isn't a hash
+    [[nodiscard]] static auto fromHex(const std::string_view hex) -> ObjectId;
+
+    /// @brief Create object id from raw bytes of a hash (as stored in the index or tree objects)
+    /// @param hashBytes Bytes of the hash
+    /// @return Object id, empty if there are more bytes than in SHA-256 hash
+    [[nodiscard]] static auto fromBytes(const std::span<const std::uint8_t> hashBytes) -> ObjectId;
+
+    /// @brief Check whether the string is a full or abbreviated hash
+    /// @param hex String to check
+    /// @return True if the string is not empty, has only hex digits and isn't longer than SHA-256 hash, false otherwise
+    [[nodiscard]] static auto isHex(const std::string_view hex) -> bool;
+
+    /// @brief Get the hash as a hex string
+    /// @return Lower case hash, empty string if the id is empty
+    [[nodiscard]] auto toHex() const -> std::string;
+
+    /// @brief Get the number of hex digits of the hash
+    /// @return Number of hex digits
+    [[nodiscard]] auto getHexSize() const -> std::size_t;
+
+    /// @brief Get the bytes of the hash
+    ///     The last byte of odd length hash has the low half set to zero
+    /// @return Bytes of the hash
+    [[nodiscard]] auto getBytes() const -> std::span<const std::uint8_t>;
+
+    /// @brief Check whether the id is empty
+    /// @return True if the id is empty, false otherwise
+    [[nodiscard]] auto isEmpty() const -> bool;
+
+    auto operator==(const ObjectId&) const -> bool = default;
+    auto operator<=>(const ObjectId&) const -> std::strong_ordering = default;
+
+    /// @brief Compare with a hash written as hex string, without creating a string from the object id
+    /// @param hex Full or abbreviated hash, lower or upper case
+    /// @return True if both are the same hash, false otherwise
+    [[nodiscard]] auto operator==(const std::string_view hex) const -> bool;
+
+private:
+    std::array<std::uint8_t, SHA256_SIZE> bytes{};
+    std::uint8_t hexSize{ 0 };
+};
+
+} // namespace CppGit
+
+/// @brief Hash of the object id, so it can be used as a key of unordered containers
+template <>
+struct std::hash<CppGit::ObjectId>
+{
+    auto operator()(const CppGit::ObjectId& objectId) const noexcept -> std::size_t;
+};
@@ -9,10 +9,15 @@
 #include "_details/DiffApplier.hpp"
 #include "_details/IndexWorktreeManager.hpp"
 #include "_details/RebaseFilesHelper.hpp"
+#include "_details/RebaseTodoList.hpp"
 #include "_details/ReferencesManager.hpp"
 
+#include <cstddef>
 #include <cstdint>
 #include <expected>
+#include <optional>
+#include <string>
+#include <vector>
 
 namespace CppGit {
 
@@ -49,6 +54,23 @@ public:
     /// @return Rebased head commit hash if rebase is successful, otherwise Rebase Result error code
     auto interactiveRebase(const std::string_view upstream, const std::vector<RebaseTodoCommand>& rebaseCommands) const -> std::expected<std::string, RebaseResult>;
 
+    /// @brief Rebase current branch onto upstream branch without touching the index and worktree for every commit
+    ///     See rebaseInMemory(branch, upstream)
+    /// @param upstream Upstream branch name to rebase onto
+    /// @return Rebased head commit hash if rebase is successful, otherwise Rebase Result error code
+    auto rebaseInMemory(const std::string_view upstream) const -> std::expected<std::string, RebaseResult>;
+
+    /// @brief Rebase branch onto upstream branch without touching the index and worktree for every commit
+    ///     Every commit is replayed with `git merge-tree --write-tree` and `git commit-tree`, so the branch doesn't have to be checked out
+    ///     and the repository may be bare. If the branch is checked out, the index and worktree are updated once, after the last commit.
+    ///     On conflict in the checked out branch, rebase continues the regular way from the conflicting commit, so it can be resolved
+    ///     and continued with continueRebase(). On conflict in the branch that isn't checked out, nothing is changed.
+    /// @param branch Branch name to rebase
+    /// @param upstream Upstream branch name to rebase onto
+    /// @throws std::runtime_error if the branch doesn't exist or is empty (HEAD is detached)
+    /// @return Rebased head commit hash if rebase is successful, otherwise Rebase Result error code
+    auto rebaseInMemory(const std::string_view branch, const std::string_view upstream) const -> std::expected<std::string, RebaseResult>;
+
     /// @brief Continue stopped rebase
     /// @return Rebased head commit hash if rebase is successful, otherwise Rebase Result error code
     auto continueRebase() const -> std::expected<std::string, RebaseResult>;
@@ -73,6 +95,12 @@ public:
     /// @return List of default rebase commands
     [[nodiscard]] auto getDefaultTodoCommands(const std::string_view upstream) const -> std::vector<RebaseTodoCommand>;
 
+    /// @brief Set how often the todo and done files are written while rebase is running
+    ///     Todo list is kept in memory and the files are always written when rebase stops (conflict, break, edit, reword, squash),
+    ///     so git can continue it. Checkpoints additionally write them after every given number of processed commands.
+    /// @param interval Number of commands between checkpoints, 0 to write the files only when rebase stops
+    auto setTodoCheckpointInterval(const std::size_t interval) -> void;
+
     /// @brief Get stopped commit message
     /// @return Stopped commit message
     [[nodiscard]] auto getStoppedMessage() const -> std::string;
@@ -80,9 +108,11 @@ public:
 private:
     auto rebaseImpl(const std::string_view upstream, const std::vector<RebaseTodoCommand>& rebaseCommands) const -> std::expected<std::string, RebaseResult>;
     auto startRebase(const std::string_view upstream, const std::vector<RebaseTodoCommand>& rebaseCommands) const -> void;
+    auto createRebaseFiles(const std::string_view ontoHash, const std::string_view headName, const std::string_view origHead, const std::vector<RebaseTodoCommand>& rebaseCommands) const -> void;
     auto endRebase() const -> std::string;
 
     auto processTodoList() const -> RebaseResult;
+    auto flushTodoList() const -> void;
     auto processTodoCommand(const RebaseTodoCommand& rebaseTodoCommand) const -> RebaseResult;
     auto processPickCommand(const RebaseTodoCommand& rebaseTodoCommand) const -> RebaseResult;
     static auto processBreakCommand(const RebaseTodoCommand& /*unused*/) -> RebaseResult;
@@ -93,6 +123,10 @@ private:
     auto processSquash(const RebaseTodoCommand& rebaseTodoCommand) const -> RebaseResult;
 
     auto pickCommit(const Commit& commitInfo) const -> std::expected<std::string, RebaseResult>;
+    auto replayCommit(const Commit& commitInfo, const std::string& ontoHash, std::string& ontoTreeHash) const -> std::expected<std::string, RebaseResult>;
+    auto mergeTreeForPick(const Commit& commitInfo, const std::string& pickedParent, const std::string& ontoTreeHash) const -> std::optional<std::string>;
+
+    auto getTodoCommands(const std::string_view upstream, const std::string_view branch) const -> std::vector<RebaseTodoCommand>;
 
     auto isNextCommandFixupOrSquash() const -> bool;
 
@@ -108,6 +142,9 @@ private:
     _details::DiffApplier diffApplier;
     _details::CommitAmender commitAmender;
     _details::CommitCreator commitCreator;
+
+    mutable _details::RebaseTodoList todoList;
+    std::size_t todoCheckpointInterval{ 0 };
 };
 
 } // namespace CppGit
@@ -1,9 +1,17 @@
 #pragma once
 
-#include "_details/GitCommandExecutor/GitCommandExecutorUnix.hpp"
+#include "GitConfigSnapshot.hpp"
+#include "_details/BatchObjectReader.hpp"
+#include "_details/CommitCache.hpp"
+#include "_details/GitCommandExecutor/GitCommandExecutor.hpp"
+#include "_details/GitCommandExecutor/GitCommandExecutorMeasuring.hpp"
+#include "_details/GitCommandExecutor/GitCommandMetrics.hpp"
 #include "_details/GitCommandExecutor/GitCommandOutput.hpp"
+#include "_details/RepositoryContext.hpp"
 
 #include <filesystem>
+#include <memory>
+#include <optional>
 #include <string>
 #include <string_view>
 #include <unordered_set>
@@ -30,6 +38,10 @@ class Repository
 public:
     /// @param path Path to the repository
     explicit Repository(std::filesystem::path path);
+
+    /// @param path Path to the repository
+    /// @param commandExecutor Executor used to execute all git commands of the repository (e.g. recording or replaying one)
+    Repository(std::filesystem::path path, std::shared_ptr<GitCommandExecutor> commandExecutor);
     Repository() = delete;
 
     /// @brief Execute git command
@@ -41,8 +53,7 @@ public:
     template <typename... Args>
     auto executeGitCommand(const std::vector<std::string>& environmentVariables, const std::string_view cmd, Args&&... args) const -> GitCommandOutput
     {
-        auto commandExecutor = GitCommandExecutorUnix();
-        return commandExecutor.execute(environmentVariables, path.string(), cmd, std::forward<Args>(args)...);
+        return commandExecutor->execute(environmentVariables, path.string(), cmd, std::forward<Args>(args)...);
     }
 
     /// @brief Execute git command
@@ -56,6 +67,76 @@ public:
         return executeGitCommand(std::vector<std::string>{}, cmd, std::forward<Args>(args)...);
     }
 
+    /// @brief Execute git command and pass its standard output to the consumer chunk by chunk while the command is running
+    /// @tparam Args Command arguments types
+    /// @param environmentVariables Environment variables to set before executing the command
+    /// @param stdoutConsumer Consumer of the standard output chunks
+    /// @param cmd Command to execute
+    /// @param args Command arguments
+    /// @return Command output with empty stdout
+    template <typename... Args>
+    auto executeGitCommandStreaming(const std::vector<std::string>& environmentVariables, const GitCommandExecutor::StdoutConsumer& stdoutConsumer, const std::string_view cmd, Args&&... args) const -> GitCommandOutput
+    {
+        return commandExecutor->executeStreaming(environmentVariables, path.string(), stdoutConsumer, cmd, std::forward<Args>(args)...);
+    }
+
+    /// @brief Execute git command and pass its standard output to the consumer chunk by chunk while the command is running
+    /// @tparam Args Command arguments types
+    /// @param stdoutConsumer Consumer of the standard output chunks
+    /// @param cmd Command to execute
+    /// @param args Command arguments
+    /// @return Command output with empty stdout
+    template <typename... Args>
+    auto executeGitCommandStreaming(const GitCommandExecutor::StdoutConsumer& stdoutConsumer, const std::string_view cmd, Args&&... args) const -> GitCommandOutput
+    {
+        return executeGitCommandStreaming(std::vector<std::string>{}, stdoutConsumer, cmd, std::forward<Args>(args)...);
+    }
+
+    /// @brief Execute git command with the input passed to its standard input
+    /// @tparam Args Command arguments types
+    /// @param environmentVariables Environment variables to set before executing the command
+    /// @param input Data written to the standard input of the command
+    /// @param cmd Command to execute
+    /// @param args Command arguments
+    /// @return Command output
+    template <typename... Args>
+    auto executeGitCommandWithInput(const std::vector<std::string>& environmentVariables, const std::string_view input, const std::string_view cmd, Args&&... args) const -> GitCommandOutput
+    {
+        return commandExecutor->executeWithInput(environmentVariables, path.string(), input, cmd, std::forward<Args>(args)...);
+    }
+
+    /// @brief Execute git command with the input passed to its standard input
+    /// @tparam Args Command arguments types
+    /// @param input Data written to the standard input of the command
+    /// @param cmd Command to execute
+    /// @param args Command arguments
+    /// @return Command output
+    template <typename... Args>
+    auto executeGitCommandWithInput(const std::string_view input, const std::string_view cmd, Args&&... args) const -> GitCommandOutput
+    {
+        return executeGitCommandWithInput(std::vector<std::string>{}, input, cmd, std::forward<Args>(args)...);
+    }
+
+    /// @brief Get executor used to execute git commands
+    /// @return Executor used to execute git commands
+    [[nodiscard]] auto getCommandExecutor() const -> const std::shared_ptr<GitCommandExecutor>&;
+
+    /// @brief Get metrics of git commands executed by this repository
+    /// @return Metrics of executed git commands
+    [[nodiscard]] auto getCommandMetrics() const -> GitCommandMetrics&;
+
+    /// @brief Read object from the object database
+    ///     Objects are read through a single long-lived `git cat-file --batch` process, shared with copies of the repository.
+    ///     Safe to call from multiple threads
+    /// @param objectName Object hash or revision expression
+    /// @return Read object or std::nullopt if object doesn't exist
+    [[nodiscard]] auto readObject(const std::string_view objectName) const -> std::optional<GitObject>;
+
+    /// @brief Get cache of parsed commits shared by all managers of the repository
+    ///     The cache can be tuned (memory budget) and inspected (hits and misses) through the returned object
+    /// @return Commit cache
+    [[nodiscard]] auto getCommitCache() const -> CommitCache&;
+
     /// @brief Return branches manager object with current repository
     /// @return BranchesManager object
     [[nodiscard]] auto BranchesManager() const -> CppGit::BranchesManager;
@@ -112,6 +193,23 @@ public:
     /// @return Git directory path as string
     [[nodiscard]] auto getGitDirectoryPath() const -> std::filesystem::path;
 
+    /// @brief Get path of the git directory shared by all worktrees (the same as git directory, unless it's a linked worktree)
+    /// @return Common git directory path
+    [[nodiscard]] auto getCommonDirectoryPath() const -> std::filesystem::path;
+
+    /// @brief Get hash algorithm used by the repository
+    /// @return Object format (sha1 or sha256)
+    [[nodiscard]] auto getObjectFormat() const -> std::string;
+
+    /// @brief Forget the cached location of the repository, so it's discovered again on the next use
+    ///     Location (top level, git directory, object format) is discovered once and cached,
+    ///     this has to be called when the repository is moved, removed or created again in a different way.
+    auto invalidateRepositoryContext() const -> void;
+
+    /// @brief Enable or disable checking whether the cached location of the repository still exists, every time it's used
+    /// @param enabled True to check cached location on every use, false otherwise (default)
+    auto setRepositoryContextValidation(const bool enabled) -> void;
+
     /// @brief Check whether the path is in the git directory
     /// @param path Path to check
     /// @return True if the path is in the git directory, false otherwise
@@ -134,12 +232,36 @@ public:
     /// @return Repository's config
     [[nodiscard]] auto getConfig() const -> std::vector<GitConfigEntry>;
 
+    /// @brief Get effective config of the repository (system, global, local, worktree and command scopes)
+    ///     Config files are read without running git, the snapshot is cached and read again only when any of the files changes.
+    /// @return Config snapshot
+    /// @throws std::runtime_error If any config file is not valid
+    [[nodiscard]] auto getConfigSnapshot() const -> std::shared_ptr<const GitConfigSnapshot>;
+
     /// @brief Get repository's description
     /// @return Repository's description
     [[nodiscard]] auto getDescription() const -> std::string;
 
 private:
     std::filesystem::path path;
+    std::shared_ptr<GitCommandMetrics> commandMetrics;
+    std::shared_ptr<GitCommandExecutorMeasuring> commandExecutor;
+
+    std::shared_ptr<_details::BatchObjectReader> objectReader;
+    std::shared_ptr<CommitCache> commitCache;
+
+    mutable std::optional<_details::RepositoryContext> repositoryContext;
+    bool repositoryContextValidation{ false };
+
+    mutable std::shared_ptr<const GitConfigSnapshot> configSnapshot;
+
+    /// @brief Get cached repository context, discover it if not cached yet
+    /// @return Repository context or std::nullopt if path is not in a repository
+    [[nodiscard]] auto getRepositoryContext() const -> const std::optional<_details::RepositoryContext>&;
+
+    /// @brief Discover repository context by asking git, used when native discovery isn't possible
+    /// @return Repository context or std::nullopt if path is not in a repository
+    [[nodiscard]] auto discoverRepositoryContextWithGit() const -> std::optional<_details::RepositoryContext>;
 
     /// @brief Transform relative path to absolute path
     /// @param relativePath Relative path
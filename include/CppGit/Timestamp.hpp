@@ -0,0 +1,31 @@
+#pragma once
+
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+
+namespace CppGit {
+
+/// @brief Represents a date of a commit, as it is stored by git
+struct Timestamp
+{
+    /// @brief Parse the date in git raw format
+    /// @param date Date in raw format, for example "1722791195 +0200"
+    /// @return Parsed date, std::nullopt if the date isn't in raw format
+    [[nodiscard]] static auto parse(const std::string_view date) -> std::optional<Timestamp>;
+
+    /// @brief Get the date in git raw format
+    /// @return Date in raw format, for example "1722791195 +0200"
+    [[nodiscard]] auto toString() const -> std::string;
+
+    auto operator==(const Timestamp&) const -> bool = default;
+
+    // NOLINTBEGIN(misc-non-private-member-variables-in-classes)
+    std::int64_t secondsSinceEpoch{ 0 };     ///< Seconds since the Unix epoch
+    std::int16_t timezoneOffsetMinutes{ 0 }; ///< Offset of the timezone from UTC in minutes
+    bool negativeUtcOffset{ false };         ///< Whether zero offset is written as "-0000" (git uses it for unknown local timezone)
+    // NOLINTEND(misc-non-private-member-variables-in-classes)
+};
+
+} // namespace CppGit
@@ -0,0 +1,71 @@
+#pragma once
+
+#include "GitCommandExecutor/GitCommandExecutor.hpp"
+#include "GitCommandExecutor/GitCommandSession.hpp"
+
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <string_view>
+
+namespace CppGit {
+
+/// @brief Represents a raw git object read from the object database
+struct GitObject
+{
+    std::string hash;    ///< Full hash of the object
+    std::string type;    ///< Type of the object (commit, tree, blob, tag)
+    std::string content; ///< Raw content of the object
+};
+
+} // namespace CppGit
+
+namespace CppGit::_details {
+
+/// @brief Provides internal functionality to read git objects through a long-lived `git cat-file --batch` process
+///     The process is started lazily on the first request and kept alive until the reader is destroyed,
+///     so any number of object reads cost a single process spawn. It is started as a session of the command executor,
+///     so it is measured, recorded and replayed as a single `cat-file` command. Requests are serialized, so one reader
+///     can be shared by copies of the repository and used from multiple threads.
+class BatchObjectReader
+{
+public:
+    /// @param commandExecutor Executor the process is started with
+    /// @param repositoryPath Path to the repository
+    BatchObjectReader(std::shared_ptr<GitCommandExecutor> commandExecutor, std::string repositoryPath);
+    BatchObjectReader() = delete;
+    BatchObjectReader(const BatchObjectReader&) = delete;
+    BatchObjectReader(BatchObjectReader&&) = delete;
+    auto operator=(const BatchObjectReader&) -> BatchObjectReader& = delete;
+    auto operator=(BatchObjectReader&&) -> BatchObjectReader& = delete;
+    ~BatchObjectReader();
+
+    /// @brief Read object from the object database
+    /// @param objectName Object hash or any revision expression understood by git (e.g. HEAD, HEAD~1, main:file.txt)
+    /// @return Read object or std::nullopt if object doesn't exist
+    [[nodiscard]] auto readObject(const std::string_view objectName) -> std::optional<GitObject>;
+
+private:
+    std::shared_ptr<GitCommandExecutor> commandExecutor;
+    std::string repositoryPath;
+
+    std::mutex sessionMutex;
+    std::unique_ptr<GitCommandSession> session;
+
+    std::string readBuffer;
+    std::size_t readBufferPos{ 0 };
+
+    auto isRunning() const -> bool;
+    auto start() -> void;
+    auto stop() -> void;
+
+    auto readObjectImpl(const std::string_view objectName) -> std::optional<GitObject>;
+
+    auto fillReadBuffer() -> bool;
+    auto readLine() -> std::optional<std::string>;
+    auto readExactly(std::size_t size) -> std::optional<std::string>;
+};
+
+} // namespace CppGit::_details
@@ -0,0 +1,79 @@
+#pragma once
+
+#include "../Commit.hpp"
+#include "../ObjectId.hpp"
+
+#include <cstddef>
+#include <list>
+#include <mutex>
+#include <optional>
+#include <unordered_map>
+
+namespace CppGit {
+
+/// @brief Represents statistics of the commit cache
+struct CommitCacheStatistics
+{
+    std::size_t hits{ 0 };        ///< Number of lookups which found the commit
+    std::size_t misses{ 0 };      ///< Number of lookups which didn't find the commit
+    std::size_t evictions{ 0 };   ///< Number of commits removed to stay within the memory budget
+    std::size_t size{ 0 };        ///< Number of cached commits
+    std::size_t memoryUsage{ 0 }; ///< Estimated memory used by cached commits in bytes
+};
+
+/// @brief Bounded cache of parsed commits by their ids, shared by all managers of a repository
+///     Commits are immutable, so cached ones never have to be invalidated.
+///     The least recently used commits are removed when the estimated memory of all of them exceeds the budget.
+///     All methods are thread-safe
+class CommitCache
+{
+public:
+    static constexpr auto DEFAULT_MEMORY_BUDGET = std::size_t{ 16 * 1024 * 1024 }; ///< Default memory budget in bytes
+
+    /// @param memoryBudget Memory the cached commits may take in bytes
+    explicit CommitCache(const std::size_t memoryBudget = DEFAULT_MEMORY_BUDGET);
+
+    /// @brief Get cached commit and mark it as the most recently used one
+    /// @param commitId Id of the commit
+    /// @return Copy of the cached commit or std::nullopt if the commit isn't cached
+    [[nodiscard]] auto get(const ObjectId& commitId) -> std::optional<Commit>;
+
+    /// @brief Add commit to the cache (or mark it as the most recently used one if it is there already)
+    ///     Commits without id aren't cached
+    /// @param commit Commit to add
+    auto insert(const Commit& commit) -> void;
+
+    /// @brief Set memory the cached commits may take, commits over the new budget are removed immediately
+    /// @param memoryBudget Memory budget in bytes, 0 disables caching
+    auto setMemoryBudget(const std::size_t memoryBudget) -> void;
+
+    /// @brief Get memory the cached commits may take
+    /// @return Memory budget in bytes
+    [[nodiscard]] auto getMemoryBudget() const -> std::size_t;
+
+    /// @brief Get statistics of the cache
+    /// @return Statistics of the cache
+    [[nodiscard]] auto getStatistics() const -> CommitCacheStatistics;
+
+    /// @brief Remove all cached commits and reset statistics
+    auto clear() -> void;
+
+private:
+    struct CacheEntry
+    {
+        Commit commit;
+        std::size_t memoryUsage;
+    };
+    using CacheEntries = std::list<CacheEntry>;
+
+    mutable std::mutex mutex;
+    std::size_t memoryBudget;
+    CacheEntries entries; ///< The most recently used first
+    std::unordered_map<ObjectId, CacheEntries::iterator> entriesById;
+    CommitCacheStatistics statistics;
+
+    [[nodiscard]] static auto estimateMemoryUsage(const Commit& commit) -> std::size_t;
+    auto evictOverBudget() -> void;
+};
+
+} // namespace CppGit
@@ -30,6 +30,15 @@ public:
     /// @return Commit hash
     auto createCommit(const std::string_view message, const std::vector<std::string>& parents, const std::vector<std::string>& envp) const -> std::string;
 
+    /// @brief Create commit from already written tree, without touching the index
+    /// @param treeHash Tree hash
+    /// @param message Commit message
+    /// @param description Commit description
+    /// @param parents Parent commit hashes
+    /// @param envp Environment variables
+    /// @return Commit hash
+    auto createCommitFromTree(std::string treeHash, const std::string_view message, const std::string_view description, const std::vector<std::string>& parents, const std::vector<std::string>& envp) const -> std::string;
+
 
 private:
     const Repository* repository;
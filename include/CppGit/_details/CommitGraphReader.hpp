@@ -0,0 +1,124 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace CppGit::_details {
+
+/// @brief Provides internal functionality to read the commit-graph (objects/info/commit-graph or split commit-graph chain) without running git
+///     Files are memory-mapped, commits are addressed by their position in the graph (positions of the chain layers follow each other,
+///     starting from the base layer), so parents, root tree, commit time and generation are read in constant time.
+///     Commit-graph only describes commits written when it was generated, commits missing in it have to be read from the objects.
+class CommitGraphReader
+{
+public:
+    /// @brief Parent position used when the commit doesn't have the parent
+    static constexpr auto NO_PARENT = std::uint32_t{ 0x7000'0000 };
+
+    /// @param objectsDirectoryPath Path to the objects directory (.git/objects)
+    explicit CommitGraphReader(const std::filesystem::path& objectsDirectoryPath);
+    CommitGraphReader() = delete;
+    CommitGraphReader(const CommitGraphReader&) = delete;
+    CommitGraphReader(CommitGraphReader&&) = delete;
+    auto operator=(const CommitGraphReader&) -> CommitGraphReader& = delete;
+    auto operator=(CommitGraphReader&&) -> CommitGraphReader& = delete;
+    ~CommitGraphReader();
+
+    /// @brief Check whether commit-graph exists and has been read successfully
+    /// @return True if commit-graph can be used, false if it doesn't exist, is corrupted or not supported
+    [[nodiscard]] auto isValid() const -> bool;
+
+    /// @brief Get number of commits in the commit-graph (all layers of the chain)
+    /// @return Number of commits
+    [[nodiscard]] auto getCommitsCount() const -> std::uint32_t;
+
+    /// @brief Get number of layers in the commit-graph (1 for single file)
+    /// @return Number of layers
+    [[nodiscard]] auto getLayersCount() const -> std::size_t;
+
+    /// @brief Check whether generation numbers are corrected commit dates (generation v2) or topological levels (generation v1)
+    /// @return True if generation numbers are corrected commit dates, false otherwise
+    [[nodiscard]] auto hasCorrectedCommitDates() const -> bool;
+
+    /// @brief Find position of the commit
+    /// @param commitHash Commit hash (full hex hash)
+    /// @return Position of the commit or std::nullopt if commit isn't in the commit-graph
+    [[nodiscard]] auto findCommit(const std::string_view commitHash) const -> std::optional<std::uint32_t>;
+
+    /// @brief Get hash of the commit
+    /// @param position Position of the commit
+    /// @return Commit hash
+    [[nodiscard]] auto getCommitHash(const std::uint32_t position) const -> std::string;
+
+    /// @brief Get hash of the root tree of the commit
+    /// @param position Position of the commit
+    /// @return Root tree hash
+    [[nodiscard]] auto getTreeHash(const std::uint32_t position) const -> std::string;
+
+    /// @brief Get positions of the commit parents, in the order they are stored in the commit
+    /// @param position Position of the commit
+    /// @return Parents positions
+    [[nodiscard]] auto getParents(const std::uint32_t position) const -> std::vector<std::uint32_t>;
+
+    /// @brief Append positions of the commit parents to the vector, allows reusing the vector during graph walks
+    /// @param position Position of the commit
+    /// @param parents Vector the parents positions are appended to
+    auto appendParents(const std::uint32_t position, std::vector<std::uint32_t>& parents) const -> void;
+
+    /// @brief Get position of the first parent of the commit
+    /// @param position Position of the commit
+    /// @return First parent position or NO_PARENT if it's a root commit
+    [[nodiscard]] auto getFirstParent(const std::uint32_t position) const -> std::uint32_t;
+
+    /// @brief Get committer time of the commit
+    /// @param position Position of the commit
+    /// @return Committer time in seconds since epoch
+    [[nodiscard]] auto getCommitTime(const std::uint32_t position) const -> std::uint64_t;
+
+    /// @brief Get topological level of the commit (1 for root commits, 1 + max of parents levels otherwise)
+    /// @param position Position of the commit
+    /// @return Topological level
+    [[nodiscard]] auto getTopologicalLevel(const std::uint32_t position) const -> std::uint32_t;
+
+    /// @brief Get generation number of the commit, corrected commit date if available, topological level otherwise
+    ///     Generation of the commit is always greater than generations of its parents.
+    /// @param position Position of the commit
+    /// @return Generation number
+    [[nodiscard]] auto getGeneration(const std::uint32_t position) const -> std::uint64_t;
+
+private:
+    struct Layer
+    {
+        const char* data{ nullptr };
+        std::size_t size{ 0 };
+        std::uint32_t commitsCount{ 0 };
+        std::uint32_t commitsInBase{ 0 };
+        const char* fanout{ nullptr };
+        const char* lookup{ nullptr };
+        const char* commitData{ nullptr };
+        const char* extraEdges{ nullptr };
+        std::size_t extraEdgesCount{ 0 };
+        const char* generationData{ nullptr };
+        const char* generationOverflow{ nullptr };
+        std::size_t generationOverflowCount{ 0 };
+    };
+
+    std::vector<Layer> layers;
+    std::size_t hashSize{ 0 };
+    std::uint32_t commitsCount{ 0 };
+    bool correctedCommitDates{ false };
+    bool valid{ false };
+
+    auto loadLayer(const std::filesystem::path& graphPath) -> bool;
+    auto parseLayer(Layer& layer) -> bool;
+
+    [[nodiscard]] auto getLayer(const std::uint32_t position) const -> const Layer&;
+    [[nodiscard]] auto getCommitData(const std::uint32_t position) const -> const char*;
+};
+
+} // namespace CppGit::_details
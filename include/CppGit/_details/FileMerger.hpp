@@ -0,0 +1,82 @@
+#pragma once
+
+#include "LineDiff.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace CppGit::_details {
+
+/// @brief Result of a three-way merge of file contents
+struct FileMergeResult
+{
+    std::string content;       ///< Merged content, with conflict markers if there are conflicts
+    std::size_t conflictsCount; ///< Number of conflicts
+};
+
+/// @brief Provides internal functionality to merge file contents in-process, with the same result as `git merge-file`
+///     Follows git's xdiff merge: both sides are diffed against the base, overlapping changes become conflicts,
+///     conflicts are refined by diffing both sides against each other (zealous) and conflicts separated only by
+///     a few lines or by lines without letters and digits are joined (alnum).
+class FileMerger
+{
+public:
+    /// @brief Merge changes of both sides made to the common base
+    ///     Binary contents (with NUL byte in the first 8000 bytes) are not merged, the result is our side with one conflict
+    /// @param base Content of the common ancestor
+    /// @param ours Content of our side
+    /// @param theirs Content of their side
+    /// @param oursLabel Label after the conflict start marker
+    /// @param theirsLabel Label after the conflict end marker
+    /// @return Merged content and number of conflicts
+    [[nodiscard]] static auto mergeFile(const std::string_view base, const std::string_view ours, const std::string_view theirs, const std::string_view oursLabel, const std::string_view theirsLabel) -> FileMergeResult;
+
+private:
+    static constexpr auto MARKER_SIZE = std::size_t{ 7 };
+    static constexpr auto MAX_SIMPLIFIED_GAP = std::ptrdiff_t{ 3 };
+
+    /// @brief Kind of merge hunk, values are the same as in git's xdiff
+    enum class HunkMode : std::uint8_t
+    {
+        CONFLICT = 0,  ///< Both sides changed the same lines differently
+        OURS = 1,      ///< Only our side changed the lines
+        THEIRS = 2,    ///< Only their side changed the lines
+        IDENTICAL = 4, ///< Both sides changed the lines the same way (found while refining conflicts)
+    };
+
+    /// @brief Part of the merge, position and count of lines in the base, ours and theirs
+    struct MergeHunk
+    {
+        HunkMode mode;
+        std::ptrdiff_t baseStart;
+        std::ptrdiff_t baseCount;
+        std::ptrdiff_t oursStart;
+        std::ptrdiff_t oursCount;
+        std::ptrdiff_t theirsStart;
+        std::ptrdiff_t theirsCount;
+    };
+
+    struct MergeFiles
+    {
+        std::vector<std::string_view> base;
+        std::vector<std::string_view> ours;
+        std::vector<std::string_view> theirs;
+    };
+
+    static auto createHunks(const MergeFiles& files, const std::vector<LineDiffChange>& oursChanges, const std::vector<LineDiffChange>& theirsChanges) -> std::vector<MergeHunk>;
+    static auto appendHunk(std::vector<MergeHunk>& hunks, const MergeHunk& hunk) -> void;
+    static auto refineConflicts(const MergeFiles& files, const std::vector<MergeHunk>& hunks) -> std::vector<MergeHunk>;
+    static auto simplifyNonConflicts(const MergeFiles& files, std::vector<MergeHunk>& hunks) -> void;
+    static auto fillMergeResult(const MergeFiles& files, const std::vector<MergeHunk>& hunks, const std::string_view oursLabel, const std::string_view theirsLabel) -> FileMergeResult;
+
+    static auto linesEqual(const std::vector<std::string_view>& lines, const std::ptrdiff_t start, const std::vector<std::string_view>& otherLines, const std::ptrdiff_t otherStart, const std::ptrdiff_t count) -> bool;
+    static auto linesContainAlnum(const std::vector<std::string_view>& lines, const std::ptrdiff_t start, const std::ptrdiff_t count) -> bool;
+    static auto isCrLfNeeded(const MergeFiles& files, const MergeHunk& hunk) -> bool;
+    static auto isEolCrLf(const std::vector<std::string_view>& lines, const std::ptrdiff_t index) -> int;
+    static auto appendLines(std::string& result, const std::vector<std::string_view>& lines, const std::ptrdiff_t start, const std::ptrdiff_t count, const bool crLf, const bool addNewLine) -> void;
+};
+
+} // namespace CppGit::_details
@@ -1,7 +1,10 @@
 #pragma once
 
 #include "GitCommandOutput.hpp"
+#include "GitCommandSession.hpp"
 
+#include <functional>
+#include <memory>
 #include <string>
 #include <string_view>
 #include <type_traits>
@@ -13,6 +16,9 @@ namespace CppGit {
 class GitCommandExecutor
 {
 public:
+    /// @brief Consumer of standard output chunks, called while the command is still running
+    using StdoutConsumer = std::function<void(std::string_view)>;
+
     virtual ~GitCommandExecutor();
 
     /// @brief Execute a git command
@@ -50,6 +56,95 @@ public:
     /// @return Output of the command
     auto execute(const std::vector<std::string>& environmentVariables, const std::string_view repoPath, const std::string_view command, const std::vector<std::string>& args) -> GitCommandOutput;
 
+    /// @brief Execute a git command and pass its standard output to the consumer chunk by chunk
+    ///     Chunks are passed as soon as they are read, so they don't have to be aligned to lines or any records
+    /// @tparam Args Types of the arguments
+    /// @param environmentVariables Environment variables to set before executing the command
+    /// @param repoPath Path to the repository
+    /// @param stdoutConsumer Consumer of the standard output chunks
+    /// @param command Command to execute
+    /// @param args Arguments to pass to the command
+    /// @return Output of the command with empty stdout
+    template <typename... Args>
+    auto executeStreaming(const std::vector<std::string>& environmentVariables, const std::string_view repoPath, const StdoutConsumer& stdoutConsumer, const std::string_view command, Args&&... args)
+        -> GitCommandOutput
+        requires((sizeof...(Args) != 1) || !std::conjunction_v<std::is_same<std::decay_t<Args>, std::vector<std::string>>...>)
+    {
+        auto arguments = std::vector<std::string>{};
+        arguments.reserve(sizeof...(args));
+
+        (arguments.emplace_back(std::forward<Args>(args)), ...);
+
+        return executeStreamingImpl(environmentVariables, repoPath, stdoutConsumer, command, arguments);
+    }
+
+    /// @brief Execute a git command and pass its standard output to the consumer chunk by chunk
+    /// @param environmentVariables Environment variables to set before executing the command
+    /// @param repoPath Path to the repository
+    /// @param stdoutConsumer Consumer of the standard output chunks
+    /// @param command Command to execute
+    /// @param args Arguments to pass to the command
+    /// @return Output of the command with empty stdout
+    auto executeStreaming(const std::vector<std::string>& environmentVariables, const std::string_view repoPath, const StdoutConsumer& stdoutConsumer, const std::string_view command, const std::vector<std::string>& args) -> GitCommandOutput;
+
+    /// @brief Execute a git command with the input passed to its standard input
+    /// @tparam Args Types of the arguments
+    /// @param environmentVariables Environment variables to set before executing the command
+    /// @param repoPath Path to the repository
+    /// @param input Data written to the standard input of the command, which is closed afterwards
+    /// @param command Command to execute
+    /// @param args Arguments to pass to the command
+    /// @return Output of the command
+    template <typename... Args>
+    auto executeWithInput(const std::vector<std::string>& environmentVariables, const std::string_view repoPath, const std::string_view input, const std::string_view command, Args&&... args)
+        -> GitCommandOutput
+        requires((sizeof...(Args) != 1) || !std::conjunction_v<std::is_same<std::decay_t<Args>, std::vector<std::string>>...>)
+    {
+        auto arguments = std::vector<std::string>{};
+        arguments.reserve(sizeof...(args));
+
+        (arguments.emplace_back(std::forward<Args>(args)), ...);
+
+        return executeWithInputImpl(environmentVariables, repoPath, input, command, arguments);
+    }
+
+    /// @brief Execute a git command with the input passed to its standard input
+    /// @param environmentVariables Environment variables to set before executing the command
+    /// @param repoPath Path to the repository
+    /// @param input Data written to the standard input of the command, which is closed afterwards
+    /// @param command Command to execute
+    /// @param args Arguments to pass to the command
+    /// @return Output of the command
+    auto executeWithInput(const std::vector<std::string>& environmentVariables, const std::string_view repoPath, const std::string_view input, const std::string_view command, const std::vector<std::string>& args) -> GitCommandOutput;
+
+    /// @brief Start a long-running git command, which exchanges data with the caller until the session is closed
+    /// @tparam Args Types of the arguments
+    /// @param environmentVariables Environment variables to set before executing the command
+    /// @param repoPath Path to the repository
+    /// @param command Command to execute
+    /// @param args Arguments to pass to the command
+    /// @return Session of the started command
+    template <typename... Args>
+    auto startSession(const std::vector<std::string>& environmentVariables, const std::string_view repoPath, const std::string_view command, Args&&... args)
+        -> std::unique_ptr<GitCommandSession>
+        requires((sizeof...(Args) != 1) || !std::conjunction_v<std::is_same<std::decay_t<Args>, std::vector<std::string>>...>)
+    {
+        auto arguments = std::vector<std::string>{};
+        arguments.reserve(sizeof...(args));
+
+        (arguments.emplace_back(std::forward<Args>(args)), ...);
+
+        return startSessionImpl(environmentVariables, repoPath, command, arguments);
+    }
+
+    /// @brief Start a long-running git command, which exchanges data with the caller until the session is closed
+    /// @param environmentVariables Environment variables to set before executing the command
+    /// @param repoPath Path to the repository
+    /// @param command Command to execute
+    /// @param args Arguments to pass to the command
+    /// @return Session of the started command
+    auto startSession(const std::vector<std::string>& environmentVariables, const std::string_view repoPath, const std::string_view command, const std::vector<std::string>& args) -> std::unique_ptr<GitCommandSession>;
+
 protected:
     GitCommandExecutor() = default;
     GitCommandExecutor(const GitCommandExecutor&) = default;
@@ -58,6 +153,9 @@ protected:
     auto operator=(GitCommandExecutor&&) -> GitCommandExecutor& = default;
 
     virtual auto executeImpl(const std::vector<std::string>& environmentVariables, const std::string_view repoPath, const std::string_view command, const std::vector<std::string>& args) -> GitCommandOutput = 0;
+    virtual auto executeStreamingImpl(const std::vector<std::string>& environmentVariables, const std::string_view repoPath, const StdoutConsumer& stdoutConsumer, const std::string_view command, const std::vector<std::string>& args) -> GitCommandOutput = 0;
+    virtual auto executeWithInputImpl(const std::vector<std::string>& environmentVariables, const std::string_view repoPath, const std::string_view input, const std::string_view command, const std::vector<std::string>& args) -> GitCommandOutput = 0;
+    virtual auto startSessionImpl(const std::vector<std::string>& environmentVariables, const std::string_view repoPath, const std::string_view command, const std::vector<std::string>& args) -> std::unique_ptr<GitCommandSession> = 0;
 };
 
 } // namespace CppGit
@@ -0,0 +1,38 @@
+#pragma once
+
+#include "GitCommandExecutor.hpp"
+#include "GitCommandMetrics.hpp"
+#include "GitCommandOutput.hpp"
+#include "GitCommandSession.hpp"
+
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace CppGit {
+
+/// @brief Executes git commands through another executor and records metrics of every command
+///     Metrics of a session are recorded when it is closed, its wall time is the whole lifetime of the process
+class GitCommandExecutorMeasuring : public GitCommandExecutor
+{
+public:
+    /// @param executor Executor which really executes commands
+    /// @param metrics Metrics to record commands into
+    GitCommandExecutorMeasuring(std::shared_ptr<GitCommandExecutor> executor, std::shared_ptr<GitCommandMetrics> metrics);
+
+    /// @brief Get executor which really executes commands
+    /// @return Wrapped executor
+    [[nodiscard]] auto getExecutor() const -> const std::shared_ptr<GitCommandExecutor>&;
+
+private:
+    std::shared_ptr<GitCommandExecutor> executor;
+    std::shared_ptr<GitCommandMetrics> metrics;
+
+    auto executeImpl(const std::vector<std::string>& environmentVariables, const std::string_view repoPath, const std::string_view command, const std::vector<std::string>& args) -> GitCommandOutput override;
+    auto executeStreamingImpl(const std::vector<std::string>& environmentVariables, const std::string_view repoPath, const StdoutConsumer& stdoutConsumer, const std::string_view command, const std::vector<std::string>& args) -> GitCommandOutput override;
+    auto executeWithInputImpl(const std::vector<std::string>& environmentVariables, const std::string_view repoPath, const std::string_view input, const std::string_view command, const std::vector<std::string>& args) -> GitCommandOutput override;
+    auto startSessionImpl(const std::vector<std::string>& environmentVariables, const std::string_view repoPath, const std::string_view command, const std::vector<std::string>& args) -> std::unique_ptr<GitCommandSession> override;
+};
+
+} // namespace CppGit
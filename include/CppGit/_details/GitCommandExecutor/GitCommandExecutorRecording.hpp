@@ -0,0 +1,53 @@
+#pragma once
+
+#include "GitCommandExecutor.hpp"
+#include "GitCommandOutput.hpp"
+#include "GitCommandRecord.hpp"
+#include "GitCommandSession.hpp"
+
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace CppGit {
+
+/// @brief Executes git commands through another executor and records every command with its output
+///     Recorded transcript can be served later by GitCommandExecutorReplay.
+///     Session is recorded as a single command at the point it was started, with everything written to it as the input
+///     and everything read from it as the output. The record is filled in while the session is running.
+class GitCommandExecutorRecording : public GitCommandExecutor
+{
+public:
+    /// @param executor Executor which really executes commands
+    explicit GitCommandExecutorRecording(std::shared_ptr<GitCommandExecutor> executor);
+
+    /// @brief Get commands recorded so far
+    /// @return Recorded commands in execution order
+    [[nodiscard]] auto getRecords() const -> std::vector<GitCommandRecord>;
+
+    /// @brief Remove all recorded commands
+    auto clearRecords() -> void;
+
+private:
+    class Session;
+
+    std::shared_ptr<GitCommandExecutor> executor;
+
+    mutable std::mutex recordsMutex;
+    std::vector<GitCommandRecord> records;
+    std::size_t recordsGeneration{ 0 };
+
+    auto executeImpl(const std::vector<std::string>& environmentVariables, const std::string_view repoPath, const std::string_view command, const std::vector<std::string>& args) -> GitCommandOutput override;
+    auto executeStreamingImpl(const std::vector<std::string>& environmentVariables, const std::string_view repoPath, const StdoutConsumer& stdoutConsumer, const std::string_view command, const std::vector<std::string>& args) -> GitCommandOutput override;
+    auto executeWithInputImpl(const std::vector<std::string>& environmentVariables, const std::string_view repoPath, const std::string_view input, const std::string_view command, const std::vector<std::string>& args) -> GitCommandOutput override;
+    auto startSessionImpl(const std::vector<std::string>& environmentVariables, const std::string_view repoPath, const std::string_view command, const std::vector<std::string>& args) -> std::unique_ptr<GitCommandSession> override;
+
+    auto addRecord(const std::vector<std::string>& environmentVariables, const std::string_view command, const std::vector<std::string>& args, GitCommandOutput output, const std::string_view input = "") -> void;
+    auto updateRecord(const std::size_t recordIndex, const std::size_t generation, const std::function<void(GitCommandRecord&)>& update) -> void;
+};
+
+} // namespace CppGit
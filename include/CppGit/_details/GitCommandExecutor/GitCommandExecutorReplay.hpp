@@ -0,0 +1,47 @@
+#pragma once
+
+#include "GitCommandExecutor.hpp"
+#include "GitCommandOutput.hpp"
+#include "GitCommandRecord.hpp"
+#include "GitCommandSession.hpp"
+
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace CppGit {
+
+/// @brief Serves previously recorded commands from memory without starting any process
+///     Commands have to be executed in the same order as they were recorded.
+///     Session serves the whole recorded output at once and ignores everything written to it
+class GitCommandExecutorReplay : public GitCommandExecutor
+{
+public:
+    /// @param records Recorded commands, e.g. from GitCommandExecutorRecording
+    explicit GitCommandExecutorReplay(std::vector<GitCommandRecord> records);
+
+    /// @brief Start serving records from the beginning again
+    auto rewind() -> void;
+
+    /// @brief Check whether all records have been served
+    /// @return True if all records have been served, false otherwise
+    [[nodiscard]] auto isFinished() const -> bool;
+
+private:
+    std::vector<GitCommandRecord> records;
+
+    mutable std::mutex recordsMutex;
+    std::size_t nextRecord{ 0 };
+
+    auto executeImpl(const std::vector<std::string>& environmentVariables, const std::string_view repoPath, const std::string_view command, const std::vector<std::string>& args) -> GitCommandOutput override;
+    auto executeStreamingImpl(const std::vector<std::string>& environmentVariables, const std::string_view repoPath, const StdoutConsumer& stdoutConsumer, const std::string_view command, const std::vector<std::string>& args) -> GitCommandOutput override;
+    auto executeWithInputImpl(const std::vector<std::string>& environmentVariables, const std::string_view repoPath, const std::string_view input, const std::string_view command, const std::vector<std::string>& args) -> GitCommandOutput override;
+    auto startSessionImpl(const std::vector<std::string>& environmentVariables, const std::string_view repoPath, const std::string_view command, const std::vector<std::string>& args) -> std::unique_ptr<GitCommandSession> override;
+
+    auto takeRecord(const std::string_view command, const std::vector<std::string>& args) -> const GitCommandRecord&;
+};
+
+} // namespace CppGit
@@ -2,9 +2,15 @@
 
 #include "GitCommandExecutor.hpp"
 #include "GitCommandOutput.hpp"
+#include "GitCommandSession.hpp"
 
 #include <array>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <string>
 #include <string_view>
+#include <sys/types.h>
 #include <vector>
 
 namespace CppGit {
@@ -14,18 +20,41 @@ class GitCommandExecutorUnix : public GitCommandExecutor
 {
 public:
     static constexpr const char* const GIT_EXECUTABLE = "git";
-    GitCommandExecutorUnix() = default;
+
+    /// @brief Method used to start git process
+    enum class LaunchMethod : uint8_t
+    {
+        PosixSpawn, ///< posix_spawn, cost doesn't depend on the size of the calling process
+        Fork        ///< fork + exec, page tables of the whole calling process are copied on every call
+    };
+
+    /// @param launchMethod Method used to start git process
+    explicit GitCommandExecutorUnix(const LaunchMethod launchMethod = LaunchMethod::PosixSpawn);
 
 private:
     auto executeImpl(const std::vector<std::string>& environmentVariables, const std::string_view repoPath, const std::string_view command, const std::vector<std::string>& args) -> GitCommandOutput override;
+    auto executeStreamingImpl(const std::vector<std::string>& environmentVariables, const std::string_view repoPath, const StdoutConsumer& stdoutConsumer, const std::string_view command, const std::vector<std::string>& args) -> GitCommandOutput override;
+
+    auto executeWithInputImpl(const std::vector<std::string>& environmentVariables, const std::string_view repoPath, const std::string_view input, const std::string_view command, const std::vector<std::string>& args) -> GitCommandOutput override;
+    auto startSessionImpl(const std::vector<std::string>& environmentVariables, const std::string_view repoPath, const std::string_view command, const std::vector<std::string>& args) -> std::unique_ptr<GitCommandSession> override;
+
+    auto run(const std::vector<std::string>& environmentVariables, const std::string_view repoPath, const std::string_view command, const std::vector<std::string>& args, const StdoutConsumer* stdoutConsumer, const std::optional<std::string_view> input) -> GitCommandOutput;
 
-    auto createPipes() -> void;
-    auto parentProcess() -> GitCommandOutput;
+    auto createPipes(const bool withStdin) -> void;
+    auto parentProcess(const StdoutConsumer* stdoutConsumer, const std::optional<std::string_view> input) -> GitCommandOutput;
+    auto writeAvailable(std::string_view& input) -> bool;
+    auto passToConsumer(const StdoutConsumer& stdoutConsumer, std::string& output) -> void;
+    auto closePipes() -> void;
+    static auto readAvailable(const int fileDescriptor, std::string& output) -> bool;
+    auto spawnProcess(const std::vector<std::string>& environmentVariables, const std::string_view repoPath, const std::string_view command, const std::vector<std::string>& args) -> void;
+    auto forkProcess(const std::vector<std::string>& environmentVariables, const std::string_view repoPath, const std::string_view command, const std::vector<std::string>& args) -> void;
     [[noreturn]] auto childProcess(const std::vector<std::string>& environmentVariables, const std::string_view repoPath, const std::string_view command, const std::vector<std::string>& args) -> void;
 
+    LaunchMethod launchMethod;
     pid_t pid{};
-    std::array<int, 2> stdoutPipe{};
-    std::array<int, 2> stderrPipe{};
+    std::array<int, 2> stdoutPipe{ -1, -1 };
+    std::array<int, 2> stderrPipe{ -1, -1 };
+    std::array<int, 2> stdinSocket{ -1, -1 };
 };
 
 } // namespace CppGit
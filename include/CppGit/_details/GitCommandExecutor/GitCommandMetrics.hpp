@@ -0,0 +1,84 @@
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <string_view>
+
+namespace CppGit {
+
+/// @brief Represents metrics of a single executed git command
+struct GitCommandMetric
+{
+    std::string_view command;          ///< Git subcommand
+    std::size_t argumentsCount;        ///< Number of arguments passed to the subcommand
+    std::chrono::nanoseconds wallTime; ///< Wall time from starting the process to its exit
+    std::size_t stdoutBytes;           ///< Number of bytes written to the standard output
+    std::size_t stderrBytes;           ///< Number of bytes written to the standard error
+    int returnCode;                    ///< Return code of the command
+};
+
+/// @brief Represents aggregated metrics of all executions of a single git subcommand
+struct GitCommandStatistics
+{
+    static constexpr auto HISTOGRAM_BUCKETS = std::size_t{ 24 };
+
+    std::size_t count{ 0 };                                         ///< Number of executions
+    std::size_t failedCount{ 0 };                                   ///< Number of executions with non-zero return code
+    std::size_t argumentsCount{ 0 };                                ///< Sum of arguments count of all executions
+    std::chrono::nanoseconds totalWallTime{ 0 };                    ///< Sum of wall time of all executions
+    std::chrono::nanoseconds minWallTime{ 0 };                      ///< Shortest execution
+    std::chrono::nanoseconds maxWallTime{ 0 };                      ///< Longest execution
+    std::size_t stdoutBytes{ 0 };                                   ///< Sum of standard output bytes
+    std::size_t stderrBytes{ 0 };                                   ///< Sum of standard error bytes
+    std::array<std::size_t, HISTOGRAM_BUCKETS> wallTimeHistogram{}; ///< Bucket N counts executions which took [2^N, 2^(N+1)) microseconds, first and last buckets are open
+};
+
+/// @brief Aggregates metrics of executed git commands per subcommand
+///     All methods are thread-safe
+class GitCommandMetrics
+{
+public:
+    /// @brief Called with metrics of every recorded command
+    using Observer = std::function<void(const GitCommandMetric&)>;
+
+    /// @brief Add metrics of executed command
+    /// @param metric Metrics of executed command
+    auto record(const GitCommandMetric& metric) -> void;
+
+    /// @brief Set observer called with metrics of every recorded command
+    /// @param observer Observer, empty function to remove it
+    auto setObserver(Observer observer) -> void;
+
+    /// @brief Get statistics of all subcommands
+    /// @return Statistics by subcommand name
+    [[nodiscard]] auto getStatistics() const -> std::map<std::string, GitCommandStatistics, std::less<>>;
+
+    /// @brief Get statistics of given subcommand
+    /// @param command Subcommand name
+    /// @return Statistics of the subcommand or std::nullopt if it wasn't executed
+    [[nodiscard]] auto getStatistics(const std::string_view command) const -> std::optional<GitCommandStatistics>;
+
+    /// @brief Get number of all executed commands
+    /// @return Number of all executed commands
+    [[nodiscard]] auto getTotalCount() const -> std::size_t;
+
+    /// @brief Export statistics as CSV, one line per subcommand, histogram buckets are separated with ';'
+    /// @return Statistics in CSV format with header line
+    [[nodiscard]] auto exportCsv() const -> std::string;
+
+    /// @brief Remove all recorded metrics
+    auto reset() -> void;
+
+private:
+    mutable std::mutex mutex;
+    std::map<std::string, GitCommandStatistics, std::less<>> statistics;
+    Observer observer;
+};
+
+} // namespace CppGit
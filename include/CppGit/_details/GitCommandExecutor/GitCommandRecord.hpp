@@ -0,0 +1,20 @@
+#pragma once
+
+#include "GitCommandOutput.hpp"
+
+#include <string>
+#include <vector>
+
+namespace CppGit {
+
+/// @brief Represents a single executed git command together with its output
+struct GitCommandRecord
+{
+    std::vector<std::string> environmentVariables; ///< Environment variables passed to the command
+    std::string command;                           ///< Git subcommand
+    std::vector<std::string> args;                 ///< Arguments of the command
+    GitCommandOutput output;                       ///< Output of the command, for streamed commands stdout contains whole streamed output
+    std::string input;                             ///< Data passed to the standard input of the command
+};
+
+} // namespace CppGit
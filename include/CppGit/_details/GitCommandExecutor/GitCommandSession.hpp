@@ -0,0 +1,40 @@
+#pragma once
+
+#include <string>
+#include <string_view>
+
+namespace CppGit {
+
+/// @brief Long-running git process, which reads requests from its standard input and answers on its standard output
+///     (e.g. `git cat-file --batch`). Started by GitCommandExecutor::startSession(), the process exits when the session
+///     is closed or destroyed. Standard error of the process is discarded.
+class GitCommandSession
+{
+public:
+    virtual ~GitCommandSession();
+
+    /// @brief Write data to the standard input of the process
+    /// @param data Data to write
+    /// @return True if whole data has been written, false if the process doesn't read its input anymore
+    virtual auto write(const std::string_view data) -> bool = 0;
+
+    /// @brief Read the next chunk of the standard output of the process, waiting until anything is available
+    ///     Chunks don't have to be aligned to lines or any records
+    /// @param output String the chunk is appended to
+    /// @return True if anything has been read, false if the output has ended
+    virtual auto read(std::string& output) -> bool = 0;
+
+    /// @brief Close the standard input of the process and wait until it exits
+    ///     Calling it more than once returns the same code
+    /// @return Return code of the process
+    virtual auto close() -> int = 0;
+
+protected:
+    GitCommandSession() = default;
+    GitCommandSession(const GitCommandSession&) = default;
+    GitCommandSession(GitCommandSession&&) = default;
+    auto operator=(const GitCommandSession&) -> GitCommandSession& = default;
+    auto operator=(GitCommandSession&&) -> GitCommandSession& = default;
+};
+
+} // namespace CppGit
@@ -0,0 +1,18 @@
+#pragma once
+
+#include "../GitConfigSnapshot.hpp"
+
+#include <filesystem>
+
+namespace CppGit::_details {
+
+/// @brief Read all config files of the repository without running git
+///     Files are read in the same order as git does: system, global, local, worktree and command scope (GIT_CONFIG_COUNT).
+///     include.path and includeIf.<condition>.path (gitdir:, gitdir/i: and onbranch: conditions) are followed.
+/// @param gitDirectoryPath Git directory of the repository (.git or .git/worktrees/<name>)
+/// @param commonDirectoryPath Git directory shared by all worktrees
+/// @return Config snapshot
+/// @throws std::runtime_error If any config file is not valid or includes are nested too deep
+[[nodiscard]] auto loadGitConfigSnapshot(const std::filesystem::path& gitDirectoryPath, const std::filesystem::path& commonDirectoryPath) -> GitConfigSnapshot;
+
+} // namespace CppGit::_details
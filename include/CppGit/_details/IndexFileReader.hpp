@@ -0,0 +1,85 @@
+#pragma once
+
+#include "../ObjectId.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace CppGit::_details {
+
+/// @brief Entry of the index file
+///     Views point into the memory-mapped index file, so they are valid as long as the reader exists
+struct IndexFileEntry
+{
+    std::uint32_t ctimeSeconds;     ///< Metadata change time, seconds
+    std::uint32_t ctimeNanoseconds; ///< Metadata change time, nanoseconds
+    std::uint32_t mtimeSeconds;     ///< Data change time, seconds
+    std::uint32_t mtimeNanoseconds; ///< Data change time, nanoseconds
+    std::uint32_t device;           ///< Device
+    std::uint32_t inode;            ///< Inode
+    std::uint32_t mode;             ///< Mode (object type and unix permissions)
+    std::uint32_t uid;              ///< User id
+    std::uint32_t gid;              ///< Group id
+    std::uint32_t fileSize;         ///< File size truncated to 32 bits
+    std::string_view objectId;      ///< Binary object id (20 bytes for SHA-1, 32 bytes for SHA-256)
+    std::uint16_t flags;            ///< Flags (assume-valid, extended, stage, name length)
+    std::uint16_t extendedFlags;    ///< Extended flags (skip-worktree, intent-to-add), only in version 3 and above
+    int stage;                      ///< Stage number (0 - regular, 1 - base, 2 - ours, 3 - theirs)
+    std::string_view path;          ///< Path relative to the top level directory
+
+    /// @brief Get object id
+    /// @return Object id
+    [[nodiscard]] auto getObjectId() const -> ObjectId;
+
+    /// @brief Get mode written as octal number, e.g. 100644 for regular file
+    /// @return Mode written as octal number
+    [[nodiscard]] auto getOctalMode() const -> int;
+};
+
+/// @brief Provides internal functionality to read the index file (.git/index) without running git
+///     Supports versions 2, 3 and 4 (with prefix-compressed paths) and both SHA-1 and SHA-256 repositories.
+///     Split and sparse indexes are reported as not valid, so the caller can fall back to git.
+class IndexFileReader
+{
+public:
+    /// @param indexPath Path to the index file, not existing file is treated as an empty index
+    explicit IndexFileReader(const std::filesystem::path& indexPath);
+    IndexFileReader() = delete;
+    IndexFileReader(const IndexFileReader&) = delete;
+    IndexFileReader(IndexFileReader&&) = delete;
+    auto operator=(const IndexFileReader&) -> IndexFileReader& = delete;
+    auto operator=(IndexFileReader&&) -> IndexFileReader& = delete;
+    ~IndexFileReader();
+
+    /// @brief Check whether the index file has been read successfully
+    /// @return True if the index file has been read, false if it is corrupted or not supported
+    [[nodiscard]] auto isValid() const -> bool;
+
+    /// @brief Get version of the index file
+    /// @return Version of the index file
+    [[nodiscard]] auto getVersion() const -> std::uint32_t;
+
+    /// @brief Get entries of the index, sorted by path and stage
+    /// @return Entries of the index
+    [[nodiscard]] auto getEntries() const -> const std::vector<IndexFileEntry>&;
+
+private:
+    const char* data{ nullptr };
+    std::size_t size{ 0 };
+
+    bool valid{ false };
+    std::uint32_t version{ 0 };
+    std::vector<IndexFileEntry> entries;
+    std::unique_ptr<char[]> pathsBuffer; // NOLINT(cppcoreguidelines-avoid-c-arrays, modernize-avoid-c-arrays)
+
+    auto parse(const std::size_t hashSize) -> bool;
+    auto parseEntries(const std::size_t hashSize, const std::uint32_t entriesCount) -> std::size_t;
+    auto parseExtensions(std::size_t offset, const std::size_t hashSize) const -> bool;
+};
+
+} // namespace CppGit::_details
@@ -0,0 +1,204 @@
+#pragma once
+
+#include "../DiffFile.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string_view>
+#include <vector>
+
+namespace CppGit::_details {
+
+/// @brief Range of lines that differ between two files
+struct LineDiffChange
+{
+    std::size_t oldStart; ///< Index of the first changed line in the old file
+    std::size_t oldCount; ///< Number of changed lines in the old file (0 for pure insertion)
+    std::size_t newStart; ///< Index of the first changed line in the new file
+    std::size_t newCount; ///< Number of changed lines in the new file (0 for pure deletion)
+};
+
+/// @brief Provides internal functionality to compute line-based differences of two files in-process
+///     Lines are interned to integer ids, so comparing two lines is a single integer comparison.
+///     Differences are found the same way as git's xdiff does, so results match `git diff`. For Myers' algorithm
+///     common ends are trimmed, lines without a match on the other side are discarded up front and the rest is compared
+///     with linear space Myers' bisection (with the same cost heuristics). Patience and histogram diffs split files
+///     at matched lines and fall back to Myers' algorithm for ranges without good matches. Changes are compacted afterwards,
+///     so ambiguous changes are shifted down as far as possible (or to the best place by indentation) and lined up with
+///     changes on the other side.
+class LineDiff
+{
+public:
+    /// @brief Split content to lines, every line keeps its line ending
+    /// @param content Content to split
+    /// @return Lines of the content, the last one may not end with line ending
+    [[nodiscard]] static auto splitLines(const std::string_view content) -> std::vector<std::string_view>;
+
+    /// @brief Compute differences between two files
+    /// @param oldLines Lines of the old file
+    /// @param newLines Lines of the new file
+    /// @param algorithm Algorithm to find differences with
+    /// @param indentHeuristic Whether to place ambiguous changes by indentation of surrounding lines (as `git diff` does by default)
+    /// @return Changes, ordered by position
+    [[nodiscard]] static auto diff(const std::vector<std::string_view>& oldLines, const std::vector<std::string_view>& newLines, const DiffAlgorithm algorithm = DiffAlgorithm::MYERS, const bool indentHeuristic = false) -> std::vector<LineDiffChange>;
+
+private:
+    using LineId = std::uint32_t;
+
+    static constexpr auto SIMILAR_SCAN_WINDOW = std::ptrdiff_t{ 100 };
+    static constexpr auto KEEP_DISCARDED_RUN = std::ptrdiff_t{ 4 };
+    static constexpr auto MAX_EQUAL_LIMIT = std::ptrdiff_t{ 1024 };
+    static constexpr auto MIN_MAX_COST = std::ptrdiff_t{ 256 };
+    static constexpr auto HEURISTIC_MIN_COST = std::ptrdiff_t{ 256 };
+    static constexpr auto SNAKE_COUNT = std::ptrdiff_t{ 20 };
+    static constexpr auto HEURISTIC_FACTOR = std::ptrdiff_t{ 4 };
+    static constexpr auto HISTOGRAM_MAX_CHAIN_LENGTH = std::ptrdiff_t{ 64 };
+    static constexpr auto INDENT_HEURISTIC_MAX_SLIDING = std::ptrdiff_t{ 100 };
+    static constexpr auto MAX_INDENT = 200;
+    static constexpr auto MAX_BLANKS = 20;
+
+    /// @brief Line ids of one file and flags of lines changed in it
+    ///     Flags have a sentinel element before and after the lines, so groups of changes can be walked without bounds checks.
+    ///     Lines that take part in the comparison (not trimmed or discarded) are kept separately with their original indices.
+    struct DiffSide
+    {
+        std::vector<LineId> lines;
+        std::vector<char> changed;
+        std::vector<int> indents;
+        std::vector<LineId> comparedLines;
+        std::vector<std::ptrdiff_t> comparedIndices;
+        std::ptrdiff_t comparedStart{ 0 };
+        std::ptrdiff_t comparedEnd{ 0 };
+
+        [[nodiscard]] auto isChanged(const std::ptrdiff_t index) const -> bool
+        {
+            return changed[static_cast<std::size_t>(index + 1)] != 0;
+        }
+
+        auto setChanged(const std::ptrdiff_t index, const bool value) -> void
+        {
+            changed[static_cast<std::size_t>(index + 1)] = value ? 1 : 0;
+        }
+
+        [[nodiscard]] auto size() const -> std::ptrdiff_t
+        {
+            return static_cast<std::ptrdiff_t>(lines.size());
+        }
+    };
+
+    /// @brief Furthest reaching paths of the forward and backward searches, indexed by diagonal
+    struct SearchContext
+    {
+        std::vector<std::ptrdiff_t> forward;
+        std::vector<std::ptrdiff_t> backward;
+        std::ptrdiff_t diagonalOffset;
+        std::ptrdiff_t maxCost;
+
+        [[nodiscard]] auto forwardAt(const std::ptrdiff_t diagonal) -> std::ptrdiff_t&
+        {
+            return forward[static_cast<std::size_t>(diagonal + diagonalOffset)];
+        }
+
+        [[nodiscard]] auto backwardAt(const std::ptrdiff_t diagonal) -> std::ptrdiff_t&
+        {
+            return backward[static_cast<std::size_t>(diagonal + diagonalOffset)];
+        }
+    };
+
+    /// @brief Point splitting the compared box and whether both halves need a minimal diff
+    struct Split
+    {
+        std::ptrdiff_t oldSplit;
+        std::ptrdiff_t newSplit;
+        bool minimalLow;
+        bool minimalHigh;
+    };
+
+    /// @brief Line matched by patience diff, unique in the old file, position in the new file if it's unique there too
+    struct PatienceEntry
+    {
+        std::ptrdiff_t oldIndex;
+        std::ptrdiff_t newIndex;
+    };
+
+    /// @brief Occurrences of one line in the old file for histogram diff, from the first one
+    struct HistogramRecord
+    {
+        std::ptrdiff_t firstIndex;
+        std::ptrdiff_t count;
+    };
+
+    /// @brief Common range found by histogram diff, both ends inclusive
+    struct HistogramRegion
+    {
+        std::ptrdiff_t oldBegin;
+        std::ptrdiff_t oldEnd;
+        std::ptrdiff_t newBegin;
+        std::ptrdiff_t newEnd;
+    };
+
+    /// @brief Result of histogram diff's search, no region means nothing in common, fall back means lines in common are too frequent
+    struct HistogramSearchResult
+    {
+        std::optional<HistogramRegion> region;
+        bool fallBack;
+    };
+
+    /// @brief Placement of a split between lines, used by indent heuristic
+    struct SplitMeasurement
+    {
+        bool endOfFile;
+        int indent;
+        int preBlank;
+        int preIndent;
+        int postBlank;
+        int postIndent;
+    };
+
+    /// @brief Score of a split, lower is better
+    struct SplitScore
+    {
+        int effectiveIndent;
+        int penalty;
+    };
+
+    /// @brief Group of consecutive changed lines [start, end), may be empty
+    struct Group
+    {
+        std::ptrdiff_t start;
+        std::ptrdiff_t end;
+    };
+
+    static auto myersDiff(DiffSide& oldFile, DiffSide& newFile, const bool needMinimal) -> void;
+    static auto fallBackToMyersDiff(DiffSide& oldFile, const std::ptrdiff_t oldBegin, const std::ptrdiff_t oldEnd, DiffSide& newFile, const std::ptrdiff_t newBegin, const std::ptrdiff_t newEnd) -> void;
+    static auto markChanged(DiffSide& file, std::ptrdiff_t begin, const std::ptrdiff_t end) -> void;
+
+    static auto trimCommonEnds(DiffSide& oldFile, DiffSide& newFile) -> void;
+    static auto discardUnmatchedLines(DiffSide& file, const std::vector<std::ptrdiff_t>& otherFileLineCounts) -> void;
+    static auto isDiscardableMultimatch(const std::vector<char>& discardKinds, const std::ptrdiff_t index, std::ptrdiff_t start, std::ptrdiff_t end) -> bool;
+    static auto approximateSqrt(std::ptrdiff_t value) -> std::ptrdiff_t;
+
+    static auto compareRange(DiffSide& oldFile, std::ptrdiff_t oldBegin, std::ptrdiff_t oldEnd, DiffSide& newFile, std::ptrdiff_t newBegin, std::ptrdiff_t newEnd, const bool needMinimal, SearchContext& context) -> void;
+    static auto splitRange(const DiffSide& oldFile, const std::ptrdiff_t oldBegin, const std::ptrdiff_t oldEnd, const DiffSide& newFile, const std::ptrdiff_t newBegin, const std::ptrdiff_t newEnd, const bool needMinimal, SearchContext& context) -> Split;
+
+    static auto patienceDiff(DiffSide& oldFile, std::ptrdiff_t oldBegin, std::ptrdiff_t oldEnd, DiffSide& newFile, std::ptrdiff_t newBegin, std::ptrdiff_t newEnd) -> void;
+    static auto findPatienceSequence(std::vector<PatienceEntry>& entries) -> std::vector<PatienceEntry>;
+
+    static auto histogramDiff(DiffSide& oldFile, std::ptrdiff_t oldBegin, std::ptrdiff_t oldEnd, DiffSide& newFile, std::ptrdiff_t newBegin, std::ptrdiff_t newEnd) -> void;
+    static auto findHistogramRegion(const DiffSide& oldFile, const std::ptrdiff_t oldBegin, const std::ptrdiff_t oldEnd, const DiffSide& newFile, const std::ptrdiff_t newBegin, const std::ptrdiff_t newEnd) -> HistogramSearchResult;
+
+    static auto compact(DiffSide& file, DiffSide& otherFile, const bool indentHeuristic) -> void;
+    static auto findBestIndentShift(const DiffSide& file, const Group& group, const std::ptrdiff_t earliestEnd, const std::ptrdiff_t groupSize) -> std::ptrdiff_t;
+    static auto getIndent(const std::string_view line) -> int;
+    static auto measureSplit(const DiffSide& file, const std::ptrdiff_t split) -> SplitMeasurement;
+    static auto addSplitScore(const SplitMeasurement& measurement, SplitScore& score) -> void;
+    static auto compareScores(const SplitScore& score, const SplitScore& otherScore) -> int;
+    static auto initGroup(const DiffSide& file) -> Group;
+    static auto nextGroup(const DiffSide& file, Group& group) -> bool;
+    static auto previousGroup(const DiffSide& file, Group& group) -> bool;
+    static auto slideGroupDown(DiffSide& file, Group& group) -> bool;
+    static auto slideGroupUp(DiffSide& file, Group& group) -> bool;
+};
+
+} // namespace CppGit::_details
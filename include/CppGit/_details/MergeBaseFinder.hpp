@@ -0,0 +1,118 @@
+#pragma once
+
+#include "../Repository.hpp"
+#include "CommitGraphReader.hpp"
+#include "ReferencesReader.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace CppGit::_details {
+
+/// @brief Provides internal functionality to find merge bases and check ancestry without running `git merge-base`
+///     Commits are walked in the order of generation numbers (then commit dates), the same way as git does.
+///     Parents and generations come from the commit-graph if the commit is in it, otherwise the commit object is read and parsed.
+///     Commits read once are cached for the lifetime of the finder, so a finder kept by the caller answers many queries
+///     over the same history cheaply. References are read again for every query, so moved branches are always seen.
+///     Queries can be made from multiple threads, they are serialized.
+///     Every method returns std::nullopt when the answer can't be found natively (e.g. revision expression, shallow repository),
+///     so the caller can fall back to git.
+class MergeBaseFinder
+{
+public:
+    /// @param repo The repository to work with
+    explicit MergeBaseFinder(const Repository& repo);
+
+    /// @brief Find the best common ancestor of two commits, the same one as `git merge-base` prints
+    /// @param first First commit (hash or reference name)
+    /// @param second Second commit (hash or reference name)
+    /// @return Merge base hash, empty string if commits don't have common ancestor, std::nullopt if it can't be found natively
+    [[nodiscard]] auto getMergeBase(const std::string_view first, const std::string_view second) -> std::optional<std::string>;
+
+    /// @brief Find merge bases of many pairs of commits, reusing commits read for the previous pairs
+    ///     Pairs sharing a commit (e.g. many branches against main) are answered by a single walk, which paints
+    ///     the shared commit once and every other commit with its own bit, up to 64 pairs at once.
+    ///     The remaining pairs are walked one by one.
+    /// @param pairs Pairs of commits (hashes or reference names)
+    /// @return Merge base for every pair, in the same order as the pairs, std::nullopt for pairs that can't be answered natively
+    [[nodiscard]] auto getMergeBases(const std::vector<std::pair<std::string, std::string>>& pairs) -> std::vector<std::optional<std::string>>;
+
+    /// @brief Check whether the commit is an ancestor of the other one (or the same commit), like `git merge-base --is-ancestor`
+    /// @param ancestor Possible ancestor (hash or reference name)
+    /// @param descendant Possible descendant (hash or reference name)
+    /// @return True if ancestor is reachable from descendant, std::nullopt if it can't be checked natively
+    [[nodiscard]] auto isAncestor(const std::string_view ancestor, const std::string_view descendant) -> std::optional<bool>;
+
+    /// @brief Check which of the commits are ancestors of the descendant, in a single walk from the descendant
+    /// @param ancestors Possible ancestors (hashes or reference names)
+    /// @param descendant Possible descendant (hash or reference name)
+    /// @return For every possible ancestor whether it's reachable from descendant, std::nullopt if it can't be checked natively
+    [[nodiscard]] auto areAncestors(const std::vector<std::string>& ancestors, const std::string_view descendant) -> std::optional<std::vector<bool>>;
+
+private:
+    using NodeId = std::uint32_t;
+
+    struct Node
+    {
+        std::string hash;
+        std::vector<NodeId> parents;
+        std::vector<std::string> parentsHashes; // Parents of commits read from the objects, turned into nodes lazily
+        std::uint64_t generation{ 0 };
+        std::uint64_t commitTime{ 0 };
+        std::uint32_t graphPosition{ CommitGraphReader::NO_PARENT };
+        bool parentsLoaded{ false };
+        std::uint8_t flags{ 0 };
+    };
+
+    // Marks of the walk for many pairs sharing a commit, bit N belongs to the pair N
+    struct PairsMarks
+    {
+        std::uint64_t others{ 0 };  // Reachable from the other commit of the pair
+        std::uint64_t stale{ 0 };   // Reachable from a common ancestor of the pair
+        std::uint64_t results{ 0 }; // Already added to the merge base candidates of the pair
+    };
+
+    static constexpr auto MAX_SHARED_WALK_PAIRS = std::size_t{ 64 };
+
+    const Repository* repository;
+    std::mutex mutex;
+    bool initialized{ false };
+    bool supported{ true };
+    std::unique_ptr<CommitGraphReader> commitGraphReader;
+    std::vector<Node> nodes;
+    std::unordered_map<std::string, NodeId> nodesByHash;
+    std::unordered_map<std::uint32_t, NodeId> nodesByGraphPosition;
+    std::vector<NodeId> touchedNodes;
+    std::vector<PairsMarks> pairsMarks;
+
+    auto initialize() -> void;
+    [[nodiscard]] auto createReferencesReader() const -> ReferencesReader;
+    [[nodiscard]] auto resolveCommit(ReferencesReader& referencesReader, const std::string_view name) -> std::optional<NodeId>;
+    [[nodiscard]] auto areAncestorsImpl(const std::vector<std::string>& ancestors, const std::string_view descendant) -> std::optional<std::vector<bool>>;
+    [[nodiscard]] auto getNode(const std::string& hash) -> std::optional<NodeId>;
+    [[nodiscard]] auto getNodeByGraphPosition(const std::uint32_t position) -> NodeId;
+    [[nodiscard]] auto loadParents(const NodeId nodeId) -> bool;
+
+    [[nodiscard]] auto paintDownToCommon(const NodeId first, const NodeId second, const std::uint64_t minGeneration) -> std::optional<std::vector<NodeId>>;
+    [[nodiscard]] auto removeRedundant(std::vector<NodeId> candidates) -> std::optional<std::vector<NodeId>>;
+    [[nodiscard]] auto markReachable(const std::vector<NodeId>& tips, const std::uint64_t minGeneration) -> bool;
+    [[nodiscard]] auto getMergeBaseImpl(const NodeId first, const NodeId second) -> std::optional<std::string>;
+    [[nodiscard]] auto getSharedMergeBases(const NodeId shared, const std::vector<std::pair<NodeId, NodeId>>& pairs) -> std::optional<std::vector<std::optional<std::string>>>;
+    [[nodiscard]] auto paintDownToCommonShared(const NodeId shared, const std::vector<NodeId>& others) -> std::optional<std::vector<std::vector<NodeId>>>;
+    [[nodiscard]] auto selectBestMergeBases(std::vector<NodeId> candidates) -> std::optional<std::vector<NodeId>>;
+    [[nodiscard]] auto getPairsMarks(const NodeId nodeId) -> PairsMarks&;
+
+    auto markNode(const NodeId nodeId, const std::uint8_t flags) -> void;
+    auto clearMarks() -> void;
+    auto insertByDate(std::vector<NodeId>& list, const NodeId nodeId) const -> void;
+};
+
+} // namespace CppGit::_details
@@ -0,0 +1,200 @@
+#pragma once
+
+#include "../../Commit.hpp"
+#include "CommitParser.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <tuple>
+
+namespace CppGit {
+
+/// @brief Field of a commit log record
+enum class CommitLogField : uint8_t
+{
+    HASH,            ///< %H
+    PARENTS,         ///< %P
+    AUTHOR_NAME,     ///< %an
+    AUTHOR_EMAIL,    ///< %ae
+    AUTHOR_DATE,     ///< %ad
+    COMMITTER_NAME,  ///< %cn
+    COMMITTER_EMAIL, ///< %ce
+    COMMITTER_DATE,  ///< %cd
+    MESSAGE,         ///< %s
+    DESCRIPTION,     ///< %b
+    TREE_HASH,       ///< %T
+    RAW_MESSAGE,     ///< %B, split into message and description the same way as in commit objects
+};
+
+/// @brief Commit log format known at compile time
+///     Pretty format for git is generated from the fields, and every field is parsed straight into its place,
+///     so records are parsed in one pass without looking at the format again.
+///     Fields are separated by the unit separator character, which doesn't appear in names, emails or messages.
+///     The last field takes the rest of the record, so it can be any text (like the description).
+/// @tparam Fields Fields of the record, in the order they are written
+template <CommitLogField... Fields>
+class CommitLogFormat final
+{
+    static_assert(sizeof...(Fields) > 0, "Commit log format needs at least one field");
+
+public:
+    static constexpr auto FIELD_SEPARATOR = '\x1f'; ///< Separator between fields in the output
+
+    /// @brief Get the pretty format to pass to git, for example "%H%x1f%s"
+    /// @return Pretty format
+    [[nodiscard]] static constexpr auto getPrettyFormat() -> std::string_view
+    {
+        return std::string_view{ PRETTY_FORMAT.data(), PRETTY_FORMAT.size() - 1 };
+    }
+
+    /// @brief Parse one record of the log
+    /// @param commitLog Record written with the pretty format
+    /// @return Commit object
+    [[nodiscard]] static auto parse(std::string_view commitLog) -> Commit
+    {
+        auto record = CommitLogRecord{};
+        auto fieldIndex = std::size_t{ 0 };
+        (parseField<Fields>(commitLog, record, ++fieldIndex == sizeof...(Fields)), ...);
+
+        return CommitParser::createCommit(record);
+    }
+
+private:
+    static constexpr auto SEPARATOR_PLACEHOLDER = std::string_view{ "%x1f" };
+
+    [[nodiscard]] static constexpr auto getPlaceholder(const CommitLogField field) -> std::string_view
+    {
+        switch (field)
+        {
+        case CommitLogField::HASH:
+            return "%H";
+        case CommitLogField::PARENTS:
+            return "%P";
+        case CommitLogField::AUTHOR_NAME:
+            return "%an";
+        case CommitLogField::AUTHOR_EMAIL:
+            return "%ae";
+        case CommitLogField::AUTHOR_DATE:
+            return "%ad";
+        case CommitLogField::COMMITTER_NAME:
+            return "%cn";
+        case CommitLogField::COMMITTER_EMAIL:
+            return "%ce";
+        case CommitLogField::COMMITTER_DATE:
+            return "%cd";
+        case CommitLogField::MESSAGE:
+            return "%s";
+        case CommitLogField::DESCRIPTION:
+            return "%b";
+        case CommitLogField::TREE_HASH:
+            return "%T";
+        case CommitLogField::RAW_MESSAGE:
+            return "%B";
+        }
+
+        return "";
+    }
+
+    static constexpr auto PRETTY_FORMAT_SIZE = (getPlaceholder(Fields).size() + ...) + (SEPARATOR_PLACEHOLDER.size() * (sizeof...(Fields) - 1));
+
+    static constexpr auto PRETTY_FORMAT = [] {
+        auto prettyFormat = std::array<char, PRETTY_FORMAT_SIZE + 1>{};
+        auto position = prettyFormat.begin();
+        auto isFirst = true;
+
+        const auto appendField = [&](const std::string_view placeholder) {
+            if (!isFirst)
+            {
+                position = std::ranges::copy(SEPARATOR_PLACEHOLDER, position).out;
+            }
+            position = std::ranges::copy(placeholder, position).out;
+            isFirst = false;
+        };
+        (appendField(getPlaceholder(Fields)), ...);
+
+        return prettyFormat;
+    }();
+
+    template <CommitLogField Field>
+    static auto parseField(std::string_view& commitLog, CommitLogRecord& record, const bool isLast) -> void
+    {
+        auto value = commitLog;
+        if (!isLast)
+        {
+            const auto valueEnd = std::min(commitLog.find(FIELD_SEPARATOR), commitLog.size());
+            value = commitLog.substr(0, valueEnd);
+            commitLog.remove_prefix(std::min(valueEnd + 1, commitLog.size()));
+        }
+
+        if constexpr (Field == CommitLogField::HASH)
+        {
+            record.hash = value;
+        }
+        else if constexpr (Field == CommitLogField::PARENTS)
+        {
+            record.parents = value;
+        }
+        else if constexpr (Field == CommitLogField::AUTHOR_NAME)
+        {
+            record.authorName = value;
+        }
+        else if constexpr (Field == CommitLogField::AUTHOR_EMAIL)
+        {
+            record.authorEmail = value;
+        }
+        else if constexpr (Field == CommitLogField::AUTHOR_DATE)
+        {
+            record.authorDate = value;
+        }
+        else if constexpr (Field == CommitLogField::COMMITTER_NAME)
+        {
+            record.committerName = value;
+        }
+        else if constexpr (Field == CommitLogField::COMMITTER_EMAIL)
+        {
+            record.committerEmail = value;
+        }
+        else if constexpr (Field == CommitLogField::COMMITTER_DATE)
+        {
+            record.committerDate = value;
+        }
+        else if constexpr (Field == CommitLogField::MESSAGE)
+        {
+            record.message = value;
+        }
+        else if constexpr (Field == CommitLogField::DESCRIPTION)
+        {
+            record.description = value;
+        }
+        else if constexpr (Field == CommitLogField::TREE_HASH)
+        {
+            record.treeHash = value;
+        }
+        else if constexpr (Field == CommitLogField::RAW_MESSAGE)
+        {
+            // Raw message ends with new line, the same as commit object
+            if (value.ends_with('\n'))
+            {
+                value.remove_suffix(1);
+            }
+            std::tie(record.message, record.description) = CommitParser::splitRawMessage(value);
+        }
+    }
+};
+
+/// @brief Format of the detailed commit log read by CommitsLogManager
+using DetailedCommitLogFormat = CommitLogFormat<CommitLogField::HASH,
+                                                CommitLogField::PARENTS,
+                                                CommitLogField::AUTHOR_NAME,
+                                                CommitLogField::AUTHOR_EMAIL,
+                                                CommitLogField::AUTHOR_DATE,
+                                                CommitLogField::COMMITTER_NAME,
+                                                CommitLogField::COMMITTER_EMAIL,
+                                                CommitLogField::COMMITTER_DATE,
+                                                CommitLogField::TREE_HASH,
+                                                CommitLogField::RAW_MESSAGE>;
+
+} // namespace CppGit
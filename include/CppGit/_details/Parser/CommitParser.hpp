@@ -1,12 +1,34 @@
 #pragma once
 
 #include "../../Commit.hpp"
+#include "../../ObjectId.hpp"
+#include "../../Timestamp.hpp"
 #include "Parser.hpp"
 
+#include <optional>
+#include <string>
 #include <string_view>
+#include <utility>
+#include <vector>
 
 namespace CppGit {
 
+/// @brief Fields of a commit log record, as they are written by git
+struct CommitLogRecord
+{
+    std::string_view hash;
+    std::string_view parents; ///< Hashes of parents separated by spaces
+    std::string_view authorName;
+    std::string_view authorEmail;
+    std::string_view authorDate;
+    std::string_view committerName;
+    std::string_view committerEmail;
+    std::string_view committerDate;
+    std::string_view message;
+    std::string_view description;
+    std::string_view treeHash;
+};
+
 /// @brief Provides internal functionality to parse commit logs
 class CommitParser final : protected Parser
 {
@@ -19,19 +41,62 @@ public:
     /// @return Commit object
     [[nodiscard]] static auto parseCommit_CatFile(const std::string_view commitLog) -> Commit;
 
+    /// @brief Parse commits from the git cat-file --batch output
+    ///     Objects of other types and missing objects are skipped
+    /// @param batchOutput Output of the git cat-file --batch command
+    /// @return Commit objects, in the same order as in the output
+    [[nodiscard]] static auto parseCommits_CatFileBatch(const std::string_view batchOutput) -> std::vector<Commit>;
+
     /// @brief Parse a commit log from the git rev-list command
     /// @param commitLog Commit log to parse
     /// @return Commit object
     [[nodiscard]] static auto parseCommit_PrettyFormat(const std::string_view commitLog) -> Commit;
 
+    /// @brief Split raw commit message into message (the first paragraph) and description (everything after empty lines following it)
+    /// @param rawMessage Raw commit message without the trailing new line
+    /// @return Message and description
+    [[nodiscard]] static auto splitRawMessage(const std::string_view rawMessage) -> std::pair<std::string_view, std::string_view>;
+
+    /// @brief Create commit from fields of a commit log record
+    /// @param record Fields of the record
+    /// @return Commit object
+    /// @throws std::runtime_error If a hash or a date can't be parsed
+    [[nodiscard]] static auto createCommit(const CommitLogRecord& record) -> Commit;
+
     /// @brief Parse a commit log from the git rev-list command
+    ///     Dates are stored as Timestamp, so only %ad and %cd are accepted and they have to be in raw format (--date=raw)
     /// @param commitLog Commit log to parse
     /// @param format Format to use when parsing the commit log
     /// @param delimiter Delimiter to use when parsing the commit log
     /// @return Commit object
+    /// @throws std::runtime_error If a hash or a date can't be parsed, or the format has other date placeholder
     [[nodiscard]] static auto parseCommit_PrettyFormat(const std::string_view commitLog, const std::string_view format, const std::string_view delimiter) -> Commit;
 
+    /// @brief Parse a full or abbreviated hash of a commit field
+    /// @param hash Hash to parse
+    /// @return Object id, empty if the hash is empty
+    /// @throws std::runtime_error If the hash isn't empty and isn't a hex string
+    [[nodiscard]] static auto parseHash(const std::string_view hash) -> ObjectId;
+
+    /// @brief Parse a date of a commit field
+    /// @param date Date in git raw format
+    /// @return Timestamp, std::nullopt if the date is empty
+    /// @throws std::runtime_error If the date isn't empty and isn't in raw format
+    [[nodiscard]] static auto parseDate(const std::string_view date) -> std::optional<Timestamp>;
+
 private:
+    struct SignatureLine
+    {
+        std::string_view name;
+        std::string_view email;
+        std::string_view date;
+    };
+
+    static auto parseCommitObject(const ObjectId& hash, const std::string_view content) -> Commit;
+    static auto parseSignatureLine(const std::string_view value) -> SignatureLine;
+    static auto getNextLine(std::string_view& text) -> std::string_view;
+    static auto parseDateToken(const std::string_view formatToken, const std::string_view commitToken) -> std::optional<Timestamp>;
+
     static auto isHashToken(const std::string_view token) -> bool;
     static auto isParentsToken(const std::string_view token) -> bool;
     static auto isAuthorNameToken(const std::string_view token) -> bool;
@@ -0,0 +1,37 @@
+#pragma once
+
+#include "Parser.hpp"
+
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace CppGit {
+
+/// @brief Entry of the git config file
+struct ConfigFileEntry
+{
+    std::string key;                  ///< Key in the canonical form <section>[.<subsection>].<name>, section and name are lowercased
+    std::optional<std::string> value; ///< Value or std::nullopt if the key has no value (implicit true)
+};
+
+/// @brief Provides internal functionality to parse git config files
+class ConfigParser final : protected Parser
+{
+public:
+    /// @brief Parse git config file content
+    ///     Supports sections with subsections (also deprecated [section.subsection] form), quoted values,
+    ///     escape sequences, line continuations and comments, the same way as git does. Includes are returned as regular entries.
+    /// @param configContent Config file content
+    /// @return Entries in the order they appear in the file
+    /// @throws std::runtime_error If the content is not a valid config
+    [[nodiscard]] static auto parseConfigFile(const std::string_view configContent) -> std::vector<ConfigFileEntry>;
+
+    /// @brief Transform key to the canonical form (lowercased section and name, subsection stays as it is)
+    /// @param key Config key
+    /// @return Key in the canonical form
+    [[nodiscard]] static auto normalizeKey(const std::string_view key) -> std::string;
+};
+
+} // namespace CppGit
@@ -4,6 +4,9 @@
 #include "Parser.hpp"
 
 #include <cstdint>
+#include <functional>
+#include <string>
+#include <string_view>
 #include <tuple>
 #include <utility>
 #include <variant>
@@ -12,21 +15,38 @@
 namespace CppGit {
 
 /// @brief Provides internal functionality to parse diff content
+///     Content can be fed in chunks cut at any place. Lines are parsed as soon as they are complete and every diff file
+///     is passed to the consumer once the next one begins (or the input ends), so only the unfinished line
+///     and the current diff file are kept in memory.
 class DiffParser final : protected Parser
 {
 public:
-    /// @brief Parse the diff content
+    using DiffFileConsumer = std::function<void(DiffFile&&)>;
+
+    DiffParser() = default;
+
+    /// @param diffFileConsumer Consumer of parsed diff files
+    explicit DiffParser(DiffFileConsumer diffFileConsumer);
+
+    /// @brief Parse the whole diff content
     /// @param diffContent Diff content
     /// @return Parsed diff files
     [[nodiscard]] auto parse(const std::string_view diffContent) -> std::vector<DiffFile>;
 
+    /// @brief Feed next chunk of the diff content
+    /// @param chunk Chunk of the diff content
+    auto feed(const std::string_view chunk) -> void;
+
+    /// @brief Parse the last unfinished line and pass the last diff file (if any) to the consumer,
+    ///     should be called after the content has ended
+    auto finish() -> void;
+
 private:
     enum class ParseState : uint8_t
     {
         WAITING_FOR_DIFF,
         HEADER,
         BINARY_FILE,
-        HUNK_FILE_A,
         HUNK_FILE_B,
         HUNK_HEADER,
         HUNK_CONTENT
@@ -53,6 +73,14 @@ private:
         std::variant<int, std::string_view, std::tuple<std::string_view, std::string_view, int>> value;
     };
 
+    /// @brief Header line recognized by its prefix, only if the header line before is of given type
+    struct HeaderLineRule
+    {
+        HeaderLineType typeBefore;
+        std::string_view prefix;
+        HeaderLineType type;
+    };
+
     struct DiffLine
     {
         bool isCombined;
@@ -60,19 +88,28 @@ private:
         std::string_view fileB;
     };
 
+    DiffFileConsumer diffFileConsumer;
     ParseState currentState{ ParseState::WAITING_FOR_DIFF };
+    HeaderLineType lastHeaderLineType{ HeaderLineType::NO_LINE };
+    DiffFile diffFile;
+    std::string unfinishedLine;
+
+    auto parseLine(const std::string_view line) -> void;
+    auto passDiffFile() -> void;
 
     static auto parseHeaderLine(const std::string_view line, const HeaderLineType headerLineBefore) -> HeaderLine;
+    static auto parseHeaderLineValue(const HeaderLineType type, const std::string_view value) -> HeaderLine;
+    static auto parseIndexValue(const std::string_view value) -> std::tuple<std::string_view, std::string_view, int>;
     static auto parseHunkFileLine(const std::string_view line, const std::string_view prefix) -> std::string;
     static auto parseHunkHeader(const std::string_view line) -> std::pair<std::vector<std::pair<int, int>>, std::pair<int, int>>;
-    static auto parseHunkHeaderRange(const std::string_view range) -> std::pair<int, int>;
+    static auto parseHunkHeaderRange(std::string_view range) -> std::pair<int, int>;
     static auto parseDiffLine(const std::string_view line) -> DiffLine;
 
     static auto processHeaderLine(const HeaderLine& headerLine, DiffFile& diffFile) -> void;
 
-    static auto peakNextLine(std::vector<std::string_view>::const_iterator iterator, const std::vector<std::string_view>::const_iterator endIterator) -> std::string_view;
-
     static auto removePrefixFromFileIfStartsWith(std::string_view& file, const std::string_view prefix) -> void;
+    static auto getNextToken(std::string_view& text) -> std::string_view;
+    static auto parseInt(const std::string_view text, const int defaultValue) -> int;
 };
 
 } // namespace CppGit
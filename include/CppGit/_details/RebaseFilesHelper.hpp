@@ -4,8 +4,10 @@
 #include "../Repository.hpp"
 
 #include <optional>
+#include <span>
 #include <string>
 #include <string_view>
+#include <vector>
 
 namespace CppGit::_details {
 
@@ -117,23 +119,22 @@ public:
     /// @param rebaseTodoCommands List of rebase todo commands
     auto generateTodoFile(const std::vector<RebaseTodoCommand>& rebaseTodoCommands) const -> void;
 
-    /// @brief Peek todo file
-    /// @return Next rebase todo command
-    [[nodiscard]] auto peekTodoFile() const -> std::optional<RebaseTodoCommand>;
-
-    /// @brief Pop todo file
-    ///     Remove first line from todo file
-    auto popTodoFile() const -> void;
+    /// @brief Overwrite todo file with the commands
+    /// @param rebaseTodoCommands List of rebase todo commands
+    auto writeTodoFile(const std::span<const RebaseTodoCommand> rebaseTodoCommands) const -> void;
 
-    /// @brief Peek and pop todo file
-    ///     Peek first line from todo file and remove it
-    /// @return Next rebase todo command
-    [[nodiscard]] auto peakAndPopTodoFile() const -> std::optional<RebaseTodoCommand>;
+    /// @brief Read all commands from todo file
+    /// @return List of rebase todo commands
+    [[nodiscard]] auto getTodoFileCommands() const -> std::vector<RebaseTodoCommand>;
 
     /// @brief Append done file
     /// @param rebaseTodoCommand Done rebase todo command
     auto appendDoneFile(const RebaseTodoCommand& rebaseTodoCommand) const -> void;
 
+    /// @brief Append done file with many commands at once
+    /// @param rebaseTodoCommands Done rebase todo commands
+    auto appendDoneFile(const std::span<const RebaseTodoCommand> rebaseTodoCommands) const -> void;
+
     /// @brief Get last done command
     /// @return Last done rebase todo command
     [[nodiscard]] auto getLastDoneCommand() const -> std::optional<RebaseTodoCommand>;
@@ -142,6 +143,8 @@ private:
     const Repository* repository;
 
     static auto parseTodoCommandLine(const std::string_view line) -> std::optional<RebaseTodoCommand>;
+    static auto quoteAuthorScriptValue(const std::string_view value) -> std::string;
+    static auto unquoteAuthorScriptValue(const std::string_view value) -> std::string;
 };
 
 } // namespace CppGit::_details
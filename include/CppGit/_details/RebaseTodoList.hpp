@@ -0,0 +1,48 @@
+#pragma once
+
+#include "../RebaseTodoCommand.hpp"
+
+#include <cstddef>
+#include <optional>
+#include <span>
+#include <vector>
+
+namespace CppGit::_details {
+
+/// @brief Holds rebase todo commands in memory while the rebase is running
+///     Popping a command only moves the cursor, popped commands are the done ones.
+///     Commands popped since the last flush are tracked, so the done file can be appended with them at once.
+class RebaseTodoList
+{
+public:
+    RebaseTodoList() = default;
+
+    /// @param commands Rebase todo commands
+    explicit RebaseTodoList(std::vector<RebaseTodoCommand> commands);
+
+    /// @brief Get next command without removing it
+    /// @return Next rebase todo command, std::nullopt if there are no more commands
+    [[nodiscard]] auto peek() const -> std::optional<RebaseTodoCommand>;
+
+    /// @brief Get next command and move cursor after it
+    /// @return Next rebase todo command, std::nullopt if there are no more commands
+    auto pop() -> std::optional<RebaseTodoCommand>;
+
+    /// @brief Get commands that are not popped yet
+    /// @return Remaining commands
+    [[nodiscard]] auto getRemainingCommands() const -> std::span<const RebaseTodoCommand>;
+
+    /// @brief Get commands popped since the last flush
+    /// @return Done commands that are not flushed yet
+    [[nodiscard]] auto getNotFlushedDoneCommands() const -> std::span<const RebaseTodoCommand>;
+
+    /// @brief Mark all popped commands as flushed
+    auto markFlushed() -> void;
+
+private:
+    std::vector<RebaseTodoCommand> commands;
+    std::size_t cursor{ 0 };
+    std::size_t flushedCount{ 0 };
+};
+
+} // namespace CppGit::_details
@@ -0,0 +1,86 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <string>
+#include <string_view>
+
+namespace CppGit::_details {
+
+/// @brief Status of the reference lookup
+enum class ReferenceLookupStatus : uint8_t
+{
+    FOUND,      ///< Reference has been found
+    NOT_FOUND,  ///< Reference doesn't exist
+    UNSUPPORTED ///< Reference can't be read natively (e.g. reftable, unusual name or unparsable file), git has to be asked
+};
+
+/// @brief Result of the reference lookup
+struct ReferenceLookup
+{
+    ReferenceLookupStatus status; ///< Status of the lookup
+    std::string value;            ///< Object hash or reference name, depending on the lookup, empty if not found
+};
+
+/// @brief Provides internal functionality to read references without running git
+///     Reads loose refs and symbolic refs from the files and looks up packed-refs, which is memory-mapped
+///     on first use and binary searched if it's sorted. Repositories using reftable are not supported.
+class ReferencesReader
+{
+public:
+    /// @param gitDirectoryPath Path to the git directory, which contains HEAD and other worktree specific refs
+    /// @param commonDirectoryPath Path to the git directory shared by all worktrees, which contains branches, tags and packed-refs
+    ReferencesReader(std::filesystem::path gitDirectoryPath, std::filesystem::path commonDirectoryPath);
+    ReferencesReader() = delete;
+    ReferencesReader(const ReferencesReader&) = delete;
+    ReferencesReader(ReferencesReader&&) = delete;
+    auto operator=(const ReferencesReader&) -> ReferencesReader& = delete;
+    auto operator=(ReferencesReader&&) -> ReferencesReader& = delete;
+    ~ReferencesReader();
+
+    /// @brief Resolve full reference name (e.g. HEAD, refs/heads/main) to the object hash, following symbolic refs
+    /// @param refName Full reference name
+    /// @return Lookup with object hash as value
+    [[nodiscard]] auto resolveRef(const std::string_view refName) -> ReferenceLookup;
+
+    /// @brief Resolve short reference name (e.g. main, origin/main) to the object hash, the same way as git does
+    ///     Full object hash is returned as it is
+    /// @param name Short or full reference name
+    /// @return Lookup with object hash as value
+    [[nodiscard]] auto resolveShortRef(const std::string_view name) -> ReferenceLookup;
+
+    /// @brief Get the reference name which symbolic reference points to, following chains of symbolic refs
+    /// @param refName Full reference name
+    /// @return Lookup with reference name as value, NOT_FOUND if reference is not symbolic
+    [[nodiscard]] auto resolveSymbolicRef(const std::string_view refName) -> ReferenceLookup;
+
+private:
+    enum class LooseRefType : uint8_t
+    {
+        MISSING,
+        HASH,
+        SYMBOLIC,
+        BROKEN
+    };
+
+    std::filesystem::path gitDirectoryPath;
+    std::filesystem::path commonDirectoryPath;
+    bool supported{ false };
+
+    bool packedRefsLoaded{ false };
+    bool packedRefsValid{ false };
+    bool packedRefsSorted{ false };
+    const char* packedRefsData{ nullptr };
+    std::size_t packedRefsSize{ 0 };
+    std::size_t packedRefsRecordsStart{ 0 };
+
+    auto readLooseRef(const std::string_view refName, std::string& value) const -> LooseRefType;
+
+    auto loadPackedRefs() -> void;
+    auto findPackedRef(const std::string_view refName) -> ReferenceLookup;
+    auto getPackedRecordStart(std::size_t position) const -> std::size_t;
+    auto getPackedRecordEnd(std::size_t position) const -> std::size_t;
+};
+
+} // namespace CppGit::_details
@@ -0,0 +1,32 @@
+#pragma once
+
+#include <filesystem>
+#include <optional>
+#include <string>
+
+namespace CppGit::_details {
+
+/// @brief Location and format of the repository
+struct RepositoryContext
+{
+    std::filesystem::path topLevelPath;        ///< Top level directory of the working tree, empty if there is no working tree (e.g. bare repository)
+    std::filesystem::path gitDirectoryPath;    ///< Git directory (.git, or .git/worktrees/<name> for linked worktree)
+    std::filesystem::path commonDirectoryPath; ///< Git directory shared by all worktrees, which contains objects, refs and config
+    std::string objectFormat;                  ///< Hash algorithm of the repository (sha1 or sha256)
+    bool bare;                                 ///< Whether the repository is bare
+};
+
+/// @brief Discover repository containing the path without running git
+///     Walks up from the path looking for .git directory or .git file (linked worktrees, submodules) or for bare git directory,
+///     stopping at GIT_CEILING_DIRECTORIES and at the filesystem boundary (unless GIT_DISCOVERY_ACROSS_FILESYSTEM is set) like git does.
+/// @param path Path inside the repository
+/// @return Repository context or std::nullopt if no repository has been found or location is affected by something
+///     that only git handles (GIT_DIR and similar environment variables, core.worktree, config includes, per-worktree config)
+[[nodiscard]] auto discoverRepositoryContext(const std::filesystem::path& path) -> std::optional<RepositoryContext>;
+
+/// @brief Check whether the repository described by the context still exists
+/// @param context Repository context
+/// @return True if the git directory and the working tree still exist, false otherwise
+[[nodiscard]] auto isRepositoryContextValid(const RepositoryContext& context) -> bool;
+
+} // namespace CppGit::_details
@@ -0,0 +1,23 @@
+#pragma once
+
+#include "../Signature.hpp"
+
+#include <string_view>
+
+namespace CppGit::_details {
+
+/// @brief Provides internal functionality to share signatures between commits
+///     Repositories have much less authors than commits, so every distinct signature is stored only once
+///     and commits keep just a pointer to it. Signatures live until the end of the program.
+class SignaturePool
+{
+public:
+    /// @brief Get the signature with given name and email, adding it to the pool if it isn't there yet
+    ///     Safe to call from multiple threads
+    /// @param name Name of the author or committer
+    /// @param email Email of the author or committer
+    /// @return Signature, the same object for the same name and email
+    [[nodiscard]] static auto intern(const std::string_view name, const std::string_view email) -> const Signature&;
+};
+
+} // namespace CppGit::_details
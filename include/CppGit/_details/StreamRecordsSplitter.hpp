@@ -0,0 +1,41 @@
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <string>
+#include <string_view>
+
+namespace CppGit::_details {
+
+/// @brief Provides internal functionality to split streamed output into complete records
+///     Chunks can be cut at any place, records are passed to the consumer only once they are complete,
+///     so only the last unfinished record has to be kept in memory.
+class StreamRecordsSplitter
+{
+public:
+    using RecordConsumer = std::function<void(std::string_view)>;
+
+    /// @param separator Separator between records
+    /// @param separatorTailLength Number of last separator's characters which belong to the next record
+    ///     (e.g. separator "\ndiff " with tail 5 splits diff output into files, keeping "diff " in each record)
+    /// @param recordConsumer Consumer of complete records
+    StreamRecordsSplitter(std::string separator, const std::size_t separatorTailLength, RecordConsumer recordConsumer);
+
+    /// @brief Feed next chunk of the stream
+    /// @param chunk Chunk of the stream
+    auto feed(const std::string_view chunk) -> void;
+
+    /// @brief Pass the last record (if any) to the consumer, should be called after the stream has ended
+    auto finish() -> void;
+
+private:
+    std::string separator;
+    std::size_t separatorTailLength;
+    RecordConsumer recordConsumer;
+
+    std::string buffer;
+    std::size_t recordStart{ 0 };
+    std::size_t searchFrom{ 0 };
+};
+
+} // namespace CppGit::_details
@@ -3,6 +3,8 @@
 #include "../IndexManager.hpp"
 #include "../Repository.hpp"
 
+#include <cstddef>
+#include <filesystem>
 #include <string>
 #include <string_view>
 #include <unordered_map>
@@ -19,6 +21,17 @@ class ThreeWayMerger
         std::string baseBlob;   ///< Merge base, the common ancestor
         std::string targetBlob; ///< Ours, the branch we are merging onto
         std::string sourceBlob; ///< Theirs, the branch we are merging from
+        int targetFileMode{};   ///< File mode of ours, the merged file gets it
+    };
+
+    /// @brief Contains contents of an unmerged file, read before merging
+    struct FileToMerge
+    {
+        std::filesystem::path path; ///< Path of the file in the worktree
+        std::string baseContent;    ///< Content of the merge base
+        std::string targetContent;  ///< Content of ours
+        std::string sourceContent;  ///< Content of theirs
+        int targetFileMode;         ///< File mode of ours
     };
 
 
@@ -28,6 +41,9 @@ public:
     ThreeWayMerger() = delete;
 
     /// @brief Perform a three-way merge on conflicted files
+    ///     Blobs are read through the repository's object reader, merged in-process and every file is written once.
+    ///     Files are merged in parallel when there are many of them. When merge.conflictStyle is other than "merge"
+    ///     (diff3, zdiff3), files are merged by `git merge-file` instead, so conflicts have the base section.
     /// @param unmergedFilesEntries The entries of the unmerged files
     /// @param sourceLabel The label for the source branch
     /// @param targetLabel The label for the target branch
@@ -48,7 +64,13 @@ public:
 private:
     const Repository* repository;
 
-    auto unpackFile(const std::string_view fileBlob) const -> std::string;
+    static constexpr auto PARALLEL_MERGE_MIN_FILES = std::size_t{ 8 };
+
+    auto readBlobContent(const std::string_view fileBlob) const -> std::string;
+    static auto mergeAndWriteFile(const FileToMerge& file, const std::string_view sourceLabel, const std::string_view targetLabel) -> void;
+    auto mergeAndWriteFileWithGit(const FileToMerge& file, const std::string_view sourceLabel, const std::string_view targetLabel) const -> void;
+    static auto writeMergedFile(const FileToMerge& file, const std::string_view content) -> void;
+    static auto mergeAndWriteFilesInParallel(const std::vector<FileToMerge>& files, const std::string_view sourceLabel, const std::string_view targetLabel) -> void;
     static auto createUnmergedFileMap(const std::vector<IndexEntry>& unmergedFilesEntries) -> std::unordered_map<std::string, UnmergedFileBlobs>;
 };
 
@@ -0,0 +1,47 @@
+#pragma once
+
+#include "../DiffFile.hpp"
+#include "LineDiff.hpp"
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace CppGit::_details {
+
+/// @brief Provides internal functionality to create diff hunks of two file contents in-process
+///     Hunks are the same as `git diff` prints them (3 lines of context, function names in hunk headers),
+///     stored in DiffFile the same way DiffParser stores them: ranges of the first hunk are parsed,
+///     everything after the first hunk header is kept as content lines.
+class UnifiedDiffBuilder
+{
+public:
+    /// @brief Check whether content is binary, the same way git does (NUL byte in the first 8000 bytes)
+    /// @param content Content to check
+    /// @return True if content is binary, false otherwise
+    [[nodiscard]] static auto isBinary(const std::string_view content) -> bool;
+
+    /// @brief Fill hunks of the diff file with differences of two contents
+    /// @param diffFile Diff file to fill
+    /// @param oldContent Content before the change
+    /// @param newContent Content after the change
+    /// @param algorithm Algorithm to find differences with
+    /// @return True if there are any differences, false otherwise
+    static auto fillHunks(DiffFile& diffFile, const std::string_view oldContent, const std::string_view newContent, const DiffAlgorithm algorithm) -> bool;
+
+private:
+    static constexpr auto CONTEXT_LINES = std::size_t{ 3 };
+    static constexpr auto BINARY_CHECK_SIZE = std::size_t{ 8000 };
+    static constexpr auto MAX_FUNCTION_NAME_SIZE = std::size_t{ 80 };
+    static constexpr auto NO_NEW_LINE_MARKER = "\\ No newline at end of file";
+
+    static auto getLastChangeOfHunk(const std::vector<LineDiffChange>& changes, std::size_t firstChangeIndex) -> std::size_t;
+    static auto findFunctionName(const std::vector<std::string_view>& oldLines, std::size_t start, const std::size_t limit, std::string& functionName) -> void;
+    static auto createHunkHeader(const std::size_t oldStart, const std::size_t oldCount, const std::size_t newStart, const std::size_t newCount, const std::string_view functionName) -> std::string;
+    static auto getHunkRange(const std::size_t start, const std::size_t count) -> std::pair<int, int>;
+    static auto appendLine(std::vector<std::string>& hunkContent, const char prefix, std::string_view line) -> void;
+};
+
+} // namespace CppGit::_details
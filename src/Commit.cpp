@@ -1,59 +1,89 @@
 #include "CppGit/Commit.hpp"
 
+#include "CppGit/ObjectId.hpp"
 #include "CppGit/Signature.hpp"
+#include "CppGit/Timestamp.hpp"
+#include "CppGit/_details/Parser/CommitParser.hpp"
+#include "CppGit/_details/SignaturePool.hpp"
 
+#include <algorithm>
+#include <iterator>
+#include <optional>
 #include <string>
 #include <utility>
 #include <vector>
+
 namespace CppGit {
 
+namespace {
+
+auto toObjectIds(const std::vector<std::string>& hashes) -> std::vector<ObjectId>
+{
+    auto objectIds = std::vector<ObjectId>{};
+    objectIds.reserve(hashes.size());
+    std::ranges::transform(hashes, std::back_inserter(objectIds), [](const auto& hash) { return CommitParser::parseHash(hash); });
+
+    return objectIds;
+}
+
+} // namespace
+
 Commit::Commit(std::string hash, std::vector<std::string> parents, Signature author, std::string authorDate, Signature committer, std::string committerDate, std::string message, std::string description, std::string treeHash)
-    : hash{ std::move(hash) },
-      authorDate{ std::move(authorDate) },
-      committerDate{ std::move(committerDate) },
-      message{ std::move(message) },
-      description{ std::move(description) },
-      treeHash{ std::move(treeHash) },
-      author{ std::move(author) },
-      committer{ std::move(committer) },
-      parents{ std::move(parents) }
+    : Commit{ CommitParser::parseHash(hash), toObjectIds(parents), _details::SignaturePool::intern(author.name, author.email), CommitParser::parseDate(authorDate), _details::SignaturePool::intern(committer.name, committer.email), CommitParser::parseDate(committerDate), std::move(message), std::move(description), CommitParser::parseHash(treeHash) }
 {
 }
 
 Commit::Commit(std::string hash, std::vector<std::string> parents, std::string authorName, std::string authorEmail, std::string authorDate, std::string committerName, std::string committerEmail, std::string committerDate, std::string message, std::string description, std::string treeHash)
-    : Commit{ std::move(hash), std::move(parents), Signature(std::move(authorName), std::move(authorEmail)), std::move(authorDate), Signature(std::move(committerName), std::move(committerEmail)), std::move(committerDate), std::move(message), std::move(description), std::move(treeHash) }
+    : Commit{ CommitParser::parseHash(hash), toObjectIds(parents), _details::SignaturePool::intern(authorName, authorEmail), CommitParser::parseDate(authorDate), _details::SignaturePool::intern(committerName, committerEmail), CommitParser::parseDate(committerDate), std::move(message), std::move(description), CommitParser::parseHash(treeHash) }
+{
+}
+
+Commit::Commit(const ObjectId& hash, std::vector<ObjectId> parents, const Signature& author, const std::optional<Timestamp>& authorDate, const Signature& committer, const std::optional<Timestamp>& committerDate, std::string message, std::string description, const ObjectId& treeHash)
+    : hash{ hash },
+      treeHash{ treeHash },
+      authorDate{ authorDate },
+      committerDate{ committerDate },
+      author{ &author },
+      committer{ &committer },
+      parents{ std::move(parents) },
+      message{ std::move(message) },
+      description{ std::move(description) }
 {
 }
 
 
-auto Commit::getHash() const -> const std::string&
+auto Commit::getHash() const -> std::string
 {
-    return hash;
+    return hash.toHex();
 }
 
-auto Commit::getParents() const -> const std::vector<std::string>&
+auto Commit::getParents() const -> std::vector<std::string>
 {
-    return parents;
+    auto parentHashes = std::vector<std::string>{};
+    parentHashes.reserve(parents.size());
+    std::ranges::transform(parents, std::back_inserter(parentHashes), [](const auto& parent) { return parent.toHex(); });
+
+    return parentHashes;
 }
 
 auto Commit::getAuthor() const -> const Signature&
 {
-    return author;
+    return *author;
 }
 
-auto Commit::getAuthorDate() const -> const std::string&
+auto Commit::getAuthorDate() const -> std::string
 {
-    return authorDate;
+    return authorDate ? authorDate->toString() : std::string{};
 }
 
 auto Commit::getCommitter() const -> const Signature&
 {
-    return committer;
+    return *committer;
 }
 
-auto Commit::getCommitterDate() const -> const std::string&
+auto Commit::getCommitterDate() const -> std::string
 {
-    return committerDate;
+    return committerDate ? committerDate->toString() : std::string{};
 }
 
 auto Commit::getMessage() const -> const std::string&
@@ -76,9 +106,34 @@ auto Commit::getMessageAndDescription() const -> std::string
     return message + "\n\n" + description;
 }
 
-auto Commit::getTreeHash() const -> const std::string&
+auto Commit::getTreeHash() const -> std::string
+{
+    return treeHash.toHex();
+}
+
+auto Commit::getId() const -> const ObjectId&
+{
+    return hash;
+}
+
+auto Commit::getParentIds() const -> const std::vector<ObjectId>&
+{
+    return parents;
+}
+
+auto Commit::getTreeId() const -> const ObjectId&
 {
     return treeHash;
 }
 
+auto Commit::getAuthorTimestamp() const -> const std::optional<Timestamp>&
+{
+    return authorDate;
+}
+
+auto Commit::getCommitterTimestamp() const -> const std::optional<Timestamp>&
+{
+    return committerDate;
+}
+
 } // namespace CppGit
@@ -2,9 +2,12 @@
 
 #include "CppGit/Commit.hpp"
 #include "CppGit/Repository.hpp"
-#include "CppGit/_details/Parser/CommitParser.hpp"
+#include "CppGit/_details/CommitCache.hpp"
+#include "CppGit/_details/Parser/CommitLogFormat.hpp"
 #include "CppGit/_details/Parser/Parser.hpp"
+#include "CppGit/_details/StreamRecordsSplitter.hpp"
 
+#include <cstddef>
 #include <format>
 #include <string>
 #include <string_view>
@@ -12,6 +15,14 @@
 #include <vector>
 
 namespace CppGit {
+
+namespace {
+
+// Only the newest commits of a log are likely to be asked for again, long logs would just evict the whole cache
+constexpr auto MAX_CACHED_LOG_COMMITS = std::size_t{ 64 };
+
+} // namespace
+
 CommitsLogManager::CommitsLogManager(const Repository& repository)
     : repository{ &repository }
 {
@@ -204,25 +215,32 @@ auto CommitsLogManager::getCommitsLogHashesOnlyImpl(const std::string_view fromR
 auto CommitsLogManager::getCommitsLogDetailedImpl(const std::string_view fromRef, const std::string_view toRef) const -> std::vector<Commit>
 {
     auto arguments = prepareCommandsArgument(fromRef, toRef);
-    auto formatString = std::string{ "--pretty=" } + CommitParser::COMMIT_LOG_DEFAULT_FORMAT + "$:>";
+    auto formatString = std::string{ "--pretty=" } + std::string{ DetailedCommitLogFormat::getPrettyFormat() } + "$:>";
     arguments.push_back(std::move(formatString));
     arguments.emplace_back("--no-commit-header");
     arguments.emplace_back("--date=raw");
 
-    auto output = repository->executeGitCommand("rev-list", std::move(arguments));
-
+    // Commits are parsed the same way as commit objects, so the first of them are added to the cache shared with CommitsManager
+    auto& commitCache = repository->getCommitCache();
     auto commits = std::vector<Commit>();
-    output.stdout.erase(output.stdout.size() - 3); // remove $:> from last line
-    const auto commitsSplitted = Parser::splitToStringViewsVector(output.stdout, "$:>\n");
-
-    for (const auto commitLog : commitsSplitted)
-    {
-        if (commitLog.empty())
-        {
-            continue;
-        }
-        commits.emplace_back(CommitParser::parseCommit_PrettyFormat(commitLog));
-    }
+    auto recordsSplitter = _details::StreamRecordsSplitter{ "$:>\n", 0, [&commits, &commitCache](std::string_view commitLog) {
+                                                               if (commitLog.ends_with("$:>"))
+                                                               {
+                                                                   commitLog.remove_suffix(3); // last record might miss the new line
+                                                               }
+                                                               if (!commitLog.empty())
+                                                               {
+                                                                   commits.push_back(DetailedCommitLogFormat::parse(commitLog));
+                                                                   if (commits.size() <= MAX_CACHED_LOG_COMMITS)
+                                                                   {
+                                                                       commitCache.insert(commits.back());
+                                                                   }
+                                                               }
+                                                           } };
+
+    // Parse commits as soon as they arrive, so we don't keep whole log in memory besides parsed commits
+    repository->executeGitCommandStreaming([&recordsSplitter](const std::string_view chunk) { recordsSplitter.feed(chunk); }, "rev-list", std::move(arguments));
+    recordsSplitter.finish();
 
     return commits;
 }
@@ -1,8 +1,10 @@
 #include "CppGit/CommitsManager.hpp"
 
 #include "CppGit/Commit.hpp"
+#include "CppGit/ObjectId.hpp"
 #include "CppGit/Repository.hpp"
 #include "CppGit/_details/CommitAmender.hpp"
+#include "CppGit/_details/CommitCache.hpp"
 #include "CppGit/_details/CommitCreator.hpp"
 #include "CppGit/_details/GitCommandExecutor/GitCommandOutput.hpp"
 #include "CppGit/_details/GitFilesHelper.hpp"
@@ -11,6 +13,7 @@
 
 #include <string>
 #include <string_view>
+#include <utility>
 #include <vector>
 
 namespace CppGit {
@@ -62,9 +65,35 @@ auto CommitsManager::getHeadCommitHash() const -> std::string
 
 auto CommitsManager::getCommitInfo(const std::string_view commitHash) const -> Commit
 {
-    const auto output = repository->executeGitCommand("cat-file", "-p", commitHash);
-    auto parsedCommit = CommitParser::parseCommit_CatFile(output.stdout);
-    parsedCommit.hash = std::string{ commitHash };
+    auto& commitCache = repository->getCommitCache();
+
+    // Only full hashes can be looked up, other names (refs, abbreviated hashes) have to be resolved by git first
+    if (const auto commitId = ObjectId::fromHex(commitHash); commitId.getHexSize() == ObjectId::SHA1_SIZE * 2 || commitId.getHexSize() == ObjectId::SHA256_SIZE * 2)
+    {
+        if (auto cachedCommit = commitCache.get(commitId))
+        {
+            return std::move(*cachedCommit);
+        }
+    }
+
+    auto object = repository->readObject(commitHash);
+
+    if (!object || object->type != "commit")
+    {
+        auto parsedCommit = CommitParser::parseCommit_CatFile("");
+        parsedCommit.hash = ObjectId::fromHex(commitHash);
+        return parsedCommit;
+    }
+
+    auto& content = object->content;
+    if (content.ends_with('\n'))
+    {
+        content.pop_back();
+    }
+
+    auto parsedCommit = CommitParser::parseCommit_CatFile(content);
+    parsedCommit.hash = ObjectId::fromHex(object->hash);
+    commitCache.insert(parsedCommit);
 
     return parsedCommit;
 }
@@ -2,10 +2,17 @@
 
 #include "CppGit/DiffFile.hpp"
 #include "CppGit/Repository.hpp"
-#include "CppGit/_details/GitCommandExecutor/GitCommandOutput.hpp"
+#include "CppGit/_details/FileUtility.hpp"
 #include "CppGit/_details/Parser/DiffParser.hpp"
+#include "CppGit/_details/UnifiedDiffBuilder.hpp"
 
+#include <algorithm>
 #include <filesystem>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <utility>
 #include <vector>
 
 namespace CppGit {
@@ -23,16 +30,17 @@ auto DiffGenerator::getDiff() const -> std::vector<DiffFile>
 auto DiffGenerator::getDiff(const std::string_view commitHash) const -> std::vector<DiffFile>
 {
     // git diff-tree -p --no-commit-id HEAD --full-index -- test2.txt
-    const auto output = repository->executeGitCommand("diff-tree", "-p", "--no-commit-id", commitHash, "--full-index");
-
-    return getDiffFilesFromOutput(output);
+    return getDiffFilesStreaming("diff-tree", "-p", "--no-commit-id", commitHash, "--full-index");
 }
 
 auto DiffGenerator::getDiff(const std::string_view commitHashA, const std::string_view commitHashB) const -> std::vector<DiffFile>
 {
-    const auto output = repository->executeGitCommand("diff-tree", "-p", "--no-commit-id", commitHashA, commitHashB, "--full-index");
+    return getDiffFilesStreaming("diff-tree", "-p", "--no-commit-id", commitHashA, commitHashB, "--full-index");
+}
 
-    return getDiffFilesFromOutput(output);
+auto DiffGenerator::getDiff(const std::string_view commitHashA, const std::string_view commitHashB, const DiffFileConsumer& diffFileConsumer) const -> void
+{
+    parseDiffStreaming(diffFileConsumer, "diff-tree", "-p", "--no-commit-id", commitHashA, commitHashB, "--full-index");
 }
 
 auto DiffGenerator::getDiffFile(const std::filesystem::path& path) const -> std::vector<DiffFile>
@@ -42,21 +50,117 @@ auto DiffGenerator::getDiffFile(const std::filesystem::path& path) const -> std:
 
 auto DiffGenerator::getDiffFile(const std::string_view commitHash, const std::filesystem::path& path) const -> std::vector<DiffFile>
 {
-    const auto output = repository->executeGitCommand("diff-tree", "-p", "--no-commit-id", commitHash, "--full-index", "--", path.string());
-
-    return getDiffFilesFromOutput(output);
+    return getDiffFilesStreaming("diff-tree", "-p", "--no-commit-id", commitHash, "--full-index", "--", path.string());
 }
 
 auto DiffGenerator::getDiffFile(const std::string_view commitHashA, const std::string_view commitHashB, const std::filesystem::path& path) const -> std::vector<DiffFile>
 {
-    const auto output = repository->executeGitCommand("diff-tree", "-p", "--no-commit-id", commitHashA, commitHashB, "--full-index", "--", path.string());
+    return getDiffFilesStreaming("diff-tree", "-p", "--no-commit-id", commitHashA, commitHashB, "--full-index", "--", path.string());
+}
+
+auto DiffGenerator::getContentsDiff(const std::string_view oldContent, const std::string_view newContent, const DiffAlgorithm algorithm) const -> std::vector<DiffFile>
+{
+    return createContentsDiff(DiffFile{}, oldContent, newContent, algorithm);
+}
+
+auto DiffGenerator::getBlobsDiff(const std::string_view oldBlobHash, const std::string_view newBlobHash, const DiffAlgorithm algorithm) const -> std::vector<DiffFile>
+{
+    const auto oldBlob = readBlob(oldBlobHash);
+    const auto newBlob = readBlob(newBlobHash);
+
+    auto diffFile = DiffFile{};
+    diffFile.fileA = oldBlob.hash;
+    diffFile.fileB = newBlob.hash;
+    diffFile.indicesBefore = { oldBlob.hash };
+    diffFile.indexAfter = newBlob.hash;
 
-    return getDiffFilesFromOutput(output);
+    return createContentsDiff(std::move(diffFile), oldBlob.content, newBlob.content, algorithm);
 }
 
-auto DiffGenerator::getDiffFilesFromOutput(const GitCommandOutput& output) -> std::vector<DiffFile>
+auto DiffGenerator::getBlobWorktreeFileDiff(const std::string_view blobHash, const std::filesystem::path& path, const DiffAlgorithm algorithm) const -> std::vector<DiffFile>
 {
-    auto diffParser = DiffParser{};
-    return diffParser.parse(output.stdout);
+    const auto topLevelPath = repository->getTopLevelPath();
+    if (topLevelPath.empty())
+    {
+        throw std::runtime_error("Repository has no worktree");
+    }
+
+    const auto blob = readBlob(blobHash);
+    const auto filePath = topLevelPath / path;
+
+    auto diffFile = DiffFile{};
+    diffFile.fileA = path.string();
+    diffFile.fileB = path.string();
+    diffFile.indicesBefore = { blob.hash };
+
+    if (!std::filesystem::exists(filePath))
+    {
+        diffFile.fileB = "/dev/null";
+        auto diffFiles = createContentsDiff(std::move(diffFile), blob.content, "", algorithm);
+        for (auto& deletedFile : diffFiles)
+        {
+            deletedFile.diffStatus = (deletedFile.diffStatus == DiffStatus::BINARY_CHANGED ? DiffStatus::BINARY_CHANGED : DiffStatus::DELETED);
+        }
+
+        return diffFiles;
+    }
+
+    // Worktree content isn't hashed, so the index after the change is left empty
+    const auto fileContent = _details::FileUtility::readFile(filePath);
+
+    return createContentsDiff(std::move(diffFile), blob.content, fileContent, algorithm);
+}
+
+auto DiffGenerator::readBlob(const std::string_view blobHash) const -> GitObject
+{
+    auto blob = repository->readObject(blobHash);
+    if (!blob || blob->type != "blob")
+    {
+        throw std::runtime_error("Blob not found: " + std::string{ blobHash });
+    }
+
+    return std::move(*blob);
+}
+
+auto DiffGenerator::createContentsDiff(DiffFile diffFile, const std::string_view oldContent, const std::string_view newContent, const DiffAlgorithm algorithm) -> std::vector<DiffFile>
+{
+    if (oldContent == newContent)
+    {
+        return {};
+    }
+
+    if (_details::UnifiedDiffBuilder::isBinary(oldContent) || _details::UnifiedDiffBuilder::isBinary(newContent))
+    {
+        diffFile.diffStatus = DiffStatus::BINARY_CHANGED;
+    }
+    else
+    {
+        diffFile.diffStatus = DiffStatus::MODDIFIED;
+        _details::UnifiedDiffBuilder::fillHunks(diffFile, oldContent, newContent, algorithm);
+    }
+
+    auto diffFiles = std::vector<DiffFile>{};
+    diffFiles.push_back(std::move(diffFile));
+
+    return diffFiles;
+}
+
+template <typename... Args>
+auto DiffGenerator::getDiffFilesStreaming(const std::string_view command, Args&&... args) const -> std::vector<DiffFile>
+{
+    auto diffFiles = std::vector<DiffFile>{};
+    parseDiffStreaming([&diffFiles](DiffFile&& diffFile) { diffFiles.push_back(std::move(diffFile)); }, command, std::forward<Args>(args)...);
+
+    return diffFiles;
+}
+
+template <typename... Args>
+auto DiffGenerator::parseDiffStreaming(const DiffFileConsumer& diffFileConsumer, const std::string_view command, Args&&... args) const -> void
+{
+    // Output is parsed as it arrives, every file's diff is passed on as soon as the next one begins
+    auto diffParser = DiffParser{ diffFileConsumer };
+
+    repository->executeGitCommandStreaming([&diffParser](const std::string_view chunk) { diffParser.feed(chunk); }, command, std::forward<Args>(args)...);
+    diffParser.finish();
 }
 } // namespace CppGit
@@ -0,0 +1,206 @@
+#include "CppGit/GitConfigSnapshot.hpp"
+
+#include "CppGit/_details/Parser/ConfigParser.hpp"
+
+#include <algorithm>
+#include <cctype>
+#include <charconv>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <limits>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <sys/stat.h>
+#include <utility>
+#include <vector>
+
+namespace CppGit {
+
+namespace {
+
+auto equalsIgnoreCase(const std::string_view lhs, const std::string_view rhs) -> bool
+{
+    return std::ranges::equal(lhs, rhs, [](const unsigned char lhsChar, const unsigned char rhsChar) { return std::tolower(lhsChar) == std::tolower(rhsChar); });
+}
+
+auto parseInt(const std::string_view key, const std::string_view value) -> std::optional<std::int64_t>
+{
+    auto number = std::int64_t{ 0 };
+    const auto* const begin = value.data() + (value.starts_with('+') ? 1 : 0);
+    const auto* const end = value.data() + value.size();
+    const auto [numberEnd, errorCode] = std::from_chars(begin, end, number);
+    if (errorCode != std::errc{} || begin == end)
+    {
+        return std::nullopt;
+    }
+
+    const auto unit = std::string_view{ numberEnd, static_cast<std::size_t>(end - numberEnd) };
+    auto factor = std::int64_t{ 1 };
+    if (equalsIgnoreCase(unit, "k"))
+    {
+        factor = std::int64_t{ 1 } << 10;
+    }
+    else if (equalsIgnoreCase(unit, "m"))
+    {
+        factor = std::int64_t{ 1 } << 20;
+    }
+    else if (equalsIgnoreCase(unit, "g"))
+    {
+        factor = std::int64_t{ 1 } << 30;
+    }
+    else if (!unit.empty())
+    {
+        throw std::runtime_error("Invalid integer config value for " + std::string{ key });
+    }
+
+    if (number > std::numeric_limits<std::int64_t>::max() / factor || number < std::numeric_limits<std::int64_t>::min() / factor)
+    {
+        throw std::runtime_error("Integer config value out of range for " + std::string{ key });
+    }
+
+    return number * factor;
+}
+
+} // namespace
+
+GitConfigSnapshot::GitConfigSnapshot(std::vector<GitConfigSnapshotEntry> entries, std::vector<GitConfigFileStamp> fileStamps)
+    : entries{ std::move(entries) },
+      fileStamps{ std::move(fileStamps) }
+{
+    for (auto i = std::size_t{ 0 }; i < this->entries.size(); ++i)
+    {
+        entriesIndex[this->entries[i].key].push_back(i);
+    }
+}
+
+auto GitConfigSnapshot::getEntries() const -> const std::vector<GitConfigSnapshotEntry>&
+{
+    return entries;
+}
+
+auto GitConfigSnapshot::hasKey(const std::string_view key) const -> bool
+{
+    return getLastEntry(key) != nullptr;
+}
+
+auto GitConfigSnapshot::getString(const std::string_view key) const -> std::optional<std::string>
+{
+    const auto* const entry = getLastEntry(key);
+    if (entry == nullptr)
+    {
+        return std::nullopt;
+    }
+
+    return entry->value.value_or("");
+}
+
+auto GitConfigSnapshot::getAll(const std::string_view key) const -> std::vector<std::string>
+{
+    const auto indexIt = entriesIndex.find(ConfigParser::normalizeKey(key));
+    if (indexIt == entriesIndex.end())
+    {
+        return {};
+    }
+
+    auto values = std::vector<std::string>{};
+    values.reserve(indexIt->second.size());
+    for (const auto entryIndex : indexIt->second)
+    {
+        values.push_back(entries[entryIndex].value.value_or(""));
+    }
+
+    return values;
+}
+
+auto GitConfigSnapshot::getBool(const std::string_view key) const -> std::optional<bool>
+{
+    const auto* const entry = getLastEntry(key);
+    if (entry == nullptr)
+    {
+        return std::nullopt;
+    }
+
+    return parseBool(key, entry->value);
+}
+
+auto GitConfigSnapshot::parseBool(const std::string_view key, const std::optional<std::string>& optionalValue) -> bool
+{
+    if (!optionalValue)
+    {
+        return true;
+    }
+
+    const auto& value = *optionalValue;
+    if (equalsIgnoreCase(value, "true") || equalsIgnoreCase(value, "yes") || equalsIgnoreCase(value, "on"))
+    {
+        return true;
+    }
+
+    if (value.empty() || equalsIgnoreCase(value, "false") || equalsIgnoreCase(value, "no") || equalsIgnoreCase(value, "off"))
+    {
+        return false;
+    }
+
+    if (const auto number = parseInt(key, value); number)
+    {
+        return *number != 0;
+    }
+
+    throw std::runtime_error("Invalid boolean config value for " + std::string{ key });
+}
+
+auto GitConfigSnapshot::getInt(const std::string_view key) const -> std::optional<std::int64_t>
+{
+    const auto* const entry = getLastEntry(key);
+    if (entry == nullptr)
+    {
+        return std::nullopt;
+    }
+
+    const auto number = parseInt(key, entry->value.value_or(""));
+    if (!number)
+    {
+        throw std::runtime_error("Invalid integer config value for " + std::string{ key });
+    }
+
+    return number;
+}
+
+auto GitConfigSnapshot::isUpToDate() const -> bool
+{
+    return std::ranges::all_of(fileStamps, [](const GitConfigFileStamp& fileStamp) {
+        const auto currentStamp = createFileStamp(fileStamp.path);
+        return currentStamp.exists == fileStamp.exists && currentStamp.modificationTime == fileStamp.modificationTime && currentStamp.size == fileStamp.size;
+    });
+}
+
+auto GitConfigSnapshot::createFileStamp(const std::filesystem::path& path) -> GitConfigFileStamp
+{
+    struct stat fileStat{};
+    if (stat(path.c_str(), &fileStat) == -1)
+    {
+        return GitConfigFileStamp{ .path = path, .exists = false, .modificationTime = 0, .size = 0 };
+    }
+
+    constexpr auto NANOSECONDS_IN_SECOND = std::int64_t{ 1'000'000'000 };
+    return GitConfigFileStamp{ .path = path,
+                               .exists = true,
+                               .modificationTime = (static_cast<std::int64_t>(fileStat.st_mtim.tv_sec) * NANOSECONDS_IN_SECOND) + fileStat.st_mtim.tv_nsec,
+                               .size = static_cast<std::uintmax_t>(fileStat.st_size) };
+}
+
+auto GitConfigSnapshot::getLastEntry(const std::string_view key) const -> const GitConfigSnapshotEntry*
+{
+    const auto indexIt = entriesIndex.find(ConfigParser::normalizeKey(key));
+    if (indexIt == entriesIndex.end())
+    {
+        return nullptr;
+    }
+
+    return &entries[indexIt->second.back()];
+}
+
+} // namespace CppGit
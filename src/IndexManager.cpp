@@ -2,115 +2,132 @@
 
 #include "CppGit/CommitsManager.hpp"
 #include "CppGit/Repository.hpp"
+#include "CppGit/_details/IndexFileReader.hpp"
 #include "CppGit/_details/Parser/IndexParser.hpp"
 #include "CppGit/_details/Parser/Parser.hpp"
 
 #include <algorithm>
-#include <iterator>
+#include <cstddef>
+#include <cstdlib>
+#include <filesystem>
+#include <fnmatch.h>
+#include <optional>
 #include <string>
 #include <string_view>
+#include <system_error>
 #include <utility>
 #include <vector>
 
 namespace CppGit {
 
-IndexManager::IndexManager(const Repository& repository)
-    : repository{ &repository }
+namespace {
+
+// Only plain paths and simple globs are matched natively, magic pathspecs and paths outside of the top level directory are left to git
+auto isNativelyMatchablePattern(const std::string_view pattern) -> bool
 {
+    return !pattern.starts_with(':') && !pattern.starts_with('/') && !pattern.contains("..");
 }
 
-auto IndexManager::add(const std::string_view filePattern) const -> void
+auto matchesPattern(std::string_view pattern, const std::string_view path) -> bool
 {
-    auto filesList = getUntrackedAndIndexFilesList(filePattern);
+    if (pattern.empty() || pattern == ".")
+    {
+        return true;
+    }
 
-    if (filesList.empty())
+    if (pattern.ends_with('/'))
     {
-        return;
+        pattern.remove_suffix(1);
     }
 
-    auto args = std::vector<std::string>{};
-    args.reserve(2 + filesList.size()); // --add --remove + num of files
+    if (pattern.find_first_of("*?[\\") == std::string_view::npos)
+    {
+        return path == pattern || (path.starts_with(pattern) && path.size() > pattern.size() && path[pattern.size()] == '/');
+    }
 
-    args.emplace_back("--add");
-    // we do remove also, even method name is `add`, because we want to mimic `git add` behavior
-    // `git add` can also remove deleted files from index
-    args.emplace_back("--remove");
+    return fnmatch(std::string{ pattern }.c_str(), std::string{ path }.c_str(), 0) == 0;
+}
+
+// ls-files C-quotes such paths (depending on core.quotePath), so they are left to git to keep the output the same
+auto requiresQuoting(const std::string_view path) -> bool
+{
+    return std::ranges::any_of(path, [](const char character) {
+        const auto byte = static_cast<unsigned char>(character);
+        return byte < 0x20 || byte >= 0x7F || character == '"' || character == '\\';
+    });
+}
 
-    std::transform(std::make_move_iterator(filesList.begin()),
-                   std::make_move_iterator(filesList.end()),
-                   std::back_inserter(args),
-                   [](auto&& file) {
-                       return std::forward<decltype(file)>(file);
-                   });
+} // namespace
 
-    repository->executeGitCommand("update-index", std::move(args));
+IndexManager::IndexManager(const Repository& repository)
+    : repository{ &repository }
+{
 }
 
-auto IndexManager::remove(const std::string_view filePattern, const bool force) const -> void
+auto IndexManager::add(const std::string_view filePattern) const -> void
 {
-    auto filesList = getFilesInIndexList(filePattern);
+    const auto filesList = getUntrackedAndIndexFilesNulList(filePattern);
 
     if (filesList.empty())
     {
         return;
     }
 
-    auto args = std::vector<std::string>{};
-    args.reserve(1 + filesList.size()); // --remove/--force-remove + num of files
+    // we do remove also, even method name is `add`, because we want to mimic `git add` behavior
+    // `git add` can also remove deleted files from index
+    // paths are streamed through stdin, so there is no limit on the number of files
+    repository->executeGitCommandWithInput(filesList, "update-index", "--add", "--remove", "-z", "--stdin");
+}
 
-    if (force)
-    {
-        args.emplace_back("--force-remove");
-    }
-    else
+auto IndexManager::remove(const std::string_view filePattern, const bool force) const -> void
+{
+    const auto output = repository->executeGitCommand("ls-files", "-z", "--cached", "--", filePattern);
+
+    if (output.stdout.empty())
     {
-        args.emplace_back("--remove");
+        return;
     }
 
-    std::transform(std::make_move_iterator(filesList.begin()),
-                   std::make_move_iterator(filesList.end()),
-                   std::back_inserter(args),
-                   [](auto&& file) {
-                       return std::forward<decltype(file)>(file);
-                   });
-
-    repository->executeGitCommand("update-index", std::move(args));
+    repository->executeGitCommandWithInput(output.stdout, "update-index", (force ? "--force-remove" : "--remove"), "-z", "--stdin");
 }
 
 auto IndexManager::restoreAllStaged() const -> void
 {
-    auto stagedFiles = getStagedFilesListWithStatus();
+    // Raw diff-index contains mode and hash of each staged file in HEAD, which is exactly what has to be put back to the index.
+    // Files added to the index have zero mode in HEAD, which makes update-index remove them.
+    const auto output = repository->executeGitCommand("diff-index", "--cached", "-z", "HEAD");
 
-    if (stagedFiles.empty())
+    if (output.stdout.empty())
     {
         return;
     }
 
-    auto args = std::vector<std::string>{};
-    args.reserve(2 + (3 * stagedFiles.size())); // --force-remove + filesCount + --add  + [(--cache-info + fileInfo) * filesCount] = 2 + 3 * filesCount
-
-    args.emplace_back("--force-remove");
+    auto indexInfo = std::string{};
+    indexInfo.reserve(output.stdout.size());
 
-    for (const auto& file : stagedFiles)
+    // :<HEAD mode> SP <index mode> SP <HEAD hash> SP <index hash> SP <status> NUL <path> NUL
+    const auto rawDiff = std::string_view{ output.stdout };
+    auto position = std::size_t{ 0 };
+    while (position < rawDiff.size())
     {
-        if (file.status == DiffIndexStatus::ADDED)
+        const auto headerEnd = rawDiff.find('\0', position);
+        const auto pathEnd = rawDiff.find('\0', headerEnd + 1);
+        if (headerEnd == std::string_view::npos || pathEnd == std::string_view::npos)
         {
-            args.emplace_back("--force-remove");
-            args.push_back(file.path);
+            break;
         }
-    }
 
-    auto filesInfoInHEADCommit = getHeadFilesHashForGivenFiles(stagedFiles);
+        const auto header = rawDiff.substr(position + 1, headerEnd - position - 1);
+        const auto headMode = header.substr(0, header.find(' '));
+        const auto hashStart = header.find(' ', headMode.size() + 1) + 1;
+        const auto headHash = header.substr(hashStart, header.find(' ', hashStart) - hashStart);
 
-    args.emplace_back("--add");
+        indexInfo.append(headMode).append(" ").append(headHash).append("\t").append(rawDiff.substr(headerEnd + 1, pathEnd - headerEnd - 1)).push_back('\0');
 
-    for (auto& fileInfo : filesInfoInHEADCommit)
-    {
-        args.emplace_back("--cacheinfo");
-        args.push_back(std::move(fileInfo));
+        position = pathEnd + 1;
     }
 
-    repository->executeGitCommand("update-index", std::move(args));
+    repository->executeGitCommandWithInput(indexInfo, "update-index", "-z", "--index-info");
 }
 
 auto IndexManager::isFileStaged(const std::string_view file) const -> bool
@@ -122,6 +139,18 @@ auto IndexManager::isFileStaged(const std::string_view file) const -> bool
 
 auto IndexManager::getFilesInIndexList(const std::string_view filePattern) const -> std::vector<std::string>
 {
+    if (auto indexEntries = readIndexFileEntries(filePattern, false); indexEntries)
+    {
+        auto files = std::vector<std::string>{};
+        files.reserve(indexEntries->size());
+        for (auto& indexEntry : *indexEntries)
+        {
+            files.push_back(std::move(indexEntry.path).string());
+        }
+
+        return files;
+    }
+
     const auto output = repository->executeGitCommand("ls-files", "--cache", "--", filePattern);
 
     return IndexParser::parseCacheFilenameList(output.stdout);
@@ -129,6 +158,11 @@ auto IndexManager::getFilesInIndexList(const std::string_view filePattern) const
 
 auto IndexManager::getFilesInIndexDetailedList(const std::string_view filePattern) const -> std::vector<IndexEntry>
 {
+    if (auto indexEntries = readIndexFileEntries(filePattern, false); indexEntries)
+    {
+        return std::move(*indexEntries);
+    }
+
     const auto output = repository->executeGitCommand("ls-files", "--stage", "--", filePattern);
 
     return IndexParser::parseStageDetailedList(output.stdout);
@@ -179,6 +213,11 @@ auto IndexManager::getNotStagedFilesList(const std::string_view filePattern) con
 
 auto IndexManager::getUnmergedFilesDetailedList(const std::string_view filePattern) const -> std::vector<IndexEntry>
 {
+    if (auto indexEntries = readIndexFileEntries(filePattern, true); indexEntries)
+    {
+        return std::move(*indexEntries);
+    }
+
     const auto output = repository->executeGitCommand("ls-files", "--unmerged", "--", filePattern);
 
     if (output.stdout.empty())
@@ -211,59 +250,64 @@ auto IndexManager::isDirty() const -> bool
 }
 
 
-auto IndexManager::getHeadFilesHashForGivenFiles(std::vector<DiffIndexEntry>& files) const -> std::vector<std::string>
+auto IndexManager::getUntrackedAndIndexFilesNulList(const std::string_view pattern) const -> std::string
 {
-    auto args = std::vector<std::string>{};
-    constexpr auto CMD_ARGS_SIZE = 5;
-
-    args.reserve(CMD_ARGS_SIZE + files.size());
-
-    args.emplace_back("-r");
-    args.emplace_back("--full-name");
-    args.emplace_back("--format=%(objectmode),%(objectname),%(path)");
-    args.emplace_back("HEAD");
-    args.emplace_back("--");
-
-    for (auto& file : files)
-    {
-        if (file.status != DiffIndexStatus::ADDED)
-        {
-            args.emplace_back(std::move(file.path));
-        }
-    }
-
-    const auto output = repository->executeGitCommand("ls-tree", std::move(args));
+    auto output = repository->executeGitCommand("ls-files", "-z", "--others", "--cached", "--exclude-standard", "--", pattern);
+    return std::move(output.stdout);
+}
 
-    if (output.stdout.empty())
+auto IndexManager::getStagedFilesListOutput(const std::string_view filePattern) const -> std::string
+{
+    if (!repository->CommitsManager().hasAnyCommits())
     {
-        return {};
+        auto output = repository->executeGitCommand("ls-files", "--cached", "--", filePattern);
+        return std::move(output.stdout);
     }
 
-    return Parser::splitToStringsVector(output.stdout, '\n');
+    auto output = repository->executeGitCommand("diff-index", "--cached", "--name-only", "HEAD", "--", filePattern);
+    return std::move(output.stdout);
 }
 
-auto IndexManager::getUntrackedAndIndexFilesList(const std::string_view pattern) const -> std::vector<std::string>
+auto IndexManager::readIndexFileEntries(const std::string_view filePattern, const bool unmergedOnly) const -> std::optional<std::vector<IndexEntry>>
 {
-    const auto output = repository->executeGitCommand("ls-files", "--others", "--cached", "--exclude-standard", "--", pattern);
+    // Alternative index file is handled by git itself
+    const auto gitDirectoryPath = repository->getGitDirectoryPath();
+    if (std::getenv("GIT_INDEX_FILE") != nullptr || !isNativelyMatchablePattern(filePattern) || !std::filesystem::is_directory(gitDirectoryPath))
+    {
+        return std::nullopt;
+    }
 
-    if (output.stdout.empty())
+    // Paths in the index are relative to the top level, while git run from a subdirectory
+    // lists only files below it, relative to that subdirectory, so it is left to git too
+    auto error = std::error_code{};
+    if (!std::filesystem::equivalent(repository->getPath(), repository->getTopLevelPath(), error))
     {
-        return std::vector<std::string>{};
+        return std::nullopt;
     }
 
-    return Parser::splitToStringsVector(output.stdout, '\n');
-}
+    const auto indexFileReader = _details::IndexFileReader{ gitDirectoryPath / "index" };
+    if (!indexFileReader.isValid())
+    {
+        return std::nullopt;
+    }
 
-auto IndexManager::getStagedFilesListOutput(const std::string_view filePattern) const -> std::string
-{
-    if (!repository->CommitsManager().hasAnyCommits())
+    auto indexEntries = std::vector<IndexEntry>{};
+    for (const auto& indexFileEntry : indexFileReader.getEntries())
     {
-        auto output = repository->executeGitCommand("ls-files", "--cached", "--", filePattern);
-        return std::move(output.stdout);
+        if ((unmergedOnly && indexFileEntry.stage == 0) || !matchesPattern(filePattern, indexFileEntry.path))
+        {
+            continue;
+        }
+
+        if (requiresQuoting(indexFileEntry.path))
+        {
+            return std::nullopt;
+        }
+
+        indexEntries.emplace_back(indexFileEntry.getOctalMode(), indexFileEntry.stage, indexFileEntry.getObjectId(), std::filesystem::path{ indexFileEntry.path });
     }
 
-    auto output = repository->executeGitCommand("diff-index", "--cached", "--name-only", "HEAD", "--", filePattern);
-    return std::move(output.stdout);
+    return indexEntries;
 }
 
 } // namespace CppGit
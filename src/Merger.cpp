@@ -9,9 +9,12 @@
 #include "CppGit/_details/FileUtility.hpp"
 #include "CppGit/_details/GitFilesHelper.hpp"
 #include "CppGit/_details/IndexWorktreeManager.hpp"
+#include "CppGit/_details/MergeBaseFinder.hpp"
 
+#include <cstddef>
 #include <expected>
 #include <filesystem>
+#include <memory>
 #include <string>
 #include <string_view>
 #include <utility>
@@ -22,7 +25,8 @@ Merger::Merger(const Repository& repository)
     : repository{ &repository },
       threeWayMerger{ repository },
       indexWorktreeManager{ repository },
-      gitFilesHelper{ repository }
+      gitFilesHelper{ repository },
+      mergeBaseFinder{ std::make_shared<_details::MergeBaseFinder>(repository) }
 {
 }
 
@@ -34,7 +38,7 @@ auto Merger::mergeFastForward(const std::string_view sourceBranch) const -> std:
 
 auto Merger::mergeFastForward(const std::string_view sourceBranch, const std::string_view targetBranch) const -> std::expected<std::string, MergeResult>
 {
-    const auto ancestor = getAncestor(sourceBranch, targetBranch);
+    const auto ancestor = getMergeBase(sourceBranch, targetBranch);
 
     const auto branchesManager = repository->BranchesManager();
 
@@ -60,9 +64,7 @@ auto Merger::mergeFastForward(const std::string_view sourceBranch, const std::st
 
 auto Merger::mergeNoFastForward(const std::string_view sourceBranch, const std::string_view message, const std::string_view description) const -> std::expected<std::string, MergeResult>
 {
-    auto mergeBaseOutput = repository->executeGitCommand("merge-base", "HEAD", sourceBranch);
-
-    auto& mergeBase = mergeBaseOutput.stdout;
+    auto mergeBase = getMergeBase("HEAD", sourceBranch);
 
     const auto branchesManager = repository->BranchesManager();
     auto sourceBranchRef = branchesManager.getHashBranchRefersTo(sourceBranch);
@@ -97,7 +99,7 @@ auto Merger::canFastForward(const std::string_view sourceBranch) const -> bool
 
 auto Merger::canFastForward(const std::string_view sourceBranch, const std::string_view targetBranch) const -> bool
 {
-    const auto ancestor = getAncestor(sourceBranch, targetBranch);
+    const auto ancestor = getMergeBase(sourceBranch, targetBranch);
     return ancestor == repository->CommitsManager().getHeadCommitHash();
 }
 
@@ -108,7 +110,7 @@ auto Merger::isAnythingToMerge(const std::string_view sourceBranch) const -> boo
 
 auto Merger::isAnythingToMerge(const std::string_view sourceBranch, const std::string_view targetBranch) const -> bool
 {
-    const auto ancestor = getAncestor(sourceBranch, targetBranch);
+    const auto ancestor = getMergeBase(sourceBranch, targetBranch);
     const auto sourceBranchRef = repository->BranchesManager().getHashBranchRefersTo(sourceBranch);
 
     return ancestor != sourceBranchRef;
@@ -116,8 +118,7 @@ auto Merger::isAnythingToMerge(const std::string_view sourceBranch, const std::s
 
 auto Merger::isMergeInProgress() const -> bool
 {
-    const auto topLevelPath = repository->getTopLevelPath();
-    return std::filesystem::exists(topLevelPath / ".git/MERGE_HEAD");
+    return std::filesystem::exists(repository->getGitDirectoryPath() / "MERGE_HEAD");
 }
 
 auto Merger::isThereAnyConflict() const -> bool
@@ -125,9 +126,61 @@ auto Merger::isThereAnyConflict() const -> bool
     return isThereAnyConflictImpl();
 }
 
-auto Merger::getAncestor(const std::string_view sourceBranch, const std::string_view targetBranch) const -> std::string
+auto Merger::getMergeBase(const std::string_view firstBranch, const std::string_view secondBranch) const -> std::string
+{
+    if (auto mergeBase = mergeBaseFinder->getMergeBase(firstBranch, secondBranch); mergeBase)
+    {
+        return std::move(*mergeBase);
+    }
+
+    return getMergeBaseWithGit(firstBranch, secondBranch);
+}
+
+auto Merger::getMergeBases(const std::vector<std::pair<std::string, std::string>>& branchesPairs) const -> std::vector<std::string>
+{
+    auto foundMergeBases = mergeBaseFinder->getMergeBases(branchesPairs);
+    auto mergeBases = std::vector<std::string>{};
+    mergeBases.reserve(branchesPairs.size());
+
+    for (auto i = std::size_t{ 0 }; i < branchesPairs.size(); ++i)
+    {
+        const auto& [firstBranch, secondBranch] = branchesPairs[i];
+        mergeBases.push_back(foundMergeBases[i] ? std::move(*foundMergeBases[i]) : getMergeBaseWithGit(firstBranch, secondBranch));
+    }
+
+    return mergeBases;
+}
+
+auto Merger::isAncestor(const std::string_view ancestor, const std::string_view descendant) const -> bool
+{
+    if (const auto result = mergeBaseFinder->isAncestor(ancestor, descendant); result)
+    {
+        return *result;
+    }
+
+    return repository->executeGitCommand("merge-base", "--is-ancestor", ancestor, descendant).return_code == 0;
+}
+
+auto Merger::areAncestors(const std::vector<std::string>& ancestors, const std::string_view descendant) const -> std::vector<bool>
+{
+    if (auto result = mergeBaseFinder->areAncestors(ancestors, descendant); result)
+    {
+        return std::move(*result);
+    }
+
+    auto result = std::vector<bool>{};
+    result.reserve(ancestors.size());
+    for (const auto& ancestor : ancestors)
+    {
+        result.push_back(repository->executeGitCommand("merge-base", "--is-ancestor", ancestor, descendant).return_code == 0);
+    }
+
+    return result;
+}
+
+auto Merger::getMergeBaseWithGit(const std::string_view firstBranch, const std::string_view secondBranch) const -> std::string
 {
-    auto output = repository->executeGitCommand("merge-base", sourceBranch, targetBranch);
+    auto output = repository->executeGitCommand("merge-base", firstBranch, secondBranch);
     return std::move(output.stdout);
 }
 
@@ -149,17 +202,17 @@ auto Merger::startMergeConflict(const std::vector<IndexEntry>& unmergedFilesEntr
 
 auto Merger::createNoFFMergeFiles(const std::string_view sourceBranchRef, const std::string_view message, const std::string_view description) const -> void
 {
-    const auto topLevelPath = repository->getTopLevelPath();
-    _details::FileUtility::createOrOverwriteFile(topLevelPath / ".git/MERGE_HEAD", sourceBranchRef);
-    _details::FileUtility::createOrOverwriteFile(topLevelPath / ".git/MERGE_MODE", "no-ff");
+    const auto gitDirectoryPath = repository->getGitDirectoryPath();
+    _details::FileUtility::createOrOverwriteFile(gitDirectoryPath / "MERGE_HEAD", sourceBranchRef);
+    _details::FileUtility::createOrOverwriteFile(gitDirectoryPath / "MERGE_MODE", "no-ff");
     threeWayMerger.createMergeMsgFile(message, description);
 }
 
 auto Merger::removeNoFFMergeFiles() const -> void
 {
-    const auto topLevelPath = repository->getTopLevelPath();
-    std::filesystem::remove(topLevelPath / ".git/MERGE_HEAD");
-    std::filesystem::remove(topLevelPath / ".git/MERGE_MODE");
+    const auto gitDirectoryPath = repository->getGitDirectoryPath();
+    std::filesystem::remove(gitDirectoryPath / "MERGE_HEAD");
+    std::filesystem::remove(gitDirectoryPath / "MERGE_MODE");
     threeWayMerger.removeMergeMsgFile();
 }
 
@@ -183,7 +236,7 @@ auto Merger::continueMerge() const -> std::expected<std::string, MergeResult>
     }
 
     const auto mergeMsg = threeWayMerger.getMergeMsg();
-    const auto mergeHead = _details::FileUtility::readFile(repository->getTopLevelPath() / ".git/MERGE_HEAD");
+    const auto mergeHead = _details::FileUtility::readFile(repository->getGitDirectoryPath() / "MERGE_HEAD");
     const auto headCommitHash = repository->CommitsManager().getHeadCommitHash();
 
     auto mergeCommitHash = createMergeCommit(mergeHead, headCommitHash, mergeMsg, "");
@@ -0,0 +1,281 @@
+#include "CppGit/ObjectId.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <span>
+#include <string>
+#include <string_view>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+namespace CppGit {
+
+namespace {
+
+using ObjectIdBytes = std::array<std::uint8_t, ObjectId::SHA256_SIZE>;
+
+constexpr auto HEX_DIGIT_VALUES = [] {
+    auto values = std::array<std::int8_t, 256>{};
+    values.fill(-1);
+    for (auto digit = 0; digit < 10; ++digit)
+    {
+        values['0' + digit] = static_cast<std::int8_t>(digit);
+    }
+    for (auto letter = 0; letter < 6; ++letter)
+    {
+        values['a' + letter] = static_cast<std::int8_t>(10 + letter);
+        values['A' + letter] = static_cast<std::int8_t>(10 + letter);
+    }
+
+    return values;
+}();
+
+auto hexDigitValue(const char character) -> int
+{
+    return HEX_DIGIT_VALUES[static_cast<unsigned char>(character)];
+}
+
+#if defined(__SSE2__)
+
+// Hex digits are checked and converted 16 (or 8) at once, so full hash takes a few instructions instead of a loop with branches
+
+/// Mask of lanes with hex digits and their values
+struct HexDigitsValues
+{
+    int validMask;
+    __m128i values;
+};
+
+auto getHexDigitsValues(const __m128i characters) -> HexDigitsValues
+{
+    // Digits are checked on the characters as they are, letters after setting the lower case bit.
+    // Characters above 0x7F are negative in signed comparisons, so they are never valid
+    const auto isDigit = _mm_and_si128(_mm_cmpgt_epi8(characters, _mm_set1_epi8('0' - 1)), _mm_cmplt_epi8(characters, _mm_set1_epi8('9' + 1)));
+    const auto lowerCase = _mm_or_si128(characters, _mm_set1_epi8(0x20));
+    const auto isLetter = _mm_and_si128(_mm_cmpgt_epi8(lowerCase, _mm_set1_epi8('a' - 1)), _mm_cmplt_epi8(lowerCase, _mm_set1_epi8('f' + 1)));
+
+    const auto digitValues = _mm_and_si128(isDigit, _mm_sub_epi8(characters, _mm_set1_epi8('0')));
+    const auto letterValues = _mm_andnot_si128(isDigit, _mm_sub_epi8(lowerCase, _mm_set1_epi8('a' - 10)));
+
+    return { .validMask = _mm_movemask_epi8(_mm_or_si128(isDigit, isLetter)), .values = _mm_or_si128(digitValues, letterValues) };
+}
+
+auto packHexDigitsValues(const __m128i values) -> __m128i
+{
+    // Every 16-bit lane holds two digits, the high half of the byte in the lower byte of the lane
+    const auto highHalves = _mm_slli_epi16(_mm_and_si128(values, _mm_set1_epi16(0x00FF)), 4);
+    const auto lowHalves = _mm_srli_epi16(values, 8);
+
+    return _mm_packus_epi16(_mm_or_si128(highHalves, lowHalves), _mm_setzero_si128());
+}
+
+auto decodeHexSse2(const std::string_view hex, ObjectIdBytes& bytes) -> std::size_t
+{
+    auto position = std::size_t{ 0 };
+    for (; position + 16 <= hex.size(); position += 16)
+    {
+        const auto [validMask, values] = getHexDigitsValues(_mm_loadu_si128(reinterpret_cast<const __m128i*>(hex.data() + position))); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+        if (validMask != 0xFFFF)
+        {
+            return std::string_view::npos;
+        }
+        _mm_storel_epi64(reinterpret_cast<__m128i*>(bytes.data() + (position / 2)), packHexDigitsValues(values)); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+    }
+
+    if (position + 8 <= hex.size())
+    {
+        const auto [validMask, values] = getHexDigitsValues(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(hex.data() + position))); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+        if ((validMask & 0xFF) != 0xFF)
+        {
+            return std::string_view::npos;
+        }
+        const auto packed = _mm_cvtsi128_si32(packHexDigitsValues(values));
+        std::memcpy(bytes.data() + (position / 2), &packed, 4);
+        position += 8;
+    }
+
+    return position;
+}
+
+auto isHexSse2(const std::string_view hex) -> std::size_t
+{
+    auto position = std::size_t{ 0 };
+    for (; position + 16 <= hex.size(); position += 16)
+    {
+        if (getHexDigitsValues(_mm_loadu_si128(reinterpret_cast<const __m128i*>(hex.data() + position))).validMask != 0xFFFF) // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+        {
+            return std::string_view::npos;
+        }
+    }
+
+    if (position + 8 <= hex.size())
+    {
+        if ((getHexDigitsValues(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(hex.data() + position))).validMask & 0xFF) != 0xFF) // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+        {
+            return std::string_view::npos;
+        }
+        position += 8;
+    }
+
+    return position;
+}
+
+auto encodeHexSse2(const ObjectIdBytes& bytes, const std::size_t hexSize, char* hex) -> void
+{
+    // 8 bytes give 16 digits, the buffer is big enough for the last group even if only a part of it is used
+    for (auto position = std::size_t{ 0 }; position < hexSize; position += 16)
+    {
+        const auto groupBytes = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(bytes.data() + (position / 2))); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+        const auto highHalves = _mm_and_si128(_mm_srli_epi16(groupBytes, 4), _mm_set1_epi8(0x0F));
+        const auto lowHalves = _mm_and_si128(groupBytes, _mm_set1_epi8(0x0F));
+        const auto values = _mm_unpacklo_epi8(highHalves, lowHalves);
+
+        const auto isLetter = _mm_cmpgt_epi8(values, _mm_set1_epi8(9));
+        const auto digits = _mm_add_epi8(_mm_add_epi8(values, _mm_set1_epi8('0')), _mm_and_si128(isLetter, _mm_set1_epi8('a' - '0' - 10)));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(hex + position), digits); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+    }
+}
+
+#endif
+
+/// Decode hex digits into bytes, which have to be zeroed
+auto decodeHex(const std::string_view hex, ObjectIdBytes& bytes) -> bool
+{
+    auto position = std::size_t{ 0 };
+#if defined(__SSE2__)
+    position = decodeHexSse2(hex, bytes);
+    if (position == std::string_view::npos)
+    {
+        return false;
+    }
+#endif
+
+    for (; position < hex.size(); ++position)
+    {
+        const auto value = hexDigitValue(hex[position]);
+        if (value < 0)
+        {
+            return false;
+        }
+
+        bytes[position / 2] |= static_cast<std::uint8_t>(position % 2 == 0 ? value << 4 : value);
+    }
+
+    return true;
+}
+
+} // namespace
+
+auto ObjectId::fromHex(const std::string_view hex) -> ObjectId
+{
+    if (hex.size() > SHA256_SIZE * 2)
+    {
+        return ObjectId{};
+    }
+
+    auto objectId = ObjectId{};
+    if (!decodeHex(hex, objectId.bytes))
+    {
+        return ObjectId{};
+    }
+    objectId.hexSize = static_cast<std::uint8_t>(hex.size());
+
+    return objectId;
+}
+
+auto ObjectId::fromBytes(const std::span<const std::uint8_t> hashBytes) -> ObjectId
+{
+    if (hashBytes.size() > SHA256_SIZE)
+    {
+        return ObjectId{};
+    }
+
+    auto objectId = ObjectId{};
+    std::ranges::copy(hashBytes, objectId.bytes.begin());
+    objectId.hexSize = static_cast<std::uint8_t>(hashBytes.size() * 2);
+
+    return objectId;
+}
+
+auto ObjectId::isHex(const std::string_view hex) -> bool
+{
+    if (hex.empty() || hex.size() > SHA256_SIZE * 2)
+    {
+        return false;
+    }
+
+    auto position = std::size_t{ 0 };
+#if defined(__SSE2__)
+    position = isHexSse2(hex);
+    if (position == std::string_view::npos)
+    {
+        return false;
+    }
+#endif
+
+    return std::ranges::all_of(hex.substr(position), [](const char character) { return hexDigitValue(character) >= 0; });
+}
+
+auto ObjectId::toHex() const -> std::string
+{
+#if defined(__SSE2__)
+    auto hex = std::array<char, SHA256_SIZE * 2>{};
+    encodeHexSse2(bytes, hexSize, hex.data());
+
+    return std::string{ hex.data(), hexSize };
+#else
+    constexpr auto HEX_DIGITS = std::string_view{ "0123456789abcdef" };
+
+    auto hex = std::string(hexSize, '\0');
+    for (auto i = std::size_t{ 0 }; i < hex.size(); ++i)
+    {
+        const auto byte = bytes[i / 2];
+        hex[i] = HEX_DIGITS[i % 2 == 0 ? byte >> 4 : byte & 0x0F];
+    }
+
+    return hex;
+#endif
+}
+
+auto ObjectId::getHexSize() const -> std::size_t
+{
+    return hexSize;
+}
+
+auto ObjectId::getBytes() const -> std::span<const std::uint8_t>
+{
+    return std::span{ bytes }.first((hexSize + 1) / 2);
+}
+
+auto ObjectId::isEmpty() const -> bool
+{
+    return hexSize == 0;
+}
+
+auto ObjectId::operator==(const std::string_view hex) const -> bool
+{
+    if (hex.size() != hexSize)
+    {
+        return false;
+    }
+
+    auto hexBytes = ObjectIdBytes{};
+    return decodeHex(hex, hexBytes) && hexBytes == bytes;
+}
+
+} // namespace CppGit
+
+auto std::hash<CppGit::ObjectId>::operator()(const CppGit::ObjectId& objectId) const noexcept -> std::size_t
+{
+    // Hashes are uniformly distributed already, so their first bytes are good enough
+    const auto objectIdBytes = objectId.getBytes();
+    auto hash = std::size_t{ 0 };
+    std::memcpy(&hash, objectIdBytes.data(), std::min(sizeof(hash), objectIdBytes.size()));
+
+    return hash ^ objectId.getHexSize();
+}
@@ -5,6 +5,7 @@
 #include "CppGit/CommitsLogManager.hpp"
 #include "CppGit/CommitsManager.hpp"
 #include "CppGit/IndexManager.hpp"
+#include "CppGit/Merger.hpp"
 #include "CppGit/RebaseTodoCommand.hpp"
 #include "CppGit/Repository.hpp"
 #include "CppGit/_details/CommitAmender.hpp"
@@ -13,9 +14,12 @@
 #include "CppGit/_details/GitFilesHelper.hpp"
 
 #include <algorithm>
+#include <cstddef>
 #include <expected>
 #include <filesystem>
 #include <iterator>
+#include <optional>
+#include <stdexcept>
 #include <string>
 #include <string_view>
 #include <utility>
@@ -46,6 +50,91 @@ auto Rebaser::interactiveRebase(const std::string_view upstream, const std::vect
     return rebaseImpl(upstream, rebaseCommands);
 }
 
+auto Rebaser::rebaseInMemory(const std::string_view upstream) const -> std::expected<std::string, RebaseResult>
+{
+    return rebaseInMemory(branchesManager.getCurrentBranchName(), upstream);
+}
+
+auto Rebaser::rebaseInMemory(const std::string_view branch, const std::string_view upstream) const -> std::expected<std::string, RebaseResult>
+{
+    // Empty name is the current branch of detached HEAD, and updating the ref of not existing branch would create it
+    if (branch.empty())
+    {
+        throw std::runtime_error("Cannot rebase in memory: HEAD is detached");
+    }
+
+    const auto branchRef = _details::ReferencesManager::appendPrefixToRefIfNeeded(branch, false);
+    if (!referencesManager.refExists(branchRef))
+    {
+        throw std::runtime_error("Cannot rebase in memory: branch " + std::string{ branch } + " does not exist");
+    }
+
+    const auto upstreamHash = referencesManager.getRefHash(upstream);
+    const auto origHead = referencesManager.getRefHash(branchRef);
+    const auto isCheckedOut = !repository->getTopLevelPath().empty() && branchesManager.getCurrentBranchName() == branchRef;
+
+    const auto rebaseCommands = getTodoCommands(upstream, branchRef);
+    auto rewrittenCommits = std::vector<std::pair<std::string, std::string>>{};
+    auto currentHash = upstreamHash;
+    auto currentTreeHash = commitsManager.getCommitInfo(upstreamHash).getTreeHash();
+
+    for (auto commandIt = rebaseCommands.begin(); commandIt != rebaseCommands.end(); ++commandIt)
+    {
+        const auto commitInfo = commitsManager.getCommitInfo(commandIt->hash);
+        auto replayResult = replayCommit(commitInfo, currentHash, currentTreeHash);
+
+        if (!replayResult.has_value())
+        {
+            if (replayResult.error() == RebaseResult::EMPTY_DIFF)
+            {
+                continue;
+            }
+
+            if (!isCheckedOut)
+            {
+                return std::unexpected{ replayResult.error() };
+            }
+
+            // Commits replayed so far are kept, the conflicting one and the rest are processed with the index and worktree
+            createRebaseFiles(upstreamHash, branchRef, origHead, rebaseCommands);
+            for (auto doneIt = rebaseCommands.begin(); doneIt != commandIt; ++doneIt)
+            {
+                todoList.pop();
+            }
+            for (const auto& [hashBefore, hashAfter] : rewrittenCommits)
+            {
+                rebaseFilesHelper.appendRewrittenListFile(hashBefore, hashAfter);
+            }
+            branchesManager.detachHead(currentHash);
+
+            if (auto todoResult = processTodoList(); todoResult != RebaseResult::COMMAND_PROCESSED)
+            {
+                return std::unexpected{ todoResult };
+            }
+
+            return endRebase();
+        }
+
+        if (replayResult.value() != commitInfo.getHash())
+        {
+            rewrittenCommits.emplace_back(commitInfo.getHash(), replayResult.value());
+        }
+
+        currentHash = std::move(replayResult.value());
+    }
+
+    referencesManager.updateRefHash(branchRef, currentHash);
+    _details::GitFilesHelper{ *repository }.setOrigHeadFile(origHead);
+
+    if (isCheckedOut)
+    {
+        indexWorktreeManager.resetIndexToTree(currentHash);
+        indexWorktreeManager.copyForceIndexToWorktree();
+    }
+
+    return currentHash;
+}
+
 auto Rebaser::abortRebase() const -> void
 {
     indexWorktreeManager.resetIndexToTree(rebaseFilesHelper.getOrigHead());
@@ -62,6 +151,9 @@ auto Rebaser::continueRebase() const -> std::expected<std::string, RebaseResult>
 
 auto Rebaser::continueRebase(const std::string_view message, const std::string_view description) const -> std::expected<std::string, RebaseResult>
 {
+    // Todo file may have been changed since rebase stopped, e.g. by the user or by git itself
+    todoList = _details::RebaseTodoList{ rebaseFilesHelper.getTodoFileCommands() };
+
     if (auto lastCommand = rebaseFilesHelper.getLastDoneCommand(); lastCommand->type != RebaseTodoCommandType::BREAK)
     {
         const auto messageAndDesc = [&message, &description, this] {
@@ -137,18 +229,23 @@ auto Rebaser::isRebaseInProgress() const -> bool
 
 auto Rebaser::getDefaultTodoCommands(const std::string_view upstream) const -> std::vector<RebaseTodoCommand>
 {
-    auto rebaseBase = repository->executeGitCommand("merge-base", "HEAD", upstream);
+    return getTodoCommands(upstream, "HEAD");
+}
+
+auto Rebaser::getTodoCommands(const std::string_view upstream, const std::string_view branch) const -> std::vector<RebaseTodoCommand>
+{
+    auto rebaseBase = repository->Merger().getMergeBase(branch, upstream);
 
     auto commitsLogManager = repository->CommitsLogManager();
     commitsLogManager.setOrder(CommitsLogManager::Order::REVERSE);
-    auto commitsToRebase = commitsLogManager.getCommitsLogDetailed(std::move(rebaseBase.stdout), "HEAD");
+    auto commitsToRebase = commitsLogManager.getCommitsLogDetailed(std::move(rebaseBase), branch);
 
     auto rebaseCommands = std::vector<RebaseTodoCommand>{};
 
     std::ranges::transform(commitsToRebase,
                            std::back_inserter(rebaseCommands),
                            [](auto& commit) {
-                               return RebaseTodoCommand{ RebaseTodoCommandType::PICK, std::move(commit.getHash()), std::move(commit.getMessage()) };
+                               return RebaseTodoCommand{ RebaseTodoCommandType::PICK, commit.getHash(), std::move(commit.getMessage()) };
                            });
 
     return rebaseCommands;
@@ -174,18 +271,23 @@ auto Rebaser::rebaseImpl(const std::string_view upstream, const std::vector<Reba
 auto Rebaser::startRebase(const std::string_view upstream, const std::vector<RebaseTodoCommand>& rebaseCommands) const -> void
 {
     const auto upstreamHash = referencesManager.getRefHash(upstream);
-    const auto headRef = referencesManager.getRefHash("HEAD");
 
-    rebaseFilesHelper.createRebaseDir();
-    rebaseFilesHelper.createHeadNameFile(branchesManager.getCurrentBranchName());
-    rebaseFilesHelper.createOntoFile(upstreamHash);
-    rebaseFilesHelper.createRebaseOrigHeadFile(headRef);
-    _details::GitFilesHelper{ *repository }.setOrigHeadFile(headRef);
-    rebaseFilesHelper.generateTodoFile(rebaseCommands);
+    createRebaseFiles(upstreamHash, branchesManager.getCurrentBranchName(), referencesManager.getRefHash("HEAD"), rebaseCommands);
 
     branchesManager.detachHead(upstreamHash);
 }
 
+auto Rebaser::createRebaseFiles(const std::string_view ontoHash, const std::string_view headName, const std::string_view origHead, const std::vector<RebaseTodoCommand>& rebaseCommands) const -> void
+{
+    rebaseFilesHelper.createRebaseDir();
+    rebaseFilesHelper.createHeadNameFile(headName);
+    rebaseFilesHelper.createOntoFile(ontoHash);
+    rebaseFilesHelper.createRebaseOrigHeadFile(origHead);
+    _details::GitFilesHelper{ *repository }.setOrigHeadFile(origHead);
+    rebaseFilesHelper.generateTodoFile(rebaseCommands);
+    todoList = _details::RebaseTodoList{ rebaseCommands };
+}
+
 auto Rebaser::endRebase() const -> std::string
 {
     const auto currentHash = referencesManager.getRefHash("HEAD");
@@ -200,33 +302,47 @@ auto Rebaser::endRebase() const -> std::string
 
 auto Rebaser::processTodoList() const -> RebaseResult
 {
-    auto todoCommand = rebaseFilesHelper.peakAndPopTodoFile();
+    auto processedSinceCheckpoint = std::size_t{ 0 };
 
-    while (todoCommand)
+    while (auto todoCommand = todoList.pop())
     {
-        auto todoCommandValue = todoCommand.value();
-
-        if (todoCommandValue.type != RebaseTodoCommandType::BREAK)
-        {
-            rebaseFilesHelper.createRebaseHeadFile(todoCommandValue.hash);
-        }
-
+        const auto& todoCommandValue = todoCommand.value();
         const auto todoResult = processTodoCommand(todoCommandValue);
-        rebaseFilesHelper.appendDoneFile(todoCommandValue);
 
         if (todoResult != RebaseResult::COMMAND_PROCESSED && todoResult != RebaseResult::EMPTY_DIFF)
         {
+            if (todoCommandValue.type != RebaseTodoCommandType::BREAK)
+            {
+                rebaseFilesHelper.createRebaseHeadFile(todoCommandValue.hash);
+            }
+
+            flushTodoList();
+
             return todoResult;
         }
 
-        rebaseFilesHelper.removeRebaseHeadFile();
-
-        todoCommand = rebaseFilesHelper.peakAndPopTodoFile();
+        if (todoCheckpointInterval != 0 && ++processedSinceCheckpoint == todoCheckpointInterval)
+        {
+            flushTodoList();
+            processedSinceCheckpoint = 0;
+        }
     }
 
     return RebaseResult::COMMAND_PROCESSED;
 }
 
+auto Rebaser::flushTodoList() const -> void
+{
+    rebaseFilesHelper.writeTodoFile(todoList.getRemainingCommands());
+    rebaseFilesHelper.appendDoneFile(todoList.getNotFlushedDoneCommands());
+    todoList.markFlushed();
+}
+
+auto Rebaser::setTodoCheckpointInterval(const std::size_t interval) -> void
+{
+    todoCheckpointInterval = interval;
+}
+
 auto Rebaser::processTodoCommand(const RebaseTodoCommand& rebaseTodoCommand) const -> RebaseResult
 {
     if (rebaseTodoCommand.type == RebaseTodoCommandType::PICK)
@@ -423,10 +539,10 @@ auto Rebaser::processSquash(const RebaseTodoCommand& rebaseTodoCommand) const ->
 
 auto Rebaser::pickCommit(const Commit& commitInfo) const -> std::expected<std::string, RebaseResult>
 {
-    const auto& pickedParent = commitInfo.getParents()[0];
+    const auto& pickedParent = commitInfo.getParentIds()[0];
     const auto headCommitHash = commitsManager.getHeadCommitHash();
 
-    if (headCommitHash == pickedParent)
+    if (pickedParent == headCommitHash)
     {
         // can FastForward
         branchesManager.detachHead(commitInfo.getHash());
@@ -458,9 +574,99 @@ auto Rebaser::pickCommit(const Commit& commitInfo) const -> std::expected<std::s
     return newCommitHash;
 }
 
+auto Rebaser::replayCommit(const Commit& commitInfo, const std::string& ontoHash, std::string& ontoTreeHash) const -> std::expected<std::string, RebaseResult>
+{
+    const auto& parents = commitInfo.getParentIds();
+    const auto pickedParent = (parents.empty() ? std::string{} : parents[0].toHex());
+
+    if (ontoHash == pickedParent)
+    {
+        // can FastForward
+        ontoTreeHash = commitInfo.getTreeHash();
+
+        return commitInfo.getHash();
+    }
+
+    auto newTreeHash = std::string{};
+
+    if (!pickedParent.empty() && commitsManager.getCommitInfo(pickedParent).getTreeHash() == commitInfo.getTreeHash())
+    {
+        // Empty commits are kept, the same as in regular rebase
+        newTreeHash = ontoTreeHash;
+    }
+    else
+    {
+        auto mergedTreeHash = mergeTreeForPick(commitInfo, pickedParent, ontoTreeHash);
+
+        if (!mergedTreeHash)
+        {
+            return std::unexpected{ RebaseResult::CONFLICT };
+        }
+
+        if (*mergedTreeHash == ontoTreeHash)
+        {
+            return std::unexpected{ RebaseResult::EMPTY_DIFF };
+        }
+
+        newTreeHash = std::move(*mergedTreeHash);
+    }
+
+    const auto envp = std::vector<std::string>{
+        "GIT_AUTHOR_NAME=" + commitInfo.getAuthor().name,
+        "GIT_AUTHOR_EMAIL=" + commitInfo.getAuthor().email,
+        "GIT_AUTHOR_DATE=" + commitInfo.getAuthorDate()
+    };
+
+    auto newCommitHash = commitCreator.createCommitFromTree(newTreeHash, commitInfo.getMessage(), commitInfo.getDescription(), { ontoHash }, envp);
+    ontoTreeHash = std::move(newTreeHash);
+
+    return newCommitHash;
+}
+
+auto Rebaser::mergeTreeForPick(const Commit& commitInfo, const std::string& pickedParent, const std::string& ontoTreeHash) const -> std::optional<std::string>
+{
+    // `git merge-tree --write-tree` before git 2.40 has no --merge-base option and always merges from the merge base of both commits.
+    // Temporary commit with the onto tree on top of the picked commit parent makes that parent the merge base, so the result is the same as of cherry-pick
+    auto temporaryCommitArgs = std::vector<std::string>{ ontoTreeHash, "-m", "rebase onto" };
+    if (!pickedParent.empty())
+    {
+        temporaryCommitArgs.emplace_back("-p");
+        temporaryCommitArgs.push_back(pickedParent);
+    }
+    auto temporaryCommitOutput = repository->executeGitCommand("commit-tree", std::move(temporaryCommitArgs));
+
+    if (temporaryCommitOutput.return_code != 0)
+    {
+        throw std::runtime_error("Failed to create temporary commit: " + temporaryCommitOutput.stderr);
+    }
+
+    auto mergeTreeArgs = std::vector<std::string>{ "--write-tree" };
+    if (pickedParent.empty())
+    {
+        mergeTreeArgs.emplace_back("--allow-unrelated-histories");
+    }
+    mergeTreeArgs.push_back(std::move(temporaryCommitOutput.stdout));
+    mergeTreeArgs.push_back(commitInfo.getHash());
+
+    auto mergeTreeOutput = repository->executeGitCommand("merge-tree", std::move(mergeTreeArgs));
+
+    if (mergeTreeOutput.return_code == 1)
+    {
+        return std::nullopt;
+    }
+
+    if (mergeTreeOutput.return_code != 0)
+    {
+        throw std::runtime_error("Failed to merge trees: " + mergeTreeOutput.stderr);
+    }
+
+    // First line is the tree hash, the rest is only printed for conflicts
+    return mergeTreeOutput.stdout.substr(0, mergeTreeOutput.stdout.find('\n'));
+}
+
 auto Rebaser::isNextCommandFixupOrSquash() const -> bool
 {
-    const auto peakCommand = rebaseFilesHelper.peekTodoFile();
+    const auto peakCommand = todoList.peek();
 
     return peakCommand && (peakCommand->type == RebaseTodoCommandType::FIXUP || peakCommand->type == RebaseTodoCommandType::SQUASH);
 }
@@ -9,11 +9,23 @@
 #include "CppGit/Merger.hpp"
 #include "CppGit/Rebaser.hpp"
 #include "CppGit/Resetter.hpp"
+#include "CppGit/_details/BatchObjectReader.hpp"
+#include "CppGit/_details/CommitCache.hpp"
 #include "CppGit/_details/FileUtility.hpp"
+#include "CppGit/_details/GitCommandExecutor/GitCommandExecutor.hpp"
+#include "CppGit/_details/GitCommandExecutor/GitCommandExecutorMeasuring.hpp"
+#include "CppGit/_details/GitCommandExecutor/GitCommandExecutorUnix.hpp"
+#include "CppGit/_details/GitCommandExecutor/GitCommandMetrics.hpp"
+#include "CppGit/_details/GitConfigLoader.hpp"
+#include "CppGit/_details/Parser/Parser.hpp"
+#include "CppGit/_details/RepositoryContext.hpp"
 
 #include <algorithm>
 #include <filesystem>
+#include <memory>
+#include <optional>
 #include <sstream>
+#include <stdexcept>
 #include <string>
 #include <unordered_set>
 #include <utility>
@@ -22,9 +34,37 @@
 namespace CppGit {
 
 Repository::Repository(std::filesystem::path path)
-    : path(std::move(path))
+    : Repository(std::move(path), std::make_shared<GitCommandExecutorUnix>())
 { }
 
+Repository::Repository(std::filesystem::path path, std::shared_ptr<GitCommandExecutor> commandExecutor)
+    : path(std::move(path)),
+      commandMetrics(std::make_shared<GitCommandMetrics>()),
+      commandExecutor(std::make_shared<GitCommandExecutorMeasuring>(std::move(commandExecutor), commandMetrics)),
+      objectReader(std::make_shared<_details::BatchObjectReader>(this->commandExecutor, this->path.string())),
+      commitCache(std::make_shared<CommitCache>())
+{ }
+
+auto Repository::getCommandExecutor() const -> const std::shared_ptr<GitCommandExecutor>&
+{
+    return commandExecutor->getExecutor();
+}
+
+auto Repository::getCommandMetrics() const -> GitCommandMetrics&
+{
+    return *commandMetrics;
+}
+
+auto Repository::readObject(const std::string_view objectName) const -> std::optional<GitObject>
+{
+    return objectReader->readObject(objectName);
+}
+
+auto Repository::getCommitCache() const -> CommitCache&
+{
+    return *commitCache;
+}
+
 auto Repository::BranchesManager() const -> CppGit::BranchesManager
 {
     return CppGit::BranchesManager(*this);
@@ -87,19 +127,104 @@ auto Repository::getTopLevelPathAsString() const -> std::string
 
 auto Repository::getTopLevelPath() const -> std::filesystem::path
 {
-    auto output = executeGitCommand("rev-parse", "--show-toplevel");
-
-    if (output.stdout.contains('\n'))
+    if (const auto& context = getRepositoryContext(); context)
     {
-        output.stdout.replace(output.stdout.find('\n'), 1, "");
+        return context->topLevelPath;
     }
 
-    return { output.stdout };
+    return {};
 }
 
 auto Repository::getGitDirectoryPath() const -> std::filesystem::path
 {
-    return getTopLevelPath() / ".git";
+    if (const auto& context = getRepositoryContext(); context)
+    {
+        return context->gitDirectoryPath;
+    }
+
+    // Not a repository (yet), that's where initRepository creates git directory
+    return path / ".git";
+}
+
+auto Repository::getCommonDirectoryPath() const -> std::filesystem::path
+{
+    if (const auto& context = getRepositoryContext(); context)
+    {
+        return context->commonDirectoryPath;
+    }
+
+    return getGitDirectoryPath();
+}
+
+auto Repository::getObjectFormat() const -> std::string
+{
+    if (const auto& context = getRepositoryContext(); context)
+    {
+        return context->objectFormat;
+    }
+
+    return "sha1";
+}
+
+auto Repository::invalidateRepositoryContext() const -> void
+{
+    repositoryContext.reset();
+    configSnapshot.reset();
+}
+
+auto Repository::setRepositoryContextValidation(const bool enabled) -> void
+{
+    repositoryContextValidation = enabled;
+}
+
+auto Repository::getRepositoryContext() const -> const std::optional<_details::RepositoryContext>&
+{
+    if (repositoryContext && repositoryContextValidation && !_details::isRepositoryContextValid(*repositoryContext))
+    {
+        repositoryContext.reset();
+    }
+
+    if (!repositoryContext)
+    {
+        repositoryContext = _details::discoverRepositoryContext(path);
+        if (!repositoryContext)
+        {
+            repositoryContext = discoverRepositoryContextWithGit();
+        }
+    }
+
+    return repositoryContext;
+}
+
+auto Repository::discoverRepositoryContextWithGit() const -> std::optional<_details::RepositoryContext>
+{
+    const auto output = executeGitCommand("rev-parse", "--is-bare-repository", "--absolute-git-dir", "--git-common-dir", "--show-object-format");
+    const auto lines = Parser::splitToStringsVector(output.stdout, '\n');
+    if (output.return_code != 0 || lines.size() != 4)
+    {
+        return std::nullopt;
+    }
+
+    const auto bare = lines[0] == "true";
+
+    // Common directory is relative to the path git has been run in
+    auto commonDirectoryPath = std::filesystem::path{ lines[2] };
+    if (commonDirectoryPath.is_relative())
+    {
+        commonDirectoryPath = std::filesystem::absolute(path / commonDirectoryPath).lexically_normal();
+    }
+
+    auto topLevelPath = std::filesystem::path{};
+    if (!bare)
+    {
+        topLevelPath = executeGitCommand("rev-parse", "--show-toplevel").stdout;
+    }
+
+    return _details::RepositoryContext{ .topLevelPath = std::move(topLevelPath),
+                                        .gitDirectoryPath = lines[1],
+                                        .commonDirectoryPath = std::move(commonDirectoryPath),
+                                        .objectFormat = lines[3],
+                                        .bare = bare };
 }
 
 auto Repository::getAbsoluteFromRelativePath(const std::filesystem::path& relativePath) const -> std::filesystem::path
@@ -152,6 +277,8 @@ auto Repository::isValidGitRepository() const -> bool
 
 auto Repository::initRepository(const bool bare, const std::string_view mainBranchName) const -> void
 {
+    invalidateRepositoryContext();
+
     std::filesystem::path gitDir = path;
 
     if (!bare)
@@ -183,6 +310,23 @@ auto Repository::initRepository(const bool bare, const std::string_view mainBran
 
 auto Repository::getRemoteUrls() const -> std::unordered_set<std::string>
 {
+    try
+    {
+        const auto snapshot = getConfigSnapshot();
+
+        // url.<base>.insteadOf rewriting is left to git
+        const auto hasUrlRewrites = std::ranges::any_of(snapshot->getEntries(), [](const GitConfigSnapshotEntry& entry) { return entry.key.starts_with("url."); });
+        if (!hasUrlRewrites)
+        {
+            const auto urls = snapshot->getAll("remote.origin.url");
+            return std::unordered_set<std::string>{ urls.begin(), urls.end() };
+        }
+    }
+    catch (const std::runtime_error&) // NOLINT(bugprone-empty-catch)
+    {
+        // Config not readable natively, git reports it the usual way
+    }
+
     auto remote_output = executeGitCommand("remote", "get-url", "--all", "origin");
 
     if (remote_output.stdout.empty())
@@ -203,6 +347,27 @@ auto Repository::getRemoteUrls() const -> std::unordered_set<std::string>
 
 auto Repository::getConfig() const -> std::vector<GitConfigEntry>
 {
+    try
+    {
+        const auto snapshot = getConfigSnapshot();
+
+        // The same entries as `git config --list --local` lists, which doesn't follow includes
+        auto config = std::vector<GitConfigEntry>{};
+        for (const auto& entry : snapshot->getEntries())
+        {
+            if (entry.scope == GitConfigScope::LOCAL && !entry.included)
+            {
+                config.emplace_back(entry.key, entry.value.value_or(""));
+            }
+        }
+
+        return config;
+    }
+    catch (const std::runtime_error&) // NOLINT(bugprone-empty-catch)
+    {
+        // Config not readable natively, git reports it the usual way
+    }
+
     auto config_output = executeGitCommand("config", "--list", "--local");
 
     if (config_output.stdout.empty())
@@ -228,23 +393,19 @@ auto Repository::getConfig() const -> std::vector<GitConfigEntry>
     return config;
 }
 
-auto Repository::getDescription() const -> std::string
+auto Repository::getConfigSnapshot() const -> std::shared_ptr<const GitConfigSnapshot>
 {
-    const auto topLevelRepoPathString = getTopLevelPathAsString();
-    std::filesystem::path descriptionPath;
-
-    if (auto descriptionPathInGit = std::filesystem::path{ std::string(topLevelRepoPathString + "/.git/description") };
-        std::filesystem::exists(descriptionPathInGit))
-    {
-        descriptionPath = std::filesystem::path{ descriptionPathInGit };
-    }
-    else if (auto descriptionPathInBareGit = std::filesystem::path{ (topLevelRepoPathString + "/description") };
-             std::filesystem::exists(descriptionPathInBareGit))
+    if (!configSnapshot || !configSnapshot->isUpToDate())
     {
-        descriptionPath = std::filesystem::path{ descriptionPathInBareGit };
+        configSnapshot = std::make_shared<const GitConfigSnapshot>(_details::loadGitConfigSnapshot(getGitDirectoryPath(), getCommonDirectoryPath()));
     }
 
-    auto description = _details::FileUtility::readFile(descriptionPath);
+    return configSnapshot;
+}
+
+auto Repository::getDescription() const -> std::string
+{
+    auto description = _details::FileUtility::readFile(getCommonDirectoryPath() / "description");
 
     if (auto unnamedPos = description.find("Unnamed repository");
         unnamedPos == 0)
@@ -0,0 +1,60 @@
+#include "CppGit/Timestamp.hpp"
+
+#include <charconv>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <system_error>
+
+namespace CppGit {
+
+auto Timestamp::parse(const std::string_view date) -> std::optional<Timestamp>
+{
+    // <seconds> <sign><hh><mm>
+    constexpr auto TIMEZONE_SIZE = std::size_t{ 5 };
+
+    const auto separator = date.find(' ');
+    if (separator == std::string_view::npos || date.size() - separator - 1 != TIMEZONE_SIZE)
+    {
+        return std::nullopt;
+    }
+
+    auto timestamp = Timestamp{};
+    const auto* const secondsEnd = date.data() + separator;
+    if (const auto [end, error] = std::from_chars(date.data(), secondsEnd, timestamp.secondsSinceEpoch); error != std::errc{} || end != secondsEnd)
+    {
+        return std::nullopt;
+    }
+
+    const auto timezone = date.substr(separator + 1);
+    if (timezone[0] != '+' && timezone[0] != '-')
+    {
+        return std::nullopt;
+    }
+
+    auto hhmm = 0;
+    const auto* const timezoneEnd = timezone.data() + timezone.size();
+    if (const auto [end, error] = std::from_chars(timezone.data() + 1, timezoneEnd, hhmm); error != std::errc{} || end != timezoneEnd || hhmm < 0)
+    {
+        return std::nullopt;
+    }
+
+    const auto offset = (hhmm / 100 * 60) + (hhmm % 100);
+    timestamp.timezoneOffsetMinutes = static_cast<std::int16_t>(timezone[0] == '-' ? -offset : offset);
+    timestamp.negativeUtcOffset = timezone[0] == '-' && offset == 0;
+
+    return timestamp;
+}
+
+auto Timestamp::toString() const -> std::string
+{
+    const auto offset = std::abs(timezoneOffsetMinutes);
+    const auto hhmm = std::to_string(10'000 + (offset / 60 * 100) + (offset % 60));
+
+    return std::to_string(secondsSinceEpoch) + (timezoneOffsetMinutes < 0 || negativeUtcOffset ? " -" : " +") + hhmm.substr(1);
+}
+
+} // namespace CppGit
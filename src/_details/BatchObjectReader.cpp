@@ -0,0 +1,186 @@
+#include "CppGit/_details/BatchObjectReader.hpp"
+
+#include "CppGit/_details/GitCommandExecutor/GitCommandExecutor.hpp"
+
+#include <algorithm>
+#include <charconv>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace CppGit::_details {
+
+BatchObjectReader::BatchObjectReader(std::shared_ptr<GitCommandExecutor> commandExecutor, std::string repositoryPath)
+    : commandExecutor{ std::move(commandExecutor) },
+      repositoryPath{ std::move(repositoryPath) }
+{
+}
+
+BatchObjectReader::~BatchObjectReader()
+{
+    stop();
+}
+
+auto BatchObjectReader::readObject(const std::string_view objectName) -> std::optional<GitObject>
+{
+    if (objectName.empty() || objectName.contains('\n'))
+    {
+        return std::nullopt;
+    }
+
+    const auto lock = std::lock_guard{ sessionMutex };
+    if (!isRunning())
+    {
+        start();
+    }
+
+    try
+    {
+        return readObjectImpl(objectName);
+    }
+    catch (const std::runtime_error&)
+    {
+        // The process might have died in the meantime (e.g. repository was moved), try once again with a fresh one
+        stop();
+        start();
+        return readObjectImpl(objectName);
+    }
+}
+
+auto BatchObjectReader::isRunning() const -> bool
+{
+    return session != nullptr;
+}
+
+auto BatchObjectReader::start() -> void
+{
+    session = commandExecutor->startSession(std::vector<std::string>{}, repositoryPath, "cat-file", "--batch");
+    readBuffer.clear();
+    readBufferPos = 0;
+}
+
+auto BatchObjectReader::stop() -> void
+{
+    if (session)
+    {
+        // Closing the session sends EOF to cat-file, which makes it exit
+        session->close();
+        session.reset();
+    }
+
+    readBuffer.clear();
+    readBufferPos = 0;
+}
+
+auto BatchObjectReader::readObjectImpl(const std::string_view objectName) -> std::optional<GitObject>
+{
+    auto request = std::string{ objectName };
+    request.push_back('\n');
+
+    if (!session->write(request))
+    {
+        throw std::runtime_error("Failed to write to cat-file process");
+    }
+
+    auto header = readLine();
+    if (!header)
+    {
+        throw std::runtime_error("Failed to read cat-file header");
+    }
+
+    // <hash> SP <type> SP <size> LF or <object> SP missing LF
+    const auto headerSV = std::string_view{ *header };
+    const auto firstSpace = headerSV.find(' ');
+    const auto lastSpace = headerSV.rfind(' ');
+    if (firstSpace == std::string_view::npos || firstSpace == lastSpace)
+    {
+        return std::nullopt;
+    }
+
+    const auto sizeSV = headerSV.substr(lastSpace + 1);
+    auto size = std::size_t{ 0 };
+    if (std::from_chars(sizeSV.data(), sizeSV.data() + sizeSV.size(), size).ec != std::errc{})
+    {
+        return std::nullopt;
+    }
+
+    auto content = readExactly(size + 1); // object content is followed by LF
+    if (!content)
+    {
+        throw std::runtime_error("Failed to read cat-file content");
+    }
+    content->pop_back();
+
+    return GitObject{ .hash = std::string{ headerSV.substr(0, firstSpace) },
+                      .type = std::string{ headerSV.substr(firstSpace + 1, lastSpace - firstSpace - 1) },
+                      .content = std::move(*content) };
+}
+
+auto BatchObjectReader::fillReadBuffer() -> bool
+{
+    if (readBufferPos > 0)
+    {
+        readBuffer.erase(0, readBufferPos);
+        readBufferPos = 0;
+    }
+
+    return session->read(readBuffer);
+}
+
+auto BatchObjectReader::readLine() -> std::optional<std::string>
+{
+    auto searchFrom = readBufferPos;
+    while (true)
+    {
+        if (const auto newLinePos = readBuffer.find('\n', searchFrom); newLinePos != std::string::npos)
+        {
+            auto line = readBuffer.substr(readBufferPos, newLinePos - readBufferPos);
+            readBufferPos = newLinePos + 1;
+            return line;
+        }
+
+        searchFrom = readBuffer.size() - readBufferPos;
+        if (!fillReadBuffer())
+        {
+            return std::nullopt;
+        }
+    }
+}
+
+auto BatchObjectReader::readExactly(const std::size_t size) -> std::optional<std::string>
+{
+    if (readBuffer.size() - readBufferPos >= size)
+    {
+        auto result = readBuffer.substr(readBufferPos, size);
+        readBufferPos += size;
+        return result;
+    }
+
+    auto result = readBuffer.substr(readBufferPos);
+    result.reserve(size);
+    readBuffer.clear();
+    readBufferPos = 0;
+
+    while (result.size() < size)
+    {
+        if (!fillReadBuffer())
+        {
+            return std::nullopt;
+        }
+
+        const auto missing = size - result.size();
+        const auto toTake = std::min(missing, readBuffer.size());
+        result.append(readBuffer, 0, toTake);
+        readBufferPos = toTake;
+    }
+
+    return result;
+}
+
+} // namespace CppGit::_details
@@ -0,0 +1,117 @@
+#include "CppGit/_details/CommitCache.hpp"
+
+#include "CppGit/Commit.hpp"
+#include "CppGit/ObjectId.hpp"
+
+#include <cstddef>
+#include <mutex>
+#include <optional>
+
+namespace CppGit {
+
+CommitCache::CommitCache(const std::size_t memoryBudget)
+    : memoryBudget{ memoryBudget }
+{
+}
+
+auto CommitCache::get(const ObjectId& commitId) -> std::optional<Commit>
+{
+    const auto lock = std::lock_guard{ mutex };
+
+    const auto entryIt = entriesById.find(commitId);
+    if (entryIt == entriesById.end())
+    {
+        ++statistics.misses;
+        return std::nullopt;
+    }
+
+    ++statistics.hits;
+    entries.splice(entries.begin(), entries, entryIt->second);
+
+    return entryIt->second->commit;
+}
+
+auto CommitCache::insert(const Commit& commit) -> void
+{
+    if (commit.getId().isEmpty())
+    {
+        return;
+    }
+
+    const auto memoryUsage = estimateMemoryUsage(commit);
+
+    const auto lock = std::lock_guard{ mutex };
+
+    if (const auto entryIt = entriesById.find(commit.getId()); entryIt != entriesById.end())
+    {
+        entries.splice(entries.begin(), entries, entryIt->second);
+        return;
+    }
+
+    if (memoryUsage > memoryBudget)
+    {
+        return;
+    }
+
+    entries.push_front(CacheEntry{ .commit = commit, .memoryUsage = memoryUsage });
+    entriesById.emplace(commit.getId(), entries.begin());
+    statistics.memoryUsage += memoryUsage;
+    ++statistics.size;
+
+    evictOverBudget();
+}
+
+auto CommitCache::setMemoryBudget(const std::size_t memoryBudget) -> void
+{
+    const auto lock = std::lock_guard{ mutex };
+
+    this->memoryBudget = memoryBudget;
+    evictOverBudget();
+}
+
+auto CommitCache::getMemoryBudget() const -> std::size_t
+{
+    const auto lock = std::lock_guard{ mutex };
+
+    return memoryBudget;
+}
+
+auto CommitCache::getStatistics() const -> CommitCacheStatistics
+{
+    const auto lock = std::lock_guard{ mutex };
+
+    return statistics;
+}
+
+auto CommitCache::clear() -> void
+{
+    const auto lock = std::lock_guard{ mutex };
+
+    entries.clear();
+    entriesById.clear();
+    statistics = CommitCacheStatistics{};
+}
+
+auto CommitCache::estimateMemoryUsage(const Commit& commit) -> std::size_t
+{
+    // Signatures are shared by all commits, so they aren't counted. Nodes of the list and the map are counted roughly
+    constexpr auto NODES_OVERHEAD = sizeof(CacheEntry) + sizeof(ObjectId) + (4 * sizeof(void*));
+
+    return NODES_OVERHEAD + commit.getMessage().capacity() + commit.getDescription().capacity() + (commit.getParentIds().capacity() * sizeof(ObjectId));
+}
+
+auto CommitCache::evictOverBudget() -> void
+{
+    while (statistics.memoryUsage > memoryBudget && !entries.empty())
+    {
+        const auto& leastRecentlyUsed = entries.back();
+        statistics.memoryUsage -= leastRecentlyUsed.memoryUsage;
+        --statistics.size;
+        ++statistics.evictions;
+
+        entriesById.erase(leastRecentlyUsed.commit.getId());
+        entries.pop_back();
+    }
+}
+
+} // namespace CppGit
@@ -29,6 +29,11 @@ auto CommitCreator::createCommit(const std::string_view message, const std::vect
     return createCommit(message, "", parents, envp);
 }
 
+auto CommitCreator::createCommitFromTree(std::string treeHash, const std::string_view message, const std::string_view description, const std::vector<std::string>& parents, const std::vector<std::string>& envp) const -> std::string
+{
+    return commitTree(std::move(treeHash), message, description, parents, envp);
+}
+
 auto CommitCreator::writeTree() const -> std::string
 {
     auto writeTreeOutput = repository->executeGitCommand("write-tree");
@@ -0,0 +1,475 @@
+#include "CppGit/_details/CommitGraphReader.hpp"
+
+#include "CppGit/ObjectId.hpp"
+#include "CppGit/_details/FileUtility.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <fcntl.h>
+#include <filesystem>
+#include <optional>
+#include <ranges>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <vector>
+
+namespace CppGit::_details {
+
+namespace {
+
+constexpr auto HEADER_SIZE = std::size_t{ 8 };
+constexpr auto CHUNK_LOOKUP_ENTRY_SIZE = std::size_t{ 12 };
+constexpr auto FANOUT_SIZE = std::size_t{ 256 * 4 };
+constexpr auto COMMIT_DATA_EXTRA_SIZE = std::size_t{ 16 };
+
+constexpr auto CHUNK_FANOUT = std::uint32_t{ 0x4F49'4446 };              // OIDF
+constexpr auto CHUNK_LOOKUP = std::uint32_t{ 0x4F49'444C };              // OIDL
+constexpr auto CHUNK_COMMIT_DATA = std::uint32_t{ 0x4344'4154 };         // CDAT
+constexpr auto CHUNK_EXTRA_EDGES = std::uint32_t{ 0x4544'4745 };         // EDGE
+constexpr auto CHUNK_GENERATION_DATA = std::uint32_t{ 0x4744'4132 };     // GDA2
+constexpr auto CHUNK_GENERATION_OVERFLOW = std::uint32_t{ 0x4744'4F32 }; // GDO2
+constexpr auto CHUNK_BASE_GRAPHS = std::uint32_t{ 0x4241'5345 };         // BASE
+
+constexpr auto EXTRA_EDGES_FLAG = std::uint32_t{ 0x8000'0000 };
+constexpr auto LAST_EDGE_FLAG = std::uint32_t{ 0x8000'0000 };
+constexpr auto EDGE_VALUE_MASK = std::uint32_t{ 0x7FFF'FFFF };
+constexpr auto GENERATION_OVERFLOW_FLAG = std::uint32_t{ 0x8000'0000 };
+
+auto readUint32(const char* bytes) -> std::uint32_t
+{
+    const auto* const unsignedBytes = reinterpret_cast<const unsigned char*>(bytes); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+    return (std::uint32_t{ unsignedBytes[0] } << 24U) | (std::uint32_t{ unsignedBytes[1] } << 16U) | (std::uint32_t{ unsignedBytes[2] } << 8U) | std::uint32_t{ unsignedBytes[3] };
+}
+
+auto readUint64(const char* bytes) -> std::uint64_t
+{
+    return (std::uint64_t{ readUint32(bytes) } << 32U) | std::uint64_t{ readUint32(bytes + 4) };
+}
+
+auto toHex(const char* bytes, const std::size_t size) -> std::string
+{
+    return ObjectId::fromBytes(std::span{ reinterpret_cast<const std::uint8_t*>(bytes), size }).toHex(); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+}
+
+} // namespace
+
+CommitGraphReader::CommitGraphReader(const std::filesystem::path& objectsDirectoryPath)
+{
+    const auto infoDirectoryPath = objectsDirectoryPath / "info";
+
+    // The same order as git uses: single file first, then the chain of split commit-graphs
+    if (loadLayer(infoDirectoryPath / "commit-graph"))
+    {
+        valid = true;
+    }
+    else if (layers.empty())
+    {
+        const auto chainDirectoryPath = infoDirectoryPath / "commit-graphs";
+        const auto chainContent = FileUtility::readFile(chainDirectoryPath / "commit-graph-chain");
+
+        for (const auto layerHashRange : chainContent | std::views::split('\n'))
+        {
+            const auto layerHash = std::string_view{ layerHashRange.begin(), layerHashRange.end() };
+            if (layerHash.empty())
+            {
+                continue;
+            }
+
+            // Broken layer stays in layers (so it's unmapped below), whole chain is rejected, as commits of upper layers can't be found without it
+            if (!loadLayer(chainDirectoryPath / ("graph-" + std::string{ layerHash } + ".graph")))
+            {
+                valid = false;
+                break;
+            }
+
+            // Base graphs recorded by the layer have to be exactly the previous layers of the chain
+            const auto& layer = layers.back();
+            const auto baseGraphsCount = static_cast<std::size_t>(static_cast<unsigned char>(layer.data[7]));
+            valid = baseGraphsCount == layers.size() - 1;
+            if (!valid)
+            {
+                break;
+            }
+        }
+
+        valid = valid && !layers.empty();
+    }
+
+    if (!valid)
+    {
+        for (const auto& layer : layers)
+        {
+            munmap(const_cast<char*>(layer.data), layer.size); // NOLINT(cppcoreguidelines-pro-type-const-cast)
+        }
+        layers.clear();
+        commitsCount = 0;
+        return;
+    }
+
+    // Corrected commit dates can only be compared if every layer has them
+    correctedCommitDates = std::ranges::all_of(layers, [](const Layer& layer) { return layer.generationData != nullptr; });
+}
+
+CommitGraphReader::~CommitGraphReader()
+{
+    for (const auto& layer : layers)
+    {
+        munmap(const_cast<char*>(layer.data), layer.size); // NOLINT(cppcoreguidelines-pro-type-const-cast)
+    }
+}
+
+auto CommitGraphReader::isValid() const -> bool
+{
+    return valid;
+}
+
+auto CommitGraphReader::getCommitsCount() const -> std::uint32_t
+{
+    return commitsCount;
+}
+
+auto CommitGraphReader::getLayersCount() const -> std::size_t
+{
+    return layers.size();
+}
+
+auto CommitGraphReader::hasCorrectedCommitDates() const -> bool
+{
+    return correctedCommitDates;
+}
+
+auto CommitGraphReader::findCommit(const std::string_view commitHash) const -> std::optional<std::uint32_t>
+{
+    if (!valid || commitHash.size() != hashSize * 2)
+    {
+        return std::nullopt;
+    }
+
+    const auto commitId = ObjectId::fromHex(commitHash);
+    if (commitId.isEmpty())
+    {
+        return std::nullopt;
+    }
+
+    const auto commitIdBytes = commitId.getBytes();
+    const auto firstByte = commitIdBytes[0];
+    for (const auto& layer : layers)
+    {
+        const auto begin = firstByte == 0 ? 0 : readUint32(layer.fanout + ((firstByte - 1) * 4));
+        const auto end = readUint32(layer.fanout + (firstByte * 4));
+
+        auto low = begin;
+        auto high = end;
+        while (low < high)
+        {
+            const auto middle = low + ((high - low) / 2);
+            const auto comparison = std::memcmp(layer.lookup + (middle * hashSize), commitIdBytes.data(), hashSize);
+            if (comparison == 0)
+            {
+                return layer.commitsInBase + middle;
+            }
+
+            if (comparison < 0)
+            {
+                low = middle + 1;
+            }
+            else
+            {
+                high = middle;
+            }
+        }
+    }
+
+    return std::nullopt;
+}
+
+auto CommitGraphReader::getCommitHash(const std::uint32_t position) const -> std::string
+{
+    const auto& layer = getLayer(position);
+    return toHex(layer.lookup + ((position - layer.commitsInBase) * hashSize), hashSize);
+}
+
+auto CommitGraphReader::getTreeHash(const std::uint32_t position) const -> std::string
+{
+    return toHex(getCommitData(position), hashSize);
+}
+
+auto CommitGraphReader::getParents(const std::uint32_t position) const -> std::vector<std::uint32_t>
+{
+    auto parents = std::vector<std::uint32_t>{};
+    appendParents(position, parents);
+    return parents;
+}
+
+auto CommitGraphReader::appendParents(const std::uint32_t position, std::vector<std::uint32_t>& parents) const -> void
+{
+    const auto* const commitData = getCommitData(position);
+    const auto firstParent = readUint32(commitData + hashSize);
+    if (firstParent == NO_PARENT)
+    {
+        return;
+    }
+
+    const auto checkPosition = [this](const std::uint32_t parentPosition) {
+        if (parentPosition >= commitsCount)
+        {
+            throw std::runtime_error("Corrupted commit-graph: invalid parent position");
+        }
+        return parentPosition;
+    };
+
+    parents.push_back(checkPosition(firstParent));
+
+    const auto secondParent = readUint32(commitData + hashSize + 4);
+    if (secondParent == NO_PARENT)
+    {
+        return;
+    }
+
+    if ((secondParent & EXTRA_EDGES_FLAG) == 0)
+    {
+        parents.push_back(checkPosition(secondParent));
+        return;
+    }
+
+    // Octopus merge, the rest of parents is stored in the extra edges list, the last one is marked
+    const auto& layer = getLayer(position);
+    for (auto edgeIndex = std::size_t{ secondParent & EDGE_VALUE_MASK };; ++edgeIndex)
+    {
+        if (edgeIndex >= layer.extraEdgesCount)
+        {
+            throw std::runtime_error("Corrupted commit-graph: invalid extra edge");
+        }
+
+        const auto edge = readUint32(layer.extraEdges + (edgeIndex * 4));
+        parents.push_back(checkPosition(edge & EDGE_VALUE_MASK));
+        if ((edge & LAST_EDGE_FLAG) != 0)
+        {
+            break;
+        }
+    }
+}
+
+auto CommitGraphReader::getFirstParent(const std::uint32_t position) const -> std::uint32_t
+{
+    return readUint32(getCommitData(position) + hashSize);
+}
+
+auto CommitGraphReader::getCommitTime(const std::uint32_t position) const -> std::uint64_t
+{
+    // Upper 30 bits of the first word are the topological level, remaining 34 bits are the commit time
+    const auto* const commitData = getCommitData(position);
+    return ((std::uint64_t{ readUint32(commitData + hashSize + 8) } & 0x3U) << 32U) | std::uint64_t{ readUint32(commitData + hashSize + 12) };
+}
+
+auto CommitGraphReader::getTopologicalLevel(const std::uint32_t position) const -> std::uint32_t
+{
+    return readUint32(getCommitData(position) + hashSize + 8) >> 2U;
+}
+
+auto CommitGraphReader::getGeneration(const std::uint32_t position) const -> std::uint64_t
+{
+    if (!correctedCommitDates)
+    {
+        return getTopologicalLevel(position);
+    }
+
+    const auto& layer = getLayer(position);
+    const auto offset = readUint32(layer.generationData + (std::size_t{ position - layer.commitsInBase } * 4));
+    if ((offset & GENERATION_OVERFLOW_FLAG) == 0)
+    {
+        return getCommitTime(position) + offset;
+    }
+
+    const auto overflowIndex = std::size_t{ offset & ~GENERATION_OVERFLOW_FLAG };
+    if (overflowIndex >= layer.generationOverflowCount)
+    {
+        throw std::runtime_error("Corrupted commit-graph: invalid generation overflow");
+    }
+
+    return getCommitTime(position) + readUint64(layer.generationOverflow + (overflowIndex * 8));
+}
+
+auto CommitGraphReader::loadLayer(const std::filesystem::path& graphPath) -> bool
+{
+    const auto fileDescriptor = open(graphPath.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fileDescriptor == -1)
+    {
+        return false;
+    }
+
+    struct stat fileStat{};
+    if (fstat(fileDescriptor, &fileStat) == -1 || fileStat.st_size <= 0)
+    {
+        close(fileDescriptor);
+        return false;
+    }
+
+    auto* const mapping = mmap(nullptr, static_cast<std::size_t>(fileStat.st_size), PROT_READ, MAP_PRIVATE, fileDescriptor, 0);
+    close(fileDescriptor);
+    if (mapping == MAP_FAILED)
+    {
+        return false;
+    }
+
+    // Layer is stored before parsing, so the mapping is released by the destructor even if it's not valid
+    auto& layer = layers.emplace_back();
+    layer.data = static_cast<const char*>(mapping);
+    layer.size = static_cast<std::size_t>(fileStat.st_size);
+    layer.commitsInBase = commitsCount;
+
+    if (!parseLayer(layer))
+    {
+        return false;
+    }
+
+    commitsCount += layer.commitsCount;
+    return true;
+}
+
+auto CommitGraphReader::parseLayer(Layer& layer) -> bool
+{
+    if (layer.size < HEADER_SIZE || std::memcmp(layer.data, "CGPH", 4) != 0 || layer.data[4] != 1)
+    {
+        return false;
+    }
+
+    const auto layerHashSize = layer.data[5] == 1 ? ObjectId::SHA1_SIZE : (layer.data[5] == 2 ? ObjectId::SHA256_SIZE : 0);
+    if (layerHashSize == 0 || (hashSize != 0 && hashSize != layerHashSize))
+    {
+        return false;
+    }
+    hashSize = layerHashSize;
+
+    const auto chunksCount = static_cast<std::size_t>(static_cast<unsigned char>(layer.data[6]));
+    const auto baseGraphsCount = static_cast<std::size_t>(static_cast<unsigned char>(layer.data[7]));
+    const auto chunksEnd = layer.size - std::min(layer.size, hashSize);
+    if (HEADER_SIZE + ((chunksCount + 1) * CHUNK_LOOKUP_ENTRY_SIZE) > chunksEnd)
+    {
+        return false;
+    }
+
+    auto fanoutSize = std::size_t{ 0 };
+    auto lookupSize = std::size_t{ 0 };
+    auto commitDataSize = std::size_t{ 0 };
+    auto extraEdgesSize = std::size_t{ 0 };
+    auto generationDataSize = std::size_t{ 0 };
+    auto generationOverflowSize = std::size_t{ 0 };
+    auto baseGraphsSize = std::size_t{ 0 };
+
+    for (auto i = std::size_t{ 0 }; i < chunksCount; ++i)
+    {
+        const auto* const entry = layer.data + HEADER_SIZE + (i * CHUNK_LOOKUP_ENTRY_SIZE);
+        const auto chunkId = readUint32(entry);
+        const auto chunkOffset = readUint64(entry + 4);
+        const auto nextChunkOffset = readUint64(entry + CHUNK_LOOKUP_ENTRY_SIZE + 4);
+        if (chunkOffset > nextChunkOffset || nextChunkOffset > chunksEnd)
+        {
+            return false;
+        }
+
+        const auto* const chunk = layer.data + chunkOffset;
+        const auto chunkSize = static_cast<std::size_t>(nextChunkOffset - chunkOffset);
+        switch (chunkId)
+        {
+        case CHUNK_FANOUT:
+            layer.fanout = chunk;
+            fanoutSize = chunkSize;
+            break;
+        case CHUNK_LOOKUP:
+            layer.lookup = chunk;
+            lookupSize = chunkSize;
+            break;
+        case CHUNK_COMMIT_DATA:
+            layer.commitData = chunk;
+            commitDataSize = chunkSize;
+            break;
+        case CHUNK_EXTRA_EDGES:
+            layer.extraEdges = chunk;
+            extraEdgesSize = chunkSize;
+            break;
+        case CHUNK_GENERATION_DATA:
+            layer.generationData = chunk;
+            generationDataSize = chunkSize;
+            break;
+        case CHUNK_GENERATION_OVERFLOW:
+            layer.generationOverflow = chunk;
+            generationOverflowSize = chunkSize;
+            break;
+        case CHUNK_BASE_GRAPHS:
+            baseGraphsSize = chunkSize;
+            break;
+        default:
+            // Chunks unknown to this reader (e.g. bloom filters) aren't needed for the graph walks
+            break;
+        }
+    }
+
+    if (layer.fanout == nullptr || fanoutSize != FANOUT_SIZE || layer.lookup == nullptr || layer.commitData == nullptr || baseGraphsSize != baseGraphsCount * hashSize)
+    {
+        return false;
+    }
+
+    // Fanout has to be non-decreasing, otherwise lookups could go out of the OIDL chunk
+    auto previousFanoutValue = std::uint32_t{ 0 };
+    for (auto i = std::size_t{ 0 }; i < FANOUT_SIZE; i += 4)
+    {
+        const auto fanoutValue = readUint32(layer.fanout + i);
+        if (fanoutValue < previousFanoutValue)
+        {
+            return false;
+        }
+        previousFanoutValue = fanoutValue;
+    }
+
+    layer.commitsCount = previousFanoutValue;
+    if (lookupSize != std::size_t{ layer.commitsCount } * hashSize || commitDataSize != std::size_t{ layer.commitsCount } * (hashSize + COMMIT_DATA_EXTRA_SIZE)
+        || std::uint64_t{ commitsCount } + layer.commitsCount >= NO_PARENT)
+    {
+        return false;
+    }
+
+    layer.extraEdgesCount = extraEdgesSize / 4;
+
+    if (layer.generationData != nullptr && generationDataSize != std::size_t{ layer.commitsCount } * 4)
+    {
+        layer.generationData = nullptr;
+    }
+    layer.generationOverflowCount = generationOverflowSize / 8;
+
+    return true;
+}
+
+auto CommitGraphReader::getLayer(const std::uint32_t position) const -> const Layer&
+{
+    if (position >= commitsCount)
+    {
+        throw std::out_of_range("Commit position out of the commit-graph");
+    }
+
+    // Chains are short (git merges layers), so linear search from the top layer is the fastest
+    for (const auto& layer : layers | std::views::reverse)
+    {
+        if (position >= layer.commitsInBase)
+        {
+            return layer;
+        }
+    }
+
+    return layers.front();
+}
+
+auto CommitGraphReader::getCommitData(const std::uint32_t position) const -> const char*
+{
+    const auto& layer = getLayer(position);
+    return layer.commitData + (std::size_t{ position - layer.commitsInBase } * (hashSize + COMMIT_DATA_EXTRA_SIZE));
+}
+
+} // namespace CppGit::_details
@@ -29,11 +29,8 @@ auto DiffApplier::applyDiff(const std::string_view commitHash) const -> ApplyDif
 
     createMissingFilesThatOccurInPatch(diff);
 
-    const auto patchDiffPath = repository->getGitDirectoryPath() / "patch.diff";
-
-    _details::FileUtility::createOrOverwriteFile(patchDiffPath, std::move(diff));
-    auto applyOutput = repository->executeGitCommand("apply", "--cached", "--3way", patchDiffPath);
-    std::filesystem::remove(patchDiffPath);
+    // Patch is piped straight to git apply, so it never touches the disk
+    auto applyOutput = repository->executeGitCommandWithInput(diff, "apply", "--cached", "--3way");
     IndexWorktreeManager{ *repository }.copyForceIndexToWorktree();
 
     if (applyOutput.return_code == 0)
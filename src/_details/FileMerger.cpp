@@ -0,0 +1,386 @@
+#include "CppGit/_details/FileMerger.hpp"
+
+#include "CppGit/_details/LineDiff.hpp"
+#include "CppGit/_details/UnifiedDiffBuilder.hpp"
+
+#include <cctype>
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace CppGit::_details {
+
+auto FileMerger::mergeFile(const std::string_view base, const std::string_view ours, const std::string_view theirs, const std::string_view oursLabel, const std::string_view theirsLabel) -> FileMergeResult
+{
+    // git merge-file refuses to merge binary files, our side is kept as it is and the file stays conflicted
+    if (UnifiedDiffBuilder::isBinary(base) || UnifiedDiffBuilder::isBinary(ours) || UnifiedDiffBuilder::isBinary(theirs))
+    {
+        return FileMergeResult{ .content = std::string{ ours }, .conflictsCount = 1 };
+    }
+
+    const auto files = MergeFiles{ .base = LineDiff::splitLines(base),
+                                   .ours = LineDiff::splitLines(ours),
+                                   .theirs = LineDiff::splitLines(theirs) };
+
+    const auto oursChanges = LineDiff::diff(files.base, files.ours);
+    const auto theirsChanges = LineDiff::diff(files.base, files.theirs);
+
+    if (oursChanges.empty())
+    {
+        return FileMergeResult{ .content = std::string{ theirs }, .conflictsCount = 0 };
+    }
+
+    if (theirsChanges.empty())
+    {
+        return FileMergeResult{ .content = std::string{ ours }, .conflictsCount = 0 };
+    }
+
+    auto hunks = refineConflicts(files, createHunks(files, oursChanges, theirsChanges));
+    simplifyNonConflicts(files, hunks);
+
+    return fillMergeResult(files, hunks, oursLabel, theirsLabel);
+}
+
+auto FileMerger::createHunks(const MergeFiles& files, const std::vector<LineDiffChange>& oursChanges, const std::vector<LineDiffChange>& theirsChanges) -> std::vector<MergeHunk>
+{
+    // Line positions of a change on the side that didn't change the lines are derived from the offset of the other side's next change
+    const auto toSigned = [](const std::size_t value) { return static_cast<std::ptrdiff_t>(value); };
+
+    auto hunks = std::vector<MergeHunk>{};
+    auto oursIt = oursChanges.begin();
+    auto theirsIt = theirsChanges.begin();
+
+    while (oursIt != oursChanges.end() && theirsIt != theirsChanges.end())
+    {
+        const auto oursBaseStart = toSigned(oursIt->oldStart);
+        const auto oursBaseEnd = oursBaseStart + toSigned(oursIt->oldCount);
+        const auto theirsBaseStart = toSigned(theirsIt->oldStart);
+        const auto theirsBaseEnd = theirsBaseStart + toSigned(theirsIt->oldCount);
+
+        if (oursBaseEnd < theirsBaseStart)
+        {
+            appendHunk(hunks, MergeHunk{ .mode = HunkMode::OURS,
+                                         .baseStart = oursBaseStart,
+                                         .baseCount = toSigned(oursIt->oldCount),
+                                         .oursStart = toSigned(oursIt->newStart),
+                                         .oursCount = toSigned(oursIt->newCount),
+                                         .theirsStart = toSigned(theirsIt->newStart) - theirsBaseStart + oursBaseStart,
+                                         .theirsCount = toSigned(oursIt->oldCount) });
+            ++oursIt;
+            continue;
+        }
+
+        if (theirsBaseEnd < oursBaseStart)
+        {
+            appendHunk(hunks, MergeHunk{ .mode = HunkMode::THEIRS,
+                                         .baseStart = theirsBaseStart,
+                                         .baseCount = toSigned(theirsIt->oldCount),
+                                         .oursStart = toSigned(oursIt->newStart) - oursBaseStart + theirsBaseStart,
+                                         .oursCount = toSigned(theirsIt->oldCount),
+                                         .theirsStart = toSigned(theirsIt->newStart),
+                                         .theirsCount = toSigned(theirsIt->newCount) });
+            ++theirsIt;
+            continue;
+        }
+
+        if (oursIt->oldStart != theirsIt->oldStart || oursIt->oldCount != theirsIt->oldCount || oursIt->newCount != theirsIt->newCount
+            || !linesEqual(files.ours, toSigned(oursIt->newStart), files.theirs, toSigned(theirsIt->newStart), toSigned(oursIt->newCount)))
+        {
+            // Overlapping changes, the conflict covers both of them
+            const auto startOffset = oursBaseStart - theirsBaseStart;
+            const auto endOffset = oursBaseEnd - theirsBaseEnd;
+
+            auto hunk = MergeHunk{ .mode = HunkMode::CONFLICT,
+                                   .baseStart = oursBaseStart,
+                                   .baseCount = 0,
+                                   .oursStart = toSigned(oursIt->newStart),
+                                   .oursCount = 0,
+                                   .theirsStart = toSigned(theirsIt->newStart),
+                                   .theirsCount = 0 };
+            if (startOffset > 0)
+            {
+                hunk.baseStart -= startOffset;
+                hunk.oursStart -= startOffset;
+            }
+            else
+            {
+                hunk.theirsStart += startOffset;
+            }
+
+            hunk.baseCount = oursBaseEnd - hunk.baseStart;
+            hunk.oursCount = toSigned(oursIt->newStart + oursIt->newCount) - hunk.oursStart;
+            hunk.theirsCount = toSigned(theirsIt->newStart + theirsIt->newCount) - hunk.theirsStart;
+            if (endOffset < 0)
+            {
+                hunk.baseCount -= endOffset;
+                hunk.oursCount -= endOffset;
+            }
+            else
+            {
+                hunk.theirsCount += endOffset;
+            }
+
+            appendHunk(hunks, hunk);
+        }
+
+        if (oursBaseEnd >= theirsBaseEnd)
+        {
+            ++theirsIt;
+        }
+        if (theirsBaseEnd >= oursBaseEnd)
+        {
+            ++oursIt;
+        }
+    }
+
+    const auto oursSizeDifference = toSigned(files.ours.size()) - toSigned(files.base.size());
+    const auto theirsSizeDifference = toSigned(files.theirs.size()) - toSigned(files.base.size());
+
+    for (; oursIt != oursChanges.end(); ++oursIt)
+    {
+        appendHunk(hunks, MergeHunk{ .mode = HunkMode::OURS,
+                                     .baseStart = toSigned(oursIt->oldStart),
+                                     .baseCount = toSigned(oursIt->oldCount),
+                                     .oursStart = toSigned(oursIt->newStart),
+                                     .oursCount = toSigned(oursIt->newCount),
+                                     .theirsStart = toSigned(oursIt->oldStart) + theirsSizeDifference,
+                                     .theirsCount = toSigned(oursIt->oldCount) });
+    }
+
+    for (; theirsIt != theirsChanges.end(); ++theirsIt)
+    {
+        appendHunk(hunks, MergeHunk{ .mode = HunkMode::THEIRS,
+                                     .baseStart = toSigned(theirsIt->oldStart),
+                                     .baseCount = toSigned(theirsIt->oldCount),
+                                     .oursStart = toSigned(theirsIt->oldStart) + oursSizeDifference,
+                                     .oursCount = toSigned(theirsIt->oldCount),
+                                     .theirsStart = toSigned(theirsIt->newStart),
+                                     .theirsCount = toSigned(theirsIt->newCount) });
+    }
+
+    return hunks;
+}
+
+auto FileMerger::appendHunk(std::vector<MergeHunk>& hunks, const MergeHunk& hunk) -> void
+{
+    if (!hunks.empty())
+    {
+        auto& lastHunk = hunks.back();
+        if (hunk.oursStart <= lastHunk.oursStart + lastHunk.oursCount || hunk.theirsStart <= lastHunk.theirsStart + lastHunk.theirsCount)
+        {
+            if (hunk.mode != lastHunk.mode)
+            {
+                lastHunk.mode = HunkMode::CONFLICT;
+            }
+            lastHunk.baseCount = hunk.baseStart + hunk.baseCount - lastHunk.baseStart;
+            lastHunk.oursCount = hunk.oursStart + hunk.oursCount - lastHunk.oursStart;
+            lastHunk.theirsCount = hunk.theirsStart + hunk.theirsCount - lastHunk.theirsStart;
+
+            return;
+        }
+    }
+
+    hunks.push_back(hunk);
+}
+
+auto FileMerger::refineConflicts(const MergeFiles& files, const std::vector<MergeHunk>& hunks) -> std::vector<MergeHunk>
+{
+    auto refinedHunks = std::vector<MergeHunk>{};
+    refinedHunks.reserve(hunks.size());
+
+    for (auto hunk : hunks)
+    {
+        // There is no sense in refining a conflict when one side is empty
+        if (hunk.mode != HunkMode::CONFLICT || hunk.oursCount == 0 || hunk.theirsCount == 0)
+        {
+            refinedHunks.push_back(hunk);
+            continue;
+        }
+
+        const auto oursLines = std::vector<std::string_view>(files.ours.begin() + hunk.oursStart, files.ours.begin() + hunk.oursStart + hunk.oursCount);
+        const auto theirsLines = std::vector<std::string_view>(files.theirs.begin() + hunk.theirsStart, files.theirs.begin() + hunk.theirsStart + hunk.theirsCount);
+        const auto changes = LineDiff::diff(oursLines, theirsLines);
+
+        if (changes.empty())
+        {
+            hunk.mode = HunkMode::IDENTICAL;
+            refinedHunks.push_back(hunk);
+            continue;
+        }
+
+        for (const auto& change : changes)
+        {
+            refinedHunks.push_back(MergeHunk{ .mode = HunkMode::CONFLICT,
+                                              .baseStart = hunk.baseStart,
+                                              .baseCount = hunk.baseCount,
+                                              .oursStart = hunk.oursStart + static_cast<std::ptrdiff_t>(change.oldStart),
+                                              .oursCount = static_cast<std::ptrdiff_t>(change.oldCount),
+                                              .theirsStart = hunk.theirsStart + static_cast<std::ptrdiff_t>(change.newStart),
+                                              .theirsCount = static_cast<std::ptrdiff_t>(change.newCount) });
+        }
+    }
+
+    return refinedHunks;
+}
+
+auto FileMerger::simplifyNonConflicts(const MergeFiles& files, std::vector<MergeHunk>& hunks) -> void
+{
+    // Conflicts separated by a few lines, or by lines without any letter or digit, are joined into one
+    auto hunkIndex = std::size_t{ 0 };
+    while (hunkIndex + 1 < hunks.size())
+    {
+        auto& hunk = hunks[hunkIndex];
+        const auto& nextHunk = hunks[hunkIndex + 1];
+        const auto gapStart = hunk.oursStart + hunk.oursCount;
+        const auto gapEnd = nextHunk.oursStart;
+
+        if (hunk.mode != HunkMode::CONFLICT || nextHunk.mode != HunkMode::CONFLICT
+            || (gapEnd - gapStart > MAX_SIMPLIFIED_GAP && linesContainAlnum(files.ours, gapStart, gapEnd - gapStart)))
+        {
+            ++hunkIndex;
+            continue;
+        }
+
+        hunk.oursCount = nextHunk.oursStart + nextHunk.oursCount - hunk.oursStart;
+        hunk.theirsCount = nextHunk.theirsStart + nextHunk.theirsCount - hunk.theirsStart;
+        hunks.erase(hunks.begin() + static_cast<std::ptrdiff_t>(hunkIndex) + 1);
+    }
+}
+
+auto FileMerger::fillMergeResult(const MergeFiles& files, const std::vector<MergeHunk>& hunks, const std::string_view oursLabel, const std::string_view theirsLabel) -> FileMergeResult
+{
+    auto result = FileMergeResult{ .content = std::string{}, .conflictsCount = 0 };
+    auto oursIndex = std::ptrdiff_t{ 0 };
+
+    for (const auto& hunk : hunks)
+    {
+        if (hunk.mode == HunkMode::IDENTICAL)
+        {
+            continue;
+        }
+
+        appendLines(result.content, files.ours, oursIndex, hunk.oursStart - oursIndex, false, false);
+
+        if (hunk.mode == HunkMode::CONFLICT)
+        {
+            ++result.conflictsCount;
+            const auto crLf = isCrLfNeeded(files, hunk);
+            const auto* const endOfLine = crLf ? "\r\n" : "\n";
+
+            result.content.append(MARKER_SIZE, '<').append(" ").append(oursLabel).append(endOfLine);
+            appendLines(result.content, files.ours, hunk.oursStart, hunk.oursCount, crLf, true);
+            result.content.append(MARKER_SIZE, '=').append(endOfLine);
+            appendLines(result.content, files.theirs, hunk.theirsStart, hunk.theirsCount, crLf, true);
+            result.content.append(MARKER_SIZE, '>').append(" ").append(theirsLabel).append(endOfLine);
+        }
+        else if (hunk.mode == HunkMode::OURS)
+        {
+            appendLines(result.content, files.ours, hunk.oursStart, hunk.oursCount, false, false);
+        }
+        else
+        {
+            appendLines(result.content, files.theirs, hunk.theirsStart, hunk.theirsCount, false, false);
+        }
+
+        oursIndex = hunk.oursStart + hunk.oursCount;
+    }
+
+    appendLines(result.content, files.ours, oursIndex, static_cast<std::ptrdiff_t>(files.ours.size()) - oursIndex, false, false);
+
+    return result;
+}
+
+auto FileMerger::linesEqual(const std::vector<std::string_view>& lines, const std::ptrdiff_t start, const std::vector<std::string_view>& otherLines, const std::ptrdiff_t otherStart, const std::ptrdiff_t count) -> bool
+{
+    for (auto i = std::ptrdiff_t{ 0 }; i < count; ++i)
+    {
+        if (lines[static_cast<std::size_t>(start + i)] != otherLines[static_cast<std::size_t>(otherStart + i)])
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+auto FileMerger::linesContainAlnum(const std::vector<std::string_view>& lines, const std::ptrdiff_t start, const std::ptrdiff_t count) -> bool
+{
+    for (auto i = start; i < start + count; ++i)
+    {
+        for (const auto character : lines[static_cast<std::size_t>(i)])
+        {
+            if (std::isalnum(static_cast<unsigned char>(character)) != 0)
+            {
+                return true;
+            }
+        }
+    }
+
+    return false;
+}
+
+auto FileMerger::isCrLfNeeded(const MergeFiles& files, const MergeHunk& hunk) -> bool
+{
+    // Match the end of line style of lines preceding the conflict (or the first lines), look at the base if still undecided
+    auto crLfNeeded = isEolCrLf(files.ours, hunk.oursStart != 0 ? hunk.oursStart - 1 : 0);
+    if (crLfNeeded != 0)
+    {
+        crLfNeeded = isEolCrLf(files.theirs, hunk.theirsStart != 0 ? hunk.theirsStart - 1 : 0);
+    }
+    if (crLfNeeded != 0)
+    {
+        crLfNeeded = isEolCrLf(files.base, 0);
+    }
+
+    return crLfNeeded > 0;
+}
+
+auto FileMerger::isEolCrLf(const std::vector<std::string_view>& lines, const std::ptrdiff_t index) -> int
+{
+    // Returns 1 for CRLF, 0 for LF and -1 if it can't be determined
+    const auto endsWithCrLf = [](const std::string_view line) { return line.ends_with("\r\n") ? 1 : 0; };
+    const auto linesCount = static_cast<std::ptrdiff_t>(lines.size());
+
+    if (index < linesCount - 1)
+    {
+        return endsWithCrLf(lines[static_cast<std::size_t>(index)]);
+    }
+
+    if (linesCount == 0)
+    {
+        return -1;
+    }
+
+    if (const auto line = lines[static_cast<std::size_t>(index)]; line.ends_with('\n'))
+    {
+        return endsWithCrLf(line);
+    }
+
+    if (index == 0)
+    {
+        return -1;
+    }
+
+    return endsWithCrLf(lines[static_cast<std::size_t>(index - 1)]);
+}
+
+auto FileMerger::appendLines(std::string& result, const std::vector<std::string_view>& lines, const std::ptrdiff_t start, const std::ptrdiff_t count, const bool crLf, const bool addNewLine) -> void
+{
+    if (count < 1)
+    {
+        return;
+    }
+
+    for (auto i = start; i < start + count; ++i)
+    {
+        result.append(lines[static_cast<std::size_t>(i)]);
+    }
+
+    if (addNewLine && !lines[static_cast<std::size_t>(start + count - 1)].ends_with('\n'))
+    {
+        result.append(crLf ? "\r\n" : "\n");
+    }
+}
+
+} // namespace CppGit::_details
@@ -1,7 +1,9 @@
 #include "CppGit/_details/GitCommandExecutor/GitCommandExecutor.hpp"
 
 #include "CppGit/_details/GitCommandExecutor/GitCommandOutput.hpp"
+#include "CppGit/_details/GitCommandExecutor/GitCommandSession.hpp"
 
+#include <memory>
 #include <string>
 #include <string_view>
 #include <vector>
@@ -13,6 +15,23 @@ auto GitCommandExecutor::execute(const std::vector<std::string>& environmentVari
     return executeImpl(environmentVariables, repoPath, command, args);
 }
 
+auto GitCommandExecutor::executeStreaming(const std::vector<std::string>& environmentVariables, const std::string_view repoPath, const StdoutConsumer& stdoutConsumer, const std::string_view command, const std::vector<std::string>& args) -> GitCommandOutput
+{
+    return executeStreamingImpl(environmentVariables, repoPath, stdoutConsumer, command, args);
+}
+
+auto GitCommandExecutor::executeWithInput(const std::vector<std::string>& environmentVariables, const std::string_view repoPath, const std::string_view input, const std::string_view command, const std::vector<std::string>& args) -> GitCommandOutput
+{
+    return executeWithInputImpl(environmentVariables, repoPath, input, command, args);
+}
+
+auto GitCommandExecutor::startSession(const std::vector<std::string>& environmentVariables, const std::string_view repoPath, const std::string_view command, const std::vector<std::string>& args) -> std::unique_ptr<GitCommandSession>
+{
+    return startSessionImpl(environmentVariables, repoPath, command, args);
+}
+
 GitCommandExecutor::~GitCommandExecutor() = default;
 
+GitCommandSession::~GitCommandSession() = default;
+
 } // namespace CppGit
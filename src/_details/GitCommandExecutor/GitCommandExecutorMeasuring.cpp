@@ -0,0 +1,134 @@
+#include "CppGit/_details/GitCommandExecutor/GitCommandExecutorMeasuring.hpp"
+
+#include "CppGit/_details/GitCommandExecutor/GitCommandMetrics.hpp"
+#include "CppGit/_details/GitCommandExecutor/GitCommandOutput.hpp"
+#include "CppGit/_details/GitCommandExecutor/GitCommandSession.hpp"
+
+#include <chrono>
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace CppGit {
+
+namespace {
+
+class GitCommandSessionMeasuring : public GitCommandSession
+{
+public:
+    GitCommandSessionMeasuring(std::unique_ptr<GitCommandSession> session, std::shared_ptr<GitCommandMetrics> metrics, const std::string_view command, const std::size_t argumentsCount)
+        : session{ std::move(session) },
+          metrics{ std::move(metrics) },
+          command{ command },
+          argumentsCount{ argumentsCount }
+    {
+    }
+
+    GitCommandSessionMeasuring(const GitCommandSessionMeasuring&) = delete;
+    GitCommandSessionMeasuring(GitCommandSessionMeasuring&&) = delete;
+    auto operator=(const GitCommandSessionMeasuring&) -> GitCommandSessionMeasuring& = delete;
+    auto operator=(GitCommandSessionMeasuring&&) -> GitCommandSessionMeasuring& = delete;
+
+    ~GitCommandSessionMeasuring() override
+    {
+        GitCommandSessionMeasuring::close();
+    }
+
+    auto write(const std::string_view data) -> bool override
+    {
+        return session->write(data);
+    }
+
+    auto read(std::string& output) -> bool override
+    {
+        const auto oldSize = output.size();
+        const auto result = session->read(output);
+        stdoutBytes += output.size() - oldSize;
+
+        return result;
+    }
+
+    auto close() -> int override
+    {
+        const auto returnCode = session->close();
+        if (!closed)
+        {
+            closed = true;
+            const auto wallTime = std::chrono::steady_clock::now() - start;
+            metrics->record(GitCommandMetric{ .command = command, .argumentsCount = argumentsCount, .wallTime = wallTime, .stdoutBytes = stdoutBytes, .stderrBytes = 0, .returnCode = returnCode });
+        }
+
+        return returnCode;
+    }
+
+private:
+    std::unique_ptr<GitCommandSession> session;
+    std::shared_ptr<GitCommandMetrics> metrics;
+    std::string command;
+    std::size_t argumentsCount;
+    std::chrono::steady_clock::time_point start{ std::chrono::steady_clock::now() };
+    std::size_t stdoutBytes{ 0 };
+    bool closed{ false };
+};
+
+} // namespace
+
+GitCommandExecutorMeasuring::GitCommandExecutorMeasuring(std::shared_ptr<GitCommandExecutor> executor, std::shared_ptr<GitCommandMetrics> metrics)
+    : executor{ std::move(executor) },
+      metrics{ std::move(metrics) }
+{
+}
+
+auto GitCommandExecutorMeasuring::getExecutor() const -> const std::shared_ptr<GitCommandExecutor>&
+{
+    return executor;
+}
+
+auto GitCommandExecutorMeasuring::executeImpl(const std::vector<std::string>& environmentVariables, const std::string_view repoPath, const std::string_view command, const std::vector<std::string>& args) -> GitCommandOutput
+{
+    const auto start = std::chrono::steady_clock::now();
+    auto output = executor->execute(environmentVariables, repoPath, command, args);
+    const auto wallTime = std::chrono::steady_clock::now() - start;
+
+    metrics->record(GitCommandMetric{ .command = command, .argumentsCount = args.size(), .wallTime = wallTime, .stdoutBytes = output.stdout.size(), .stderrBytes = output.stderr.size(), .returnCode = output.return_code });
+
+    return output;
+}
+
+auto GitCommandExecutorMeasuring::executeStreamingImpl(const std::vector<std::string>& environmentVariables, const std::string_view repoPath, const StdoutConsumer& stdoutConsumer, const std::string_view command, const std::vector<std::string>& args) -> GitCommandOutput
+{
+    auto stdoutBytes = std::size_t{ 0 };
+    const auto countingConsumer = StdoutConsumer{ [&stdoutConsumer, &stdoutBytes](const std::string_view chunk) {
+        stdoutBytes += chunk.size();
+        stdoutConsumer(chunk);
+    } };
+
+    const auto start = std::chrono::steady_clock::now();
+    auto output = executor->executeStreaming(environmentVariables, repoPath, countingConsumer, command, args);
+    const auto wallTime = std::chrono::steady_clock::now() - start;
+
+    metrics->record(GitCommandMetric{ .command = command, .argumentsCount = args.size(), .wallTime = wallTime, .stdoutBytes = stdoutBytes, .stderrBytes = output.stderr.size(), .returnCode = output.return_code });
+
+    return output;
+}
+
+auto GitCommandExecutorMeasuring::executeWithInputImpl(const std::vector<std::string>& environmentVariables, const std::string_view repoPath, const std::string_view input, const std::string_view command, const std::vector<std::string>& args) -> GitCommandOutput
+{
+    const auto start = std::chrono::steady_clock::now();
+    auto output = executor->executeWithInput(environmentVariables, repoPath, input, command, args);
+    const auto wallTime = std::chrono::steady_clock::now() - start;
+
+    metrics->record(GitCommandMetric{ .command = command, .argumentsCount = args.size(), .wallTime = wallTime, .stdoutBytes = output.stdout.size(), .stderrBytes = output.stderr.size(), .returnCode = output.return_code });
+
+    return output;
+}
+
+auto GitCommandExecutorMeasuring::startSessionImpl(const std::vector<std::string>& environmentVariables, const std::string_view repoPath, const std::string_view command, const std::vector<std::string>& args) -> std::unique_ptr<GitCommandSession>
+{
+    return std::make_unique<GitCommandSessionMeasuring>(executor->startSession(environmentVariables, repoPath, command, args), metrics, command, args.size());
+}
+
+} // namespace CppGit
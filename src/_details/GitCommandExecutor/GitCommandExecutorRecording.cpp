@@ -0,0 +1,149 @@
+#include "CppGit/_details/GitCommandExecutor/GitCommandExecutorRecording.hpp"
+
+#include "CppGit/_details/GitCommandExecutor/GitCommandOutput.hpp"
+#include "CppGit/_details/GitCommandExecutor/GitCommandRecord.hpp"
+#include "CppGit/_details/GitCommandExecutor/GitCommandSession.hpp"
+
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace CppGit {
+
+class GitCommandExecutorRecording::Session : public GitCommandSession
+{
+public:
+    Session(GitCommandExecutorRecording& recordingExecutor, std::unique_ptr<GitCommandSession> session, const std::size_t recordIndex, const std::size_t generation)
+        : recordingExecutor{ recordingExecutor },
+          session{ std::move(session) },
+          recordIndex{ recordIndex },
+          generation{ generation }
+    {
+    }
+
+    Session(const Session&) = delete;
+    Session(Session&&) = delete;
+    auto operator=(const Session&) -> Session& = delete;
+    auto operator=(Session&&) -> Session& = delete;
+
+    ~Session() override
+    {
+        Session::close();
+    }
+
+    auto write(const std::string_view data) -> bool override
+    {
+        recordingExecutor.updateRecord(recordIndex, generation, [data](GitCommandRecord& record) { record.input.append(data); });
+        return session->write(data);
+    }
+
+    auto read(std::string& output) -> bool override
+    {
+        const auto oldSize = output.size();
+        const auto result = session->read(output);
+        const auto chunk = std::string_view{ output }.substr(oldSize);
+        recordingExecutor.updateRecord(recordIndex, generation, [chunk](GitCommandRecord& record) { record.output.stdout.append(chunk); });
+
+        return result;
+    }
+
+    auto close() -> int override
+    {
+        const auto returnCode = session->close();
+        recordingExecutor.updateRecord(recordIndex, generation, [returnCode](GitCommandRecord& record) { record.output.return_code = returnCode; });
+
+        return returnCode;
+    }
+
+private:
+    GitCommandExecutorRecording& recordingExecutor;
+    std::unique_ptr<GitCommandSession> session;
+    std::size_t recordIndex;
+    std::size_t generation;
+};
+
+GitCommandExecutorRecording::GitCommandExecutorRecording(std::shared_ptr<GitCommandExecutor> executor)
+    : executor{ std::move(executor) }
+{
+}
+
+auto GitCommandExecutorRecording::getRecords() const -> std::vector<GitCommandRecord>
+{
+    const auto lock = std::lock_guard{ recordsMutex };
+    return records;
+}
+
+auto GitCommandExecutorRecording::clearRecords() -> void
+{
+    const auto lock = std::lock_guard{ recordsMutex };
+    records.clear();
+    ++recordsGeneration;
+}
+
+auto GitCommandExecutorRecording::executeImpl(const std::vector<std::string>& environmentVariables, const std::string_view repoPath, const std::string_view command, const std::vector<std::string>& args) -> GitCommandOutput
+{
+    auto output = executor->execute(environmentVariables, repoPath, command, args);
+    addRecord(environmentVariables, command, args, output);
+
+    return output;
+}
+
+auto GitCommandExecutorRecording::executeStreamingImpl(const std::vector<std::string>& environmentVariables, const std::string_view repoPath, const StdoutConsumer& stdoutConsumer, const std::string_view command, const std::vector<std::string>& args) -> GitCommandOutput
+{
+    auto streamedStdout = std::string{};
+    const auto recordingConsumer = StdoutConsumer{ [&stdoutConsumer, &streamedStdout](const std::string_view chunk) {
+        streamedStdout.append(chunk);
+        stdoutConsumer(chunk);
+    } };
+
+    auto output = executor->executeStreaming(environmentVariables, repoPath, recordingConsumer, command, args);
+
+    auto recordedOutput = output;
+    recordedOutput.stdout = std::move(streamedStdout);
+    addRecord(environmentVariables, command, args, std::move(recordedOutput));
+
+    return output;
+}
+
+auto GitCommandExecutorRecording::executeWithInputImpl(const std::vector<std::string>& environmentVariables, const std::string_view repoPath, const std::string_view input, const std::string_view command, const std::vector<std::string>& args) -> GitCommandOutput
+{
+    auto output = executor->executeWithInput(environmentVariables, repoPath, input, command, args);
+    addRecord(environmentVariables, command, args, output, input);
+
+    return output;
+}
+
+auto GitCommandExecutorRecording::startSessionImpl(const std::vector<std::string>& environmentVariables, const std::string_view repoPath, const std::string_view command, const std::vector<std::string>& args) -> std::unique_ptr<GitCommandSession>
+{
+    auto session = executor->startSession(environmentVariables, repoPath, command, args);
+
+    // Record is added when the session starts, so it is replayed in the same order relative to other commands
+    const auto lock = std::lock_guard{ recordsMutex };
+    records.emplace_back(environmentVariables, std::string{ command }, args, GitCommandOutput{}, std::string{});
+
+    return std::make_unique<Session>(*this, std::move(session), records.size() - 1, recordsGeneration);
+}
+
+auto GitCommandExecutorRecording::addRecord(const std::vector<std::string>& environmentVariables, const std::string_view command, const std::vector<std::string>& args, GitCommandOutput output, const std::string_view input) -> void
+{
+    const auto lock = std::lock_guard{ recordsMutex };
+    records.emplace_back(environmentVariables, std::string{ command }, args, std::move(output), std::string{ input });
+}
+
+auto GitCommandExecutorRecording::updateRecord(const std::size_t recordIndex, const std::size_t generation, const std::function<void(GitCommandRecord&)>& update) -> void
+{
+    const auto lock = std::lock_guard{ recordsMutex };
+
+    // Records cleared while the session was running are gone, together with the record of the session
+    if (generation == recordsGeneration)
+    {
+        update(records[recordIndex]);
+    }
+}
+
+} // namespace CppGit
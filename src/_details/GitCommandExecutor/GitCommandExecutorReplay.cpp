@@ -0,0 +1,121 @@
+#include "CppGit/_details/GitCommandExecutor/GitCommandExecutorReplay.hpp"
+
+#include "CppGit/_details/GitCommandExecutor/GitCommandOutput.hpp"
+#include "CppGit/_details/GitCommandExecutor/GitCommandRecord.hpp"
+#include "CppGit/_details/GitCommandExecutor/GitCommandSession.hpp"
+
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace CppGit {
+
+namespace {
+
+class GitCommandSessionReplay : public GitCommandSession
+{
+public:
+    explicit GitCommandSessionReplay(const GitCommandOutput& output)
+        : recordedStdout{ output.stdout },
+          returnCode{ output.return_code }
+    {
+    }
+
+    auto write(const std::string_view /*data*/) -> bool override
+    {
+        return true;
+    }
+
+    auto read(std::string& output) -> bool override
+    {
+        if (recordedStdout.empty())
+        {
+            return false;
+        }
+
+        output.append(recordedStdout);
+        recordedStdout.clear();
+
+        return true;
+    }
+
+    auto close() -> int override
+    {
+        return returnCode;
+    }
+
+private:
+    std::string recordedStdout;
+    int returnCode;
+};
+
+} // namespace
+
+GitCommandExecutorReplay::GitCommandExecutorReplay(std::vector<GitCommandRecord> records)
+    : records{ std::move(records) }
+{
+}
+
+auto GitCommandExecutorReplay::rewind() -> void
+{
+    const auto lock = std::lock_guard{ recordsMutex };
+    nextRecord = 0;
+}
+
+auto GitCommandExecutorReplay::isFinished() const -> bool
+{
+    const auto lock = std::lock_guard{ recordsMutex };
+    return nextRecord == records.size();
+}
+
+auto GitCommandExecutorReplay::executeImpl(const std::vector<std::string>& /*environmentVariables*/, const std::string_view /*repoPath*/, const std::string_view command, const std::vector<std::string>& args) -> GitCommandOutput
+{
+    return takeRecord(command, args).output;
+}
+
+auto GitCommandExecutorReplay::executeStreamingImpl(const std::vector<std::string>& /*environmentVariables*/, const std::string_view /*repoPath*/, const StdoutConsumer& stdoutConsumer, const std::string_view command, const std::vector<std::string>& args) -> GitCommandOutput
+{
+    const auto& record = takeRecord(command, args);
+
+    if (!record.output.stdout.empty())
+    {
+        stdoutConsumer(record.output.stdout);
+    }
+
+    return GitCommandOutput{ .return_code = record.output.return_code, .stdout = "", .stderr = record.output.stderr };
+}
+
+auto GitCommandExecutorReplay::executeWithInputImpl(const std::vector<std::string>& /*environmentVariables*/, const std::string_view /*repoPath*/, const std::string_view /*input*/, const std::string_view command, const std::vector<std::string>& args) -> GitCommandOutput
+{
+    return takeRecord(command, args).output;
+}
+
+auto GitCommandExecutorReplay::startSessionImpl(const std::vector<std::string>& /*environmentVariables*/, const std::string_view /*repoPath*/, const std::string_view command, const std::vector<std::string>& args) -> std::unique_ptr<GitCommandSession>
+{
+    return std::make_unique<GitCommandSessionReplay>(takeRecord(command, args).output);
+}
+
+auto GitCommandExecutorReplay::takeRecord(const std::string_view command, const std::vector<std::string>& args) -> const GitCommandRecord&
+{
+    const auto lock = std::lock_guard{ recordsMutex };
+
+    if (nextRecord == records.size())
+    {
+        throw std::runtime_error("No more recorded commands to replay");
+    }
+
+    const auto& record = records[nextRecord];
+    if (record.command != command || record.args != args)
+    {
+        throw std::runtime_error("Executed command doesn't match the recorded one: " + record.command);
+    }
+
+    ++nextRecord;
+    return record;
+}
+
+} // namespace CppGit
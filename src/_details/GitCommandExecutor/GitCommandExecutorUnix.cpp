@@ -1,28 +1,271 @@
 #include "CppGit/_details/GitCommandExecutor/GitCommandExecutorUnix.hpp"
 
 #include "CppGit/_details/GitCommandExecutor/GitCommandOutput.hpp"
+#include "CppGit/_details/GitCommandExecutor/GitCommandSession.hpp"
 
+#include <algorithm>
 #include <array>
+#include <cerrno>
+#include <csignal>
 #include <cstddef>
 #include <cstdio>
 #include <cstdlib>
 #include <fcntl.h>
+#include <memory>
+#include <optional>
+#include <poll.h>
+#include <spawn.h>
 #include <stdexcept>
 #include <string>
 #include <string_view>
+#include <sys/socket.h>
 #include <sys/types.h>
 #include <sys/wait.h>
 #include <unistd.h>
+#include <utility>
 #include <vector>
 
 namespace CppGit {
 
+namespace {
+
+class GitCommandSessionUnix : public GitCommandSession
+{
+public:
+    GitCommandSessionUnix(const pid_t pid, const int stdinSocket, const int stdoutPipe)
+        : pid{ pid },
+          stdinSocket{ stdinSocket },
+          stdoutPipe{ stdoutPipe }
+    {
+    }
+
+    GitCommandSessionUnix(const GitCommandSessionUnix&) = delete;
+    GitCommandSessionUnix(GitCommandSessionUnix&&) = delete;
+    auto operator=(const GitCommandSessionUnix&) -> GitCommandSessionUnix& = delete;
+    auto operator=(GitCommandSessionUnix&&) -> GitCommandSessionUnix& = delete;
+
+    ~GitCommandSessionUnix() override
+    {
+        GitCommandSessionUnix::close();
+    }
+
+    auto write(const std::string_view data) -> bool override
+    {
+        auto remainingData = data;
+        while (!remainingData.empty())
+        {
+            const auto bytesWritten = send(stdinSocket, remainingData.data(), remainingData.size(), MSG_NOSIGNAL);
+            if (bytesWritten == -1)
+            {
+                if (errno == EINTR)
+                {
+                    continue;
+                }
+                return false;
+            }
+            remainingData.remove_prefix(static_cast<std::size_t>(bytesWritten));
+        }
+
+        return true;
+    }
+
+    auto read(std::string& output) -> bool override
+    {
+        constexpr auto CHUNK_SIZE = std::size_t{ 64 * 1024 };
+
+        const auto oldSize = output.size();
+        output.resize(oldSize + CHUNK_SIZE);
+
+        ssize_t bytesRead{};
+        do
+        {
+            bytesRead = ::read(stdoutPipe, output.data() + oldSize, CHUNK_SIZE);
+        } while (bytesRead == -1 && errno == EINTR);
+
+        if (bytesRead <= 0)
+        {
+            output.resize(oldSize);
+            return false;
+        }
+
+        output.resize(oldSize + static_cast<std::size_t>(bytesRead));
+        return true;
+    }
+
+    auto close() -> int override
+    {
+        if (pid == -1)
+        {
+            return returnCode;
+        }
+
+        // EOF on the standard input makes git exit, closing the output as well doesn't let it block on writing an answer nobody reads
+        ::close(stdinSocket);
+        ::close(stdoutPipe);
+
+        int status{};
+        while (waitpid(pid, &status, 0) == -1 && errno == EINTR)
+        {
+        }
+        pid = -1;
+        returnCode = WEXITSTATUS(status);
+
+        return returnCode;
+    }
+
+private:
+    pid_t pid;
+    int stdinSocket;
+    int stdoutPipe;
+    int returnCode{ 0 };
+};
+
+} // namespace
+
+GitCommandExecutorUnix::GitCommandExecutorUnix(const LaunchMethod launchMethod)
+    : launchMethod{ launchMethod }
+{
+}
+
 auto GitCommandExecutorUnix::executeImpl(const std::vector<std::string>& environmentVariables, const std::string_view repoPath, const std::string_view command, const std::vector<std::string>& args) -> GitCommandOutput
 {
-    createPipes();
+    // Process state lives in a fresh instance, so one executor can be shared and used concurrently
+    auto processExecutor = GitCommandExecutorUnix{ launchMethod };
+    return processExecutor.run(environmentVariables, repoPath, command, args, nullptr, std::nullopt);
+}
+
+auto GitCommandExecutorUnix::executeStreamingImpl(const std::vector<std::string>& environmentVariables, const std::string_view repoPath, const StdoutConsumer& stdoutConsumer, const std::string_view command, const std::vector<std::string>& args) -> GitCommandOutput
+{
+    auto processExecutor = GitCommandExecutorUnix{ launchMethod };
+    return processExecutor.run(environmentVariables, repoPath, command, args, &stdoutConsumer, std::nullopt);
+}
+
+auto GitCommandExecutorUnix::executeWithInputImpl(const std::vector<std::string>& environmentVariables, const std::string_view repoPath, const std::string_view input, const std::string_view command, const std::vector<std::string>& args) -> GitCommandOutput
+{
+    auto processExecutor = GitCommandExecutorUnix{ launchMethod };
+    return processExecutor.run(environmentVariables, repoPath, command, args, nullptr, input);
+}
+
+auto GitCommandExecutorUnix::startSessionImpl(const std::vector<std::string>& environmentVariables, const std::string_view repoPath, const std::string_view command, const std::vector<std::string>& args) -> std::unique_ptr<GitCommandSession>
+{
+    auto processExecutor = GitCommandExecutorUnix{ launchMethod };
+    processExecutor.createPipes(true);
+
+    // Nothing reads the standard error of a session, so it goes to /dev/null instead of a pipe, which could fill up and block git
+    for (auto& fileDescriptor : processExecutor.stderrPipe)
+    {
+        close(fileDescriptor);
+        fileDescriptor = -1;
+    }
+
+    if (launchMethod == LaunchMethod::PosixSpawn)
+    {
+        processExecutor.spawnProcess(environmentVariables, repoPath, command, args);
+    }
+    else
+    {
+        processExecutor.forkProcess(environmentVariables, repoPath, command, args);
+    }
+
+    close(processExecutor.stdoutPipe[1]);
+    close(processExecutor.stdinSocket[1]);
+
+    return std::make_unique<GitCommandSessionUnix>(processExecutor.pid, processExecutor.stdinSocket[0], processExecutor.stdoutPipe[0]);
+}
+
+auto GitCommandExecutorUnix::run(const std::vector<std::string>& environmentVariables, const std::string_view repoPath, const std::string_view command, const std::vector<std::string>& args, const StdoutConsumer* stdoutConsumer, const std::optional<std::string_view> input) -> GitCommandOutput
+{
+    createPipes(input.has_value());
+
+    if (launchMethod == LaunchMethod::PosixSpawn)
+    {
+        spawnProcess(environmentVariables, repoPath, command, args);
+    }
+    else
+    {
+        forkProcess(environmentVariables, repoPath, command, args);
+    }
+
+    return parentProcess(stdoutConsumer, input);
+}
+
+auto GitCommandExecutorUnix::spawnProcess(const std::vector<std::string>& environmentVariables, const std::string_view repoPath, const std::string_view command, const std::vector<std::string>& args) -> void
+{
+    // Everything the child needs is prepared up front, so posix_spawn can start it without copying our address space
+    const auto repoPathStr = std::string{ repoPath };
+    const auto commandStr = std::string{ command };
+
+    std::vector<const char*> argv;
+
+    constexpr auto ARGV_ADDITIONAL_SIZE = 5;
+    argv.reserve(args.size() + ARGV_ADDITIONAL_SIZE);
+    argv.emplace_back(GIT_EXECUTABLE);
+    argv.emplace_back("-C");
+    argv.push_back(repoPathStr.c_str());
+    argv.push_back(commandStr.c_str());
+
+    for (const auto& arg : args)
+    {
+        if (!arg.empty())
+        {
+            argv.push_back(arg.c_str());
+        }
+    }
+    argv.emplace_back(nullptr);
+
+    std::vector<const char*> envp;
+    for (char* const* env = environ; *env != nullptr; ++env)
+    {
+        envp.push_back(*env);
+    }
+    envp.reserve(envp.size() + environmentVariables.size() + 1);
+    for (const auto& envVar : environmentVariables)
+    {
+        if (!envVar.empty())
+        {
+            envp.push_back(envVar.c_str());
+        }
+    }
+    envp.push_back(nullptr);
+
+    posix_spawn_file_actions_t fileActions{};
+    if (posix_spawn_file_actions_init(&fileActions) != 0)
+    {
+        closePipes();
+        throw std::runtime_error("Failed to init spawn file actions");
+    }
+
+    // Pipes are O_CLOEXEC, so only the duplicated descriptors are inherited by git
+    auto result = posix_spawn_file_actions_adddup2(&fileActions, stdoutPipe[1], STDOUT_FILENO);
+    if (result == 0)
+    {
+        result = stderrPipe[1] != -1 ? posix_spawn_file_actions_adddup2(&fileActions, stderrPipe[1], STDERR_FILENO)
+                                     : posix_spawn_file_actions_addopen(&fileActions, STDERR_FILENO, "/dev/null", O_WRONLY, 0);
+    }
+    if (result == 0 && stdinSocket[1] != -1)
+    {
+        result = posix_spawn_file_actions_adddup2(&fileActions, stdinSocket[1], STDIN_FILENO);
+    }
+    if (result == 0)
+    {
+        result = posix_spawnp(&pid, GIT_EXECUTABLE, &fileActions, nullptr, const_cast<char* const*>(argv.data()), const_cast<char* const*>(envp.data())); // NOLINT(cppcoreguidelines-pro-type-const-cast)
+    }
+
+    posix_spawn_file_actions_destroy(&fileActions);
+
+    if (result != 0)
+    {
+        closePipes();
+        throw std::runtime_error("Failed to spawn git process");
+    }
+}
+
+auto GitCommandExecutorUnix::forkProcess(const std::vector<std::string>& environmentVariables, const std::string_view repoPath, const std::string_view command, const std::vector<std::string>& args) -> void
+{
     pid = fork();
     if (pid == -1)
     {
+        closePipes();
         throw std::runtime_error("Failed to fork");
     }
 
@@ -30,11 +273,9 @@ auto GitCommandExecutorUnix::executeImpl(const std::vector<std::string>& environ
     {
         childProcess(environmentVariables, repoPath, command, args);
     }
-
-    return parentProcess();
 }
 
-auto GitCommandExecutorUnix::createPipes() -> void
+auto GitCommandExecutorUnix::createPipes(const bool withStdin) -> void
 {
     if (pipe2(stdoutPipe.data(), O_CLOEXEC) == -1)
     {
@@ -42,61 +283,199 @@ auto GitCommandExecutorUnix::createPipes() -> void
     }
     if (pipe2(stderrPipe.data(), O_CLOEXEC) == -1)
     {
+        closePipes();
         throw std::runtime_error("Failed to create stderr pipe");
     }
+    // Socket instead of pipe, so we can use MSG_NOSIGNAL and don't get SIGPIPE when git exits without reading whole input
+    if (withStdin && socketpair(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0, stdinSocket.data()) == -1)
+    {
+        closePipes();
+        throw std::runtime_error("Failed to create stdin socket");
+    }
 }
 
-auto GitCommandExecutorUnix::parentProcess() -> GitCommandOutput
+auto GitCommandExecutorUnix::parentProcess(const StdoutConsumer* stdoutConsumer, const std::optional<std::string_view> input) -> GitCommandOutput
 {
     close(stdoutPipe[1]);
     close(stderrPipe[1]);
+    stdoutPipe[1] = -1;
+    stderrPipe[1] = -1;
+
+    auto remainingInput = input.value_or(std::string_view{});
+    if (stdinSocket[1] != -1)
+    {
+        close(stdinSocket[1]);
+        stdinSocket[1] = -1;
+
+        if (remainingInput.empty())
+        {
+            close(stdinSocket[0]);
+            stdinSocket[0] = -1;
+        }
+    }
+
+    std::string stdoutStr;
+    std::string stderrStr;
+
+    // Both pipes have to be drained while the child is running, otherwise a child writing more than
+    // the pipe capacity blocks forever waiting for us, while we wait for it to exit
+    // The input is written meanwhile, as git may start writing output before it reads the whole input
+    std::array<pollfd, 3> pollFds{
+        pollfd{ .fd = stdoutPipe[0], .events = POLLIN, .revents = 0 },
+        pollfd{ .fd = stderrPipe[0], .events = POLLIN, .revents = 0 },
+        pollfd{ .fd = stdinSocket[0], .events = POLLOUT, .revents = 0 }
+    };
+    std::array<std::string*, 2> outputs{ &stdoutStr, &stderrStr };
+
+    auto openPipes = outputs.size();
+    while (openPipes > 0)
+    {
+        if (poll(pollFds.data(), pollFds.size(), -1) == -1)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+            closePipes();
+            kill(pid, SIGKILL);
+            waitpid(pid, nullptr, 0);
+            throw std::runtime_error("Failed to poll command output");
+        }
+
+        if (pollFds[2].fd != -1 && pollFds[2].revents != 0 && !writeAvailable(remainingInput))
+        {
+            // Whole input written or git doesn't read anymore, closing sends EOF
+            close(stdinSocket[0]);
+            stdinSocket[0] = -1;
+            pollFds[2].fd = -1;
+        }
+
+        for (auto i = std::size_t{ 0 }; i < outputs.size(); ++i)
+        {
+            if (pollFds[i].fd == -1 || pollFds[i].revents == 0)
+            {
+                continue;
+            }
+
+            if (!readAvailable(pollFds[i].fd, *outputs[i]))
+            {
+                // EOF or error, in both cases there is nothing more to read from this pipe
+                close(pollFds[i].fd);
+                pollFds[i].fd = -1;
+                --openPipes;
+            }
+            else if (i == 0 && stdoutConsumer != nullptr)
+            {
+                passToConsumer(*stdoutConsumer, stdoutStr);
+            }
+        }
+    }
+
+    stdoutPipe[0] = -1;
+    stderrPipe[0] = -1;
+    closePipes();
 
     int status{};
-    if (wait(&status) == -1)
+    while (waitpid(pid, &status, 0) == -1)
     {
-        throw std::runtime_error("Failed to waitpid.");
+        if (errno != EINTR)
+        {
+            throw std::runtime_error("Failed to waitpid.");
+        }
     }
 
     const int returnCode = WEXITSTATUS(status);
 
-    constexpr auto bufferSize = 256;
-    std::array<char, bufferSize> buffer{};
+    if (!stdoutStr.empty() && stdoutStr.back() == '\n')
+    {
+        stdoutStr.pop_back();
+    }
+
+    if (!stderrStr.empty() && stderrStr.back() == '\n')
+    {
+        stderrStr.pop_back();
+    }
 
-    std::string stdoutStr;
-    ssize_t bytesReadStdOut{};
+    return GitCommandOutput{ .return_code = returnCode, .stdout = std::move(stdoutStr), .stderr = std::move(stderrStr) };
+}
 
-    while ((bytesReadStdOut = read(stdoutPipe[0], buffer.data(), bufferSize)) > 0)
+auto GitCommandExecutorUnix::readAvailable(const int fileDescriptor, std::string& output) -> bool
+{
+    constexpr auto MIN_FREE_SPACE = std::size_t{ 64 * 1024 };
+
+    // Read straight into the output string, growing it geometrically, to avoid extra copies for big outputs
+    const auto oldSize = output.size();
+    if (output.capacity() - oldSize < MIN_FREE_SPACE)
     {
-        stdoutStr.append(buffer.data(), static_cast<std::size_t>(bytesReadStdOut));
+        output.reserve(std::max(output.capacity() * 2, oldSize + MIN_FREE_SPACE));
     }
-    if (bytesReadStdOut == -1)
+    output.resize(output.capacity());
+
+    ssize_t bytesRead{};
+    do
     {
-        throw std::runtime_error("Failed to read stdout");
+        bytesRead = read(fileDescriptor, output.data() + oldSize, output.size() - oldSize);
+    } while (bytesRead == -1 && errno == EINTR);
+
+    if (bytesRead <= 0)
+    {
+        output.resize(oldSize);
+        return false;
     }
 
-    if (stdoutStr.back() == '\n')
+    output.resize(oldSize + static_cast<std::size_t>(bytesRead));
+    return true;
+}
+
+auto GitCommandExecutorUnix::writeAvailable(std::string_view& input) -> bool
+{
+    ssize_t bytesWritten{};
+    do
     {
-        stdoutStr.pop_back();
+        bytesWritten = send(stdinSocket[0], input.data(), input.size(), MSG_NOSIGNAL | MSG_DONTWAIT);
+    } while (bytesWritten == -1 && errno == EINTR);
+
+    if (bytesWritten == -1)
+    {
+        return errno == EAGAIN || errno == EWOULDBLOCK;
     }
 
-    std::string stderrStr;
-    ssize_t bytesReadStdErr{};
+    input.remove_prefix(static_cast<std::size_t>(bytesWritten));
+    return !input.empty();
+}
 
-    while ((bytesReadStdErr = read(stderrPipe[0], buffer.data(), bufferSize)) > 0)
+auto GitCommandExecutorUnix::passToConsumer(const StdoutConsumer& stdoutConsumer, std::string& output) -> void
+{
+    try
     {
-        stderrStr.append(buffer.data(), static_cast<std::size_t>(bytesReadStdErr));
+        stdoutConsumer(output);
     }
-    if (bytesReadStdErr == -1)
+    catch (...)
     {
-        throw std::runtime_error("Failed to read stderr");
+        // Don't leave the child blocked on a full pipe nor a zombie behind
+        closePipes();
+        kill(pid, SIGKILL);
+        waitpid(pid, nullptr, 0);
+        throw;
     }
 
-    if (stderrStr.back() == '\n')
+    // Keep the capacity, so the next chunks are read into the same buffer
+    output.clear();
+}
+
+auto GitCommandExecutorUnix::closePipes() -> void
+{
+    for (auto* const pipeFds : { &stdoutPipe, &stderrPipe, &stdinSocket })
     {
-        stderrStr.pop_back();
+        for (auto& fileDescriptor : *pipeFds)
+        {
+            if (fileDescriptor != -1)
+            {
+                close(fileDescriptor);
+                fileDescriptor = -1;
+            }
+        }
     }
-
-    return GitCommandOutput{ .return_code = returnCode, .stdout = stdoutStr, .stderr = stderrStr };
 }
 
 auto GitCommandExecutorUnix::childProcess(const std::vector<std::string>& environmentVariables, const std::string_view repoPath, const std::string_view command, const std::vector<std::string>& args) -> void
@@ -104,11 +483,21 @@ auto GitCommandExecutorUnix::childProcess(const std::vector<std::string>& enviro
     close(stdoutPipe[0]);
     close(stderrPipe[0]);
 
+    if (stderrPipe[1] == -1)
+    {
+        stderrPipe[1] = open("/dev/null", O_WRONLY | O_CLOEXEC);
+    }
+
     if (dup2(stdoutPipe[1], STDOUT_FILENO) == -1 || dup2(stderrPipe[1], STDERR_FILENO) == -1)
     {
         throw std::runtime_error("Failed to redirect stdout/stderr");
     }
 
+    if (stdinSocket[1] != -1 && dup2(stdinSocket[1], STDIN_FILENO) == -1)
+    {
+        throw std::runtime_error("Failed to redirect stdin");
+    }
+
     close(stdoutPipe[1]);
     close(stderrPipe[1]);
 
@@ -0,0 +1,126 @@
+#include "CppGit/_details/GitCommandExecutor/GitCommandMetrics.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <utility>
+
+namespace CppGit {
+
+auto GitCommandMetrics::record(const GitCommandMetric& metric) -> void
+{
+    auto currentObserver = Observer{};
+    {
+        const auto lock = std::lock_guard{ mutex };
+
+        auto statisticsIt = statistics.find(metric.command);
+        if (statisticsIt == statistics.end())
+        {
+            statisticsIt = statistics.emplace(std::string{ metric.command }, GitCommandStatistics{}).first;
+        }
+        auto& commandStatistics = statisticsIt->second;
+
+        commandStatistics.minWallTime = commandStatistics.count == 0 ? metric.wallTime : std::min(commandStatistics.minWallTime, metric.wallTime);
+        commandStatistics.maxWallTime = std::max(commandStatistics.maxWallTime, metric.wallTime);
+        ++commandStatistics.count;
+        commandStatistics.failedCount += metric.returnCode != 0 ? 1 : 0;
+        commandStatistics.argumentsCount += metric.argumentsCount;
+        commandStatistics.totalWallTime += metric.wallTime;
+        commandStatistics.stdoutBytes += metric.stdoutBytes;
+        commandStatistics.stderrBytes += metric.stderrBytes;
+
+        const auto microseconds = static_cast<std::uint64_t>(std::max(std::chrono::duration_cast<std::chrono::microseconds>(metric.wallTime).count(), std::int64_t{ 1 }));
+        const auto bucket = std::min(static_cast<std::size_t>(std::bit_width(microseconds) - 1), GitCommandStatistics::HISTOGRAM_BUCKETS - 1);
+        ++commandStatistics.wallTimeHistogram[bucket];
+
+        currentObserver = observer;
+    }
+
+    if (currentObserver)
+    {
+        currentObserver(metric);
+    }
+}
+
+auto GitCommandMetrics::setObserver(Observer observer) -> void
+{
+    const auto lock = std::lock_guard{ mutex };
+    this->observer = std::move(observer);
+}
+
+auto GitCommandMetrics::getStatistics() const -> std::map<std::string, GitCommandStatistics, std::less<>>
+{
+    const auto lock = std::lock_guard{ mutex };
+    return statistics;
+}
+
+auto GitCommandMetrics::getStatistics(const std::string_view command) const -> std::optional<GitCommandStatistics>
+{
+    const auto lock = std::lock_guard{ mutex };
+
+    if (const auto statisticsIt = statistics.find(command); statisticsIt != statistics.end())
+    {
+        return statisticsIt->second;
+    }
+
+    return std::nullopt;
+}
+
+auto GitCommandMetrics::getTotalCount() const -> std::size_t
+{
+    const auto lock = std::lock_guard{ mutex };
+
+    auto totalCount = std::size_t{ 0 };
+    for (const auto& [command, commandStatistics] : statistics)
+    {
+        totalCount += commandStatistics.count;
+    }
+
+    return totalCount;
+}
+
+auto GitCommandMetrics::exportCsv() const -> std::string
+{
+    const auto lock = std::lock_guard{ mutex };
+
+    auto csv = std::string{ "command,count,failed,arguments,total_us,min_us,max_us,stdout_bytes,stderr_bytes,histogram_us_log2\n" };
+
+    const auto toMicroseconds = [](const std::chrono::nanoseconds time) {
+        return std::to_string(std::chrono::duration_cast<std::chrono::microseconds>(time).count());
+    };
+
+    for (const auto& [command, commandStatistics] : statistics)
+    {
+        csv += command + ',' + std::to_string(commandStatistics.count) + ',' + std::to_string(commandStatistics.failedCount) + ',' + std::to_string(commandStatistics.argumentsCount) + ','
+             + toMicroseconds(commandStatistics.totalWallTime) + ',' + toMicroseconds(commandStatistics.minWallTime) + ',' + toMicroseconds(commandStatistics.maxWallTime) + ','
+             + std::to_string(commandStatistics.stdoutBytes) + ',' + std::to_string(commandStatistics.stderrBytes) + ',';
+
+        for (auto i = std::size_t{ 0 }; i < commandStatistics.wallTimeHistogram.size(); ++i)
+        {
+            if (i != 0)
+            {
+                csv += ';';
+            }
+            csv += std::to_string(commandStatistics.wallTimeHistogram[i]);
+        }
+        csv += '\n';
+    }
+
+    return csv;
+}
+
+auto GitCommandMetrics::reset() -> void
+{
+    const auto lock = std::lock_guard{ mutex };
+    statistics.clear();
+}
+
+} // namespace CppGit
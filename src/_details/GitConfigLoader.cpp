@@ -0,0 +1,376 @@
+#include "CppGit/_details/GitConfigLoader.hpp"
+
+#include "CppGit/GitConfigSnapshot.hpp"
+#include "CppGit/_details/FileUtility.hpp"
+#include "CppGit/_details/Parser/ConfigParser.hpp"
+
+#include <charconv>
+#include <cstddef>
+#include <cstdlib>
+#include <filesystem>
+#include <fnmatch.h>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <utility>
+#include <vector>
+
+namespace CppGit::_details {
+
+namespace {
+
+// The same limit as git has, protects against include cycles
+constexpr auto MAX_INCLUDE_DEPTH = 10;
+
+constexpr auto INCLUDE_PATH_KEY = std::string_view{ "include.path" };
+constexpr auto INCLUDE_IF_PREFIX = std::string_view{ "includeif." };
+constexpr auto PATH_SUFFIX = std::string_view{ ".path" };
+
+auto getEnvironmentVariable(const char* name) -> std::optional<std::string_view>
+{
+    const auto* const value = std::getenv(name); // NOLINT(concurrency-mt-unsafe)
+    if (value == nullptr)
+    {
+        return std::nullopt;
+    }
+
+    return std::string_view{ value };
+}
+
+auto expandHomeDirectory(const std::string_view path) -> std::optional<std::filesystem::path>
+{
+    if (!path.starts_with("~/"))
+    {
+        return std::filesystem::path{ path };
+    }
+
+    const auto home = getEnvironmentVariable("HOME");
+    if (!home)
+    {
+        return std::nullopt;
+    }
+
+    return std::filesystem::path{ *home } / path.substr(2);
+}
+
+auto matchesPattern(const std::string& pattern, const std::string& text, const bool ignoreCase) -> bool
+{
+    // Without FNM_PATHNAME '*' matches '/' as well, so '**' works across directories like in git's wildmatch
+    return fnmatch(pattern.c_str(), text.c_str(), ignoreCase ? FNM_CASEFOLD : 0) == 0;
+}
+
+class GitConfigLoader
+{
+public:
+    explicit GitConfigLoader(const std::filesystem::path& gitDirectoryPath)
+        : gitDirectoryPath{ gitDirectoryPath }
+    {
+    }
+
+    auto loadFile(const std::filesystem::path& path, const GitConfigScope scope) -> void
+    {
+        loadFile(path, scope, 0);
+    }
+
+    auto addEntry(std::string key, std::optional<std::string> value, const GitConfigScope scope) -> void
+    {
+        entries.emplace_back(std::move(key), std::move(value), scope, false);
+    }
+
+    [[nodiscard]] auto getEntries() const -> const std::vector<GitConfigSnapshotEntry>&
+    {
+        return entries;
+    }
+
+    [[nodiscard]] auto createSnapshot() && -> GitConfigSnapshot
+    {
+        return GitConfigSnapshot{ std::move(entries), std::move(fileStamps) };
+    }
+
+private:
+    std::filesystem::path gitDirectoryPath;
+    std::vector<GitConfigSnapshotEntry> entries;
+    std::vector<GitConfigFileStamp> fileStamps;
+    std::optional<std::string> currentBranch;
+    bool headRead{ false };
+
+    auto loadFile(const std::filesystem::path& path, const GitConfigScope scope, const int depth) -> void
+    {
+        if (depth > MAX_INCLUDE_DEPTH)
+        {
+            throw std::runtime_error("Exceeded maximum include depth while including " + path.string());
+        }
+
+        // Missing files are recorded too, so creating them later makes the snapshot outdated
+        if (!fileStamps.emplace_back(GitConfigSnapshot::createFileStamp(path)).exists)
+        {
+            return;
+        }
+
+        auto fileEntries = std::vector<ConfigFileEntry>{};
+        try
+        {
+            fileEntries = ConfigParser::parseConfigFile(FileUtility::readFile(path));
+        }
+        catch (const std::runtime_error& error)
+        {
+            throw std::runtime_error(std::string{ error.what() } + " in file " + path.string());
+        }
+
+        for (auto& [key, value] : fileEntries)
+        {
+            const auto includePath = getIncludePath(key, value, path);
+            entries.emplace_back(std::move(key), std::move(value), scope, depth > 0);
+
+            if (includePath)
+            {
+                loadFile(*includePath, scope, depth + 1);
+            }
+        }
+    }
+
+    // Returns path of the file to include if the entry is an include directive whose condition is met
+    auto getIncludePath(const std::string& key, const std::optional<std::string>& value, const std::filesystem::path& configPath) -> std::optional<std::filesystem::path>
+    {
+        if (!value || value->empty())
+        {
+            return std::nullopt;
+        }
+
+        if (key != INCLUDE_PATH_KEY)
+        {
+            if (!key.starts_with(INCLUDE_IF_PREFIX) || !key.ends_with(PATH_SUFFIX) || key.size() <= INCLUDE_IF_PREFIX.size() + PATH_SUFFIX.size())
+            {
+                return std::nullopt;
+            }
+
+            const auto condition = std::string_view{ key }.substr(INCLUDE_IF_PREFIX.size(), key.size() - INCLUDE_IF_PREFIX.size() - PATH_SUFFIX.size());
+            if (!isConditionMet(condition, configPath))
+            {
+                return std::nullopt;
+            }
+        }
+
+        auto includePath = expandHomeDirectory(*value);
+        if (!includePath)
+        {
+            return std::nullopt;
+        }
+
+        if (includePath->is_relative())
+        {
+            return configPath.parent_path() / *includePath;
+        }
+
+        return includePath;
+    }
+
+    auto isConditionMet(const std::string_view condition, const std::filesystem::path& configPath) -> bool
+    {
+        if (condition.starts_with("gitdir:"))
+        {
+            return matchesGitDirectory(condition.substr(std::string_view{ "gitdir:" }.size()), configPath, false);
+        }
+
+        if (condition.starts_with("gitdir/i:"))
+        {
+            return matchesGitDirectory(condition.substr(std::string_view{ "gitdir/i:" }.size()), configPath, true);
+        }
+
+        if (condition.starts_with("onbranch:"))
+        {
+            return matchesBranch(condition.substr(std::string_view{ "onbranch:" }.size()));
+        }
+
+        // Conditions unknown to this reader (e.g. hasconfig:) are treated as not met
+        return false;
+    }
+
+    auto matchesGitDirectory(const std::string_view condition, const std::filesystem::path& configPath, const bool ignoreCase) const -> bool
+    {
+        auto pattern = std::string{};
+        if (condition.starts_with("./"))
+        {
+            pattern = (configPath.parent_path() / condition.substr(2)).string();
+        }
+        else if (const auto expanded = expandHomeDirectory(condition); expanded)
+        {
+            pattern = expanded->string();
+        }
+        else
+        {
+            return false;
+        }
+
+        if (!pattern.starts_with('/') && !pattern.starts_with("**/"))
+        {
+            pattern.insert(0, "**/");
+        }
+
+        if (pattern.ends_with('/'))
+        {
+            pattern.append("**");
+        }
+
+        auto error = std::error_code{};
+        const auto canonicalGitDirectory = std::filesystem::canonical(gitDirectoryPath, error);
+
+        return matchesPattern(pattern, gitDirectoryPath.string(), ignoreCase) || (!error && matchesPattern(pattern, canonicalGitDirectory.string(), ignoreCase));
+    }
+
+    auto matchesBranch(const std::string_view condition) -> bool
+    {
+        if (!headRead)
+        {
+            const auto headPath = gitDirectoryPath / "HEAD";
+            fileStamps.push_back(GitConfigSnapshot::createFileStamp(headPath));
+
+            constexpr auto BRANCH_PREFIX = std::string_view{ "ref: refs/heads/" };
+            auto head = FileUtility::readFile(headPath);
+            while (!head.empty() && (head.back() == '\n' || head.back() == '\r'))
+            {
+                head.pop_back();
+            }
+            if (head.starts_with(BRANCH_PREFIX))
+            {
+                currentBranch = head.substr(BRANCH_PREFIX.size());
+            }
+            headRead = true;
+        }
+
+        if (!currentBranch)
+        {
+            return false;
+        }
+
+        auto pattern = std::string{ condition };
+        if (pattern.ends_with('/'))
+        {
+            pattern.append("**");
+        }
+
+        return matchesPattern(pattern, *currentBranch, false);
+    }
+};
+
+auto getSystemConfigPath() -> std::optional<std::filesystem::path>
+{
+    if (const auto noSystem = getEnvironmentVariable("GIT_CONFIG_NOSYSTEM"); noSystem && GitConfigSnapshot::parseBool("GIT_CONFIG_NOSYSTEM", std::string{ *noSystem }))
+    {
+        return std::nullopt;
+    }
+
+    if (const auto systemPath = getEnvironmentVariable("GIT_CONFIG_SYSTEM"); systemPath)
+    {
+        return std::filesystem::path{ *systemPath };
+    }
+
+    return std::filesystem::path{ "/etc/gitconfig" };
+}
+
+auto getGlobalConfigPaths() -> std::vector<std::filesystem::path>
+{
+    if (const auto globalPath = getEnvironmentVariable("GIT_CONFIG_GLOBAL"); globalPath)
+    {
+        if (globalPath->empty())
+        {
+            return {};
+        }
+
+        return { std::filesystem::path{ *globalPath } };
+    }
+
+    auto paths = std::vector<std::filesystem::path>{};
+    const auto home = getEnvironmentVariable("HOME");
+
+    if (const auto xdgConfigHome = getEnvironmentVariable("XDG_CONFIG_HOME"); xdgConfigHome && !xdgConfigHome->empty())
+    {
+        paths.push_back(std::filesystem::path{ *xdgConfigHome } / "git" / "config");
+    }
+    else if (home)
+    {
+        paths.push_back(std::filesystem::path{ *home } / ".config" / "git" / "config");
+    }
+
+    if (home)
+    {
+        paths.push_back(std::filesystem::path{ *home } / ".gitconfig");
+    }
+
+    return paths;
+}
+
+auto isWorktreeConfigEnabled(const std::vector<GitConfigSnapshotEntry>& entries) -> bool
+{
+    auto enabled = false;
+    for (const auto& entry : entries)
+    {
+        if (entry.scope == GitConfigScope::LOCAL && entry.key == "extensions.worktreeconfig")
+        {
+            enabled = GitConfigSnapshot::parseBool(entry.key, entry.value);
+        }
+    }
+
+    return enabled;
+}
+
+auto loadCommandScope(GitConfigLoader& loader) -> void
+{
+    const auto count = getEnvironmentVariable("GIT_CONFIG_COUNT");
+    if (!count)
+    {
+        return;
+    }
+
+    auto entriesCount = std::size_t{ 0 };
+    if (const auto [end, errorCode] = std::from_chars(count->data(), count->data() + count->size(), entriesCount); errorCode != std::errc{})
+    {
+        throw std::runtime_error("Invalid GIT_CONFIG_COUNT");
+    }
+
+    for (auto i = std::size_t{ 0 }; i < entriesCount; ++i)
+    {
+        const auto keyVariable = "GIT_CONFIG_KEY_" + std::to_string(i);
+        const auto valueVariable = "GIT_CONFIG_VALUE_" + std::to_string(i);
+        const auto key = getEnvironmentVariable(keyVariable.c_str());
+        const auto value = getEnvironmentVariable(valueVariable.c_str());
+        if (!key || !value)
+        {
+            throw std::runtime_error("Missing " + (key ? valueVariable : keyVariable));
+        }
+
+        loader.addEntry(ConfigParser::normalizeKey(*key), std::string{ *value }, GitConfigScope::COMMAND);
+    }
+}
+
+} // namespace
+
+auto loadGitConfigSnapshot(const std::filesystem::path& gitDirectoryPath, const std::filesystem::path& commonDirectoryPath) -> GitConfigSnapshot
+{
+    auto loader = GitConfigLoader{ gitDirectoryPath };
+
+    if (const auto systemPath = getSystemConfigPath(); systemPath)
+    {
+        loader.loadFile(*systemPath, GitConfigScope::SYSTEM);
+    }
+
+    for (const auto& globalPath : getGlobalConfigPaths())
+    {
+        loader.loadFile(globalPath, GitConfigScope::GLOBAL);
+    }
+
+    loader.loadFile(commonDirectoryPath / "config", GitConfigScope::LOCAL);
+
+    if (isWorktreeConfigEnabled(loader.getEntries()))
+    {
+        loader.loadFile(gitDirectoryPath / "config.worktree", GitConfigScope::WORKTREE);
+    }
+
+    loadCommandScope(loader);
+
+    return std::move(loader).createSnapshot();
+}
+
+} // namespace CppGit::_details
@@ -0,0 +1,342 @@
+#include "CppGit/_details/IndexFileReader.hpp"
+
+#include "CppGit/ObjectId.hpp"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <fcntl.h>
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <vector>
+
+namespace CppGit::_details {
+
+namespace {
+
+constexpr auto SHA1_SIZE = std::size_t{ 20 };
+constexpr auto SHA256_SIZE = std::size_t{ 32 };
+constexpr auto HEADER_SIZE = std::size_t{ 12 };
+constexpr auto STAT_DATA_SIZE = std::size_t{ 40 };
+constexpr auto EXTENSION_HEADER_SIZE = std::size_t{ 8 };
+
+constexpr auto EXTENDED_FLAG = std::uint16_t{ 0x4000 };
+constexpr auto NAME_LENGTH_MASK = std::uint16_t{ 0x0FFF };
+constexpr auto STAGE_SHIFT = 12;
+constexpr auto STAGE_MASK = 0x3;
+
+constexpr auto OBJECT_TYPE_MASK = std::uint32_t{ 0170000 };
+constexpr auto REGULAR_FILE_TYPE = std::uint32_t{ 0100000 };
+constexpr auto SYMLINK_TYPE = std::uint32_t{ 0120000 };
+constexpr auto GITLINK_TYPE = std::uint32_t{ 0160000 };
+
+auto readUint32(const char* bytes) -> std::uint32_t
+{
+    const auto* const unsignedBytes = reinterpret_cast<const unsigned char*>(bytes); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+    return (std::uint32_t{ unsignedBytes[0] } << 24U) | (std::uint32_t{ unsignedBytes[1] } << 16U) | (std::uint32_t{ unsignedBytes[2] } << 8U) | std::uint32_t{ unsignedBytes[3] };
+}
+
+auto readUint16(const char* bytes) -> std::uint16_t
+{
+    const auto* const unsignedBytes = reinterpret_cast<const unsigned char*>(bytes); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+    return static_cast<std::uint16_t>((unsignedBytes[0] << 8U) | unsignedBytes[1]);
+}
+
+auto isSupportedMode(const std::uint32_t mode) -> bool
+{
+    // Directories only occur in sparse indexes, which have to be expanded by git
+    const auto type = mode & OBJECT_TYPE_MASK;
+    return type == REGULAR_FILE_TYPE || type == SYMLINK_TYPE || type == GITLINK_TYPE;
+}
+
+// Offset encoding used by index v4 to store number of bytes removed from the previous path
+auto readVarint(const char*& position, const char* const end, std::size_t& value) -> bool
+{
+    if (position == end)
+    {
+        return false;
+    }
+
+    auto byte = static_cast<unsigned char>(*position++);
+    value = byte & 0x7FU;
+    while ((byte & 0x80U) != 0)
+    {
+        if (position == end || value > (SIZE_MAX >> 8U))
+        {
+            return false;
+        }
+        byte = static_cast<unsigned char>(*position++);
+        value = ((value + 1) << 7U) | (byte & 0x7FU);
+    }
+
+    return true;
+}
+
+} // namespace
+
+auto IndexFileEntry::getObjectId() const -> ObjectId
+{
+    const auto* const unsignedBytes = reinterpret_cast<const std::uint8_t*>(objectId.data()); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+    return ObjectId::fromBytes({ unsignedBytes, objectId.size() });
+}
+
+auto IndexFileEntry::getOctalMode() const -> int
+{
+    auto octalMode = 0;
+    auto multiplier = 1;
+    for (auto remainingMode = mode; remainingMode != 0; remainingMode >>= 3U)
+    {
+        octalMode += static_cast<int>(remainingMode & 7U) * multiplier;
+        multiplier *= 10;
+    }
+
+    return octalMode;
+}
+
+IndexFileReader::IndexFileReader(const std::filesystem::path& indexPath)
+{
+    const auto fileDescriptor = open(indexPath.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fileDescriptor == -1)
+    {
+        // Fresh repository doesn't have index yet
+        valid = errno == ENOENT;
+        return;
+    }
+
+    struct stat fileStat{};
+    if (fstat(fileDescriptor, &fileStat) == -1 || fileStat.st_size <= 0)
+    {
+        close(fileDescriptor);
+        return;
+    }
+
+    auto* const mapping = mmap(nullptr, static_cast<std::size_t>(fileStat.st_size), PROT_READ, MAP_PRIVATE, fileDescriptor, 0);
+    close(fileDescriptor);
+    if (mapping == MAP_FAILED)
+    {
+        return;
+    }
+
+    data = static_cast<const char*>(mapping);
+    size = static_cast<std::size_t>(fileStat.st_size);
+
+    // Index doesn't store hash algorithm, but only the right one makes entries and extensions end exactly at the checksum
+    valid = parse(SHA1_SIZE) || parse(SHA256_SIZE);
+    if (!valid)
+    {
+        entries.clear();
+        pathsBuffer.reset();
+    }
+}
+
+IndexFileReader::~IndexFileReader()
+{
+    if (data != nullptr)
+    {
+        munmap(const_cast<char*>(data), size); // NOLINT(cppcoreguidelines-pro-type-const-cast)
+    }
+}
+
+auto IndexFileReader::isValid() const -> bool
+{
+    return valid;
+}
+
+auto IndexFileReader::getVersion() const -> std::uint32_t
+{
+    return version;
+}
+
+auto IndexFileReader::getEntries() const -> const std::vector<IndexFileEntry>&
+{
+    return entries;
+}
+
+auto IndexFileReader::parse(const std::size_t hashSize) -> bool
+{
+    entries.clear();
+    pathsBuffer.reset();
+
+    if (size < HEADER_SIZE + hashSize || std::memcmp(data, "DIRC", 4) != 0)
+    {
+        return false;
+    }
+
+    version = readUint32(data + 4);
+    if (version < 2 || version > 4)
+    {
+        return false;
+    }
+
+    const auto entriesEnd = parseEntries(hashSize, readUint32(data + 8));
+    return entriesEnd != 0 && parseExtensions(entriesEnd, hashSize);
+}
+
+auto IndexFileReader::parseEntries(const std::size_t hashSize, const std::uint32_t entriesCount) -> std::size_t
+{
+    const auto end = size - hashSize;
+    entries.reserve(std::min(std::size_t{ entriesCount }, end / (STAT_DATA_SIZE + hashSize + 2)));
+
+    // Version 4 paths are prefix-compressed, so they have to be rebuilt into own buffer
+    // First pass only computes size of this buffer, so views into it never get invalidated
+    const auto firstPass = version == 4 ? 0 : 1;
+    for (auto pass = firstPass; pass < 2; ++pass)
+    {
+        auto offset = HEADER_SIZE;
+        auto previousPathLength = std::size_t{ 0 };
+        auto pathsLength = std::size_t{ 0 };
+        auto* pathsOutput = pathsBuffer.get();
+
+        for (auto i = std::uint32_t{ 0 }; i < entriesCount; ++i)
+        {
+            auto pathOffset = offset + STAT_DATA_SIZE + hashSize + 2;
+            if (pathOffset > end)
+            {
+                return 0;
+            }
+
+            const auto* const entryData = data + offset;
+            const auto flags = readUint16(entryData + STAT_DATA_SIZE + hashSize);
+            auto extendedFlags = std::uint16_t{ 0 };
+            if ((flags & EXTENDED_FLAG) != 0)
+            {
+                if (version < 3 || pathOffset + 2 > end)
+                {
+                    return 0;
+                }
+                extendedFlags = readUint16(data + pathOffset);
+                pathOffset += 2;
+            }
+
+            auto path = std::string_view{};
+            if (version == 4)
+            {
+                const auto* position = data + pathOffset;
+                auto strippedLength = std::size_t{ 0 };
+                if (!readVarint(position, data + end, strippedLength) || strippedLength > previousPathLength)
+                {
+                    return 0;
+                }
+
+                const auto* const suffixEnd = static_cast<const char*>(std::memchr(position, '\0', static_cast<std::size_t>(data + end - position)));
+                if (suffixEnd == nullptr)
+                {
+                    return 0;
+                }
+
+                const auto suffix = std::string_view{ position, static_cast<std::size_t>(suffixEnd - position) };
+                const auto prefixLength = previousPathLength - strippedLength;
+                const auto pathLength = prefixLength + suffix.size();
+
+                if (pass == 1)
+                {
+                    // Prefix is copied from the previous path, which is right before the output
+                    std::copy_n(pathsOutput - previousPathLength, prefixLength, pathsOutput);
+                    std::ranges::copy(suffix, pathsOutput + prefixLength);
+                    path = std::string_view{ pathsOutput, pathLength };
+                    pathsOutput += pathLength;
+                }
+
+                previousPathLength = pathLength;
+                pathsLength += pathLength;
+                offset = static_cast<std::size_t>(suffixEnd - data) + 1;
+            }
+            else
+            {
+                const auto* const pathEnd = static_cast<const char*>(std::memchr(data + pathOffset, '\0', end - pathOffset));
+                if (pathEnd == nullptr)
+                {
+                    return 0;
+                }
+
+                path = std::string_view{ data + pathOffset, static_cast<std::size_t>(pathEnd - (data + pathOffset)) };
+
+                // Entries are padded with 1-8 NUL bytes to the multiple of 8 bytes
+                const auto entrySize = (pathOffset - offset + path.size() + 8) & ~std::size_t{ 7 };
+                if (offset + entrySize > end)
+                {
+                    return 0;
+                }
+                offset += entrySize;
+            }
+
+            if (pass == 0)
+            {
+                continue;
+            }
+
+            const auto nameLength = static_cast<std::size_t>(flags & NAME_LENGTH_MASK);
+            const auto mode = readUint32(entryData + 24);
+            if (path.empty() || (nameLength != NAME_LENGTH_MASK && nameLength != path.size()) || !isSupportedMode(mode))
+            {
+                return 0;
+            }
+
+            entries.push_back(IndexFileEntry{
+                .ctimeSeconds = readUint32(entryData),
+                .ctimeNanoseconds = readUint32(entryData + 4),
+                .mtimeSeconds = readUint32(entryData + 8),
+                .mtimeNanoseconds = readUint32(entryData + 12),
+                .device = readUint32(entryData + 16),
+                .inode = readUint32(entryData + 20),
+                .mode = mode,
+                .uid = readUint32(entryData + 28),
+                .gid = readUint32(entryData + 32),
+                .fileSize = readUint32(entryData + 36),
+                .objectId = std::string_view{ entryData + STAT_DATA_SIZE, hashSize },
+                .flags = flags,
+                .extendedFlags = extendedFlags,
+                .stage = (flags >> STAGE_SHIFT) & STAGE_MASK,
+                .path = path });
+        }
+
+        if (pass == 0)
+        {
+            pathsBuffer = std::make_unique<char[]>(std::max(pathsLength, std::size_t{ 1 })); // NOLINT(cppcoreguidelines-avoid-c-arrays, modernize-avoid-c-arrays)
+        }
+        else
+        {
+            return offset;
+        }
+    }
+
+    return 0;
+}
+
+auto IndexFileReader::parseExtensions(std::size_t offset, const std::size_t hashSize) const -> bool
+{
+    const auto end = size - hashSize;
+
+    while (offset < end)
+    {
+        if (offset + EXTENSION_HEADER_SIZE > end)
+        {
+            return false;
+        }
+
+        // Extensions which can't be ignored have lowercase signature (e.g. "link" of split index, "sdir" of sparse index)
+        const auto signatureFirstChar = data[offset];
+        if (signatureFirstChar < 'A' || signatureFirstChar > 'Z')
+        {
+            return false;
+        }
+
+        const auto extensionSize = std::size_t{ readUint32(data + offset + 4) };
+        if (extensionSize > end - offset - EXTENSION_HEADER_SIZE)
+        {
+            return false;
+        }
+        offset += EXTENSION_HEADER_SIZE + extensionSize;
+    }
+
+    return offset == end;
+}
+
+} // namespace CppGit::_details
@@ -0,0 +1,1173 @@
+#include "CppGit/_details/LineDiff.hpp"
+
+#include "CppGit/DiffFile.hpp"
+
+#include <algorithm>
+#include <cctype>
+#include <cstddef>
+#include <iterator>
+#include <limits>
+#include <stdexcept>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace CppGit::_details {
+
+auto LineDiff::splitLines(const std::string_view content) -> std::vector<std::string_view>
+{
+    auto lines = std::vector<std::string_view>{};
+
+    auto lineStart = std::size_t{ 0 };
+    while (lineStart < content.size())
+    {
+        const auto newLinePos = content.find('\n', lineStart);
+        const auto lineEnd = (newLinePos == std::string_view::npos ? content.size() : newLinePos + 1);
+        lines.push_back(content.substr(lineStart, lineEnd - lineStart));
+        lineStart = lineEnd;
+    }
+
+    return lines;
+}
+
+auto LineDiff::diff(const std::vector<std::string_view>& oldLines, const std::vector<std::string_view>& newLines, const DiffAlgorithm algorithm, const bool indentHeuristic) -> std::vector<LineDiffChange>
+{
+    auto lineIds = std::unordered_map<std::string_view, LineId>{};
+    lineIds.reserve(oldLines.size() + newLines.size());
+
+    const auto internLines = [&lineIds, indentHeuristic](const std::vector<std::string_view>& lines) {
+        auto file = DiffSide{};
+        file.lines.reserve(lines.size());
+        for (const auto line : lines)
+        {
+            const auto [lineIt, inserted] = lineIds.try_emplace(line, static_cast<LineId>(lineIds.size()));
+            file.lines.push_back(lineIt->second);
+            if (indentHeuristic)
+            {
+                file.indents.push_back(getIndent(line));
+            }
+        }
+        file.changed.assign(lines.size() + 2, 0);
+
+        return file;
+    };
+
+    auto oldFile = internLines(oldLines);
+    auto newFile = internLines(newLines);
+
+    switch (algorithm)
+    {
+    case DiffAlgorithm::MYERS:
+    case DiffAlgorithm::MINIMAL:
+        myersDiff(oldFile, newFile, algorithm == DiffAlgorithm::MINIMAL);
+        break;
+    case DiffAlgorithm::PATIENCE:
+        patienceDiff(oldFile, 0, oldFile.size(), newFile, 0, newFile.size());
+        break;
+    case DiffAlgorithm::HISTOGRAM:
+        histogramDiff(oldFile, 0, oldFile.size(), newFile, 0, newFile.size());
+        break;
+    }
+
+    compact(oldFile, newFile, indentHeuristic);
+    compact(newFile, oldFile, indentHeuristic);
+
+    auto changes = std::vector<LineDiffChange>{};
+    auto oldIndex = std::ptrdiff_t{ 0 };
+    auto newIndex = std::ptrdiff_t{ 0 };
+    while (oldIndex < oldFile.size() || newIndex < newFile.size())
+    {
+        if (!oldFile.isChanged(oldIndex) && !newFile.isChanged(newIndex))
+        {
+            ++oldIndex;
+            ++newIndex;
+            continue;
+        }
+
+        const auto oldStart = oldIndex;
+        const auto newStart = newIndex;
+        while (oldFile.isChanged(oldIndex))
+        {
+            ++oldIndex;
+        }
+        while (newFile.isChanged(newIndex))
+        {
+            ++newIndex;
+        }
+
+        changes.push_back(LineDiffChange{ .oldStart = static_cast<std::size_t>(oldStart),
+                                          .oldCount = static_cast<std::size_t>(oldIndex - oldStart),
+                                          .newStart = static_cast<std::size_t>(newStart),
+                                          .newCount = static_cast<std::size_t>(newIndex - newStart) });
+    }
+
+    return changes;
+}
+
+auto LineDiff::myersDiff(DiffSide& oldFile, DiffSide& newFile, const bool needMinimal) -> void
+{
+    const auto countLines = [](const DiffSide& file, const std::size_t idsCount) {
+        auto lineCounts = std::vector<std::ptrdiff_t>(idsCount, 0);
+        for (const auto lineId : file.lines)
+        {
+            ++lineCounts[lineId];
+        }
+
+        return lineCounts;
+    };
+
+    const auto maxLineId = std::max(oldFile.lines.empty() ? LineId{ 0 } : std::ranges::max(oldFile.lines), newFile.lines.empty() ? LineId{ 0 } : std::ranges::max(newFile.lines));
+    const auto oldLineCounts = countLines(oldFile, static_cast<std::size_t>(maxLineId) + 1);
+    const auto newLineCounts = countLines(newFile, static_cast<std::size_t>(maxLineId) + 1);
+
+    trimCommonEnds(oldFile, newFile);
+    discardUnmatchedLines(oldFile, newLineCounts);
+    discardUnmatchedLines(newFile, oldLineCounts);
+
+    const auto oldComparedSize = static_cast<std::ptrdiff_t>(oldFile.comparedLines.size());
+    const auto newComparedSize = static_cast<std::ptrdiff_t>(newFile.comparedLines.size());
+    const auto diagonalsCount = oldComparedSize + newComparedSize + 3;
+    auto context = SearchContext{ .forward = std::vector<std::ptrdiff_t>(static_cast<std::size_t>(diagonalsCount), 0),
+                                  .backward = std::vector<std::ptrdiff_t>(static_cast<std::size_t>(diagonalsCount), 0),
+                                  .diagonalOffset = newComparedSize + 1,
+                                  .maxCost = std::max(approximateSqrt(diagonalsCount), MIN_MAX_COST) };
+
+    compareRange(oldFile, 0, oldComparedSize, newFile, 0, newComparedSize, needMinimal, context);
+}
+
+auto LineDiff::fallBackToMyersDiff(DiffSide& oldFile, const std::ptrdiff_t oldBegin, const std::ptrdiff_t oldEnd, DiffSide& newFile, const std::ptrdiff_t newBegin, const std::ptrdiff_t newEnd) -> void
+{
+    // Ranges are diffed as if they were whole files, like git's xdl_fall_back_diff() does
+    const auto createRangeFile = [](const DiffSide& file, const std::ptrdiff_t begin, const std::ptrdiff_t end) {
+        auto rangeFile = DiffSide{};
+        rangeFile.lines.assign(file.lines.begin() + begin, file.lines.begin() + end);
+        rangeFile.changed.assign(static_cast<std::size_t>(end - begin) + 2, 0);
+
+        return rangeFile;
+    };
+
+    auto oldRangeFile = createRangeFile(oldFile, oldBegin, oldEnd);
+    auto newRangeFile = createRangeFile(newFile, newBegin, newEnd);
+    myersDiff(oldRangeFile, newRangeFile, false);
+
+    for (auto i = std::ptrdiff_t{ 0 }; i < oldRangeFile.size(); ++i)
+    {
+        oldFile.setChanged(oldBegin + i, oldRangeFile.isChanged(i));
+    }
+    for (auto i = std::ptrdiff_t{ 0 }; i < newRangeFile.size(); ++i)
+    {
+        newFile.setChanged(newBegin + i, newRangeFile.isChanged(i));
+    }
+}
+
+auto LineDiff::markChanged(DiffSide& file, std::ptrdiff_t begin, const std::ptrdiff_t end) -> void
+{
+    for (; begin < end; ++begin)
+    {
+        file.setChanged(begin, true);
+    }
+}
+
+auto LineDiff::trimCommonEnds(DiffSide& oldFile, DiffSide& newFile) -> void
+{
+    const auto limit = std::min(oldFile.size(), newFile.size());
+
+    auto prefixSize = std::ptrdiff_t{ 0 };
+    while (prefixSize < limit && oldFile.lines[static_cast<std::size_t>(prefixSize)] == newFile.lines[static_cast<std::size_t>(prefixSize)])
+    {
+        ++prefixSize;
+    }
+
+    auto suffixSize = std::ptrdiff_t{ 0 };
+    while (suffixSize < limit - prefixSize
+           && oldFile.lines[static_cast<std::size_t>(oldFile.size() - suffixSize - 1)] == newFile.lines[static_cast<std::size_t>(newFile.size() - suffixSize - 1)])
+    {
+        ++suffixSize;
+    }
+
+    oldFile.comparedStart = prefixSize;
+    newFile.comparedStart = prefixSize;
+    oldFile.comparedEnd = oldFile.size() - suffixSize;
+    newFile.comparedEnd = newFile.size() - suffixSize;
+}
+
+auto LineDiff::discardUnmatchedLines(DiffSide& file, const std::vector<std::ptrdiff_t>& otherFileLineCounts) -> void
+{
+    // Lines without a match in the other file are changed for sure, they are marked right away and left out of the comparison.
+    // Lines with many matches are left out too when they are surrounded mostly by lines without a match.
+    constexpr auto NO_MATCH = char{ 0 };
+    constexpr auto MATCH = char{ 1 };
+    constexpr auto MANY_MATCHES = char{ 2 };
+
+    const auto manyMatchesLimit = std::min(approximateSqrt(file.size()), MAX_EQUAL_LIMIT);
+
+    auto discardKinds = std::vector<char>(static_cast<std::size_t>(file.size() + 1), NO_MATCH);
+    for (auto i = file.comparedStart; i < file.comparedEnd; ++i)
+    {
+        const auto matchesCount = otherFileLineCounts[file.lines[static_cast<std::size_t>(i)]];
+        discardKinds[static_cast<std::size_t>(i)] = (matchesCount == 0 ? NO_MATCH : (matchesCount >= manyMatchesLimit ? MANY_MATCHES : MATCH));
+    }
+
+    for (auto i = file.comparedStart; i < file.comparedEnd; ++i)
+    {
+        const auto discardKind = discardKinds[static_cast<std::size_t>(i)];
+        if (discardKind == MATCH || (discardKind == MANY_MATCHES && !isDiscardableMultimatch(discardKinds, i, file.comparedStart, file.comparedEnd - 1)))
+        {
+            file.comparedLines.push_back(file.lines[static_cast<std::size_t>(i)]);
+            file.comparedIndices.push_back(i);
+        }
+        else
+        {
+            file.setChanged(i, true);
+        }
+    }
+}
+
+auto LineDiff::isDiscardableMultimatch(const std::vector<char>& discardKinds, const std::ptrdiff_t index, std::ptrdiff_t start, std::ptrdiff_t end) -> bool
+{
+    const auto kindAt = [&discardKinds](const std::ptrdiff_t i) { return discardKinds[static_cast<std::size_t>(i)]; };
+
+    start = std::max(start, index - SIMILAR_SCAN_WINDOW);
+    end = std::min(end, index + SIMILAR_SCAN_WINDOW);
+
+    auto noMatchesBefore = std::ptrdiff_t{ 0 };
+    auto manyMatchesBefore = std::ptrdiff_t{ 1 };
+    for (auto i = index - 1; i >= start; --i)
+    {
+        if (kindAt(i) == 0)
+        {
+            ++noMatchesBefore;
+        }
+        else if (kindAt(i) == 2)
+        {
+            ++manyMatchesBefore;
+        }
+        else
+        {
+            break;
+        }
+    }
+
+    if (noMatchesBefore == 0)
+    {
+        return false;
+    }
+
+    auto noMatchesAfter = std::ptrdiff_t{ 0 };
+    auto manyMatchesAfter = std::ptrdiff_t{ 1 };
+    for (auto i = index + 1; i <= end; ++i)
+    {
+        if (kindAt(i) == 0)
+        {
+            ++noMatchesAfter;
+        }
+        else if (kindAt(i) == 2)
+        {
+            ++manyMatchesAfter;
+        }
+        else
+        {
+            break;
+        }
+    }
+
+    if (noMatchesAfter == 0)
+    {
+        return false;
+    }
+
+    const auto noMatches = noMatchesBefore + noMatchesAfter;
+    const auto manyMatches = manyMatchesBefore + manyMatchesAfter;
+
+    return manyMatches * KEEP_DISCARDED_RUN < manyMatches + noMatches;
+}
+
+auto LineDiff::approximateSqrt(std::ptrdiff_t value) -> std::ptrdiff_t
+{
+    auto result = std::ptrdiff_t{ 1 };
+    for (; value > 0; value >>= 2)
+    {
+        result <<= 1;
+    }
+
+    return result;
+}
+
+auto LineDiff::compareRange(DiffSide& oldFile, std::ptrdiff_t oldBegin, std::ptrdiff_t oldEnd, DiffSide& newFile, std::ptrdiff_t newBegin, std::ptrdiff_t newEnd, const bool needMinimal, SearchContext& context) -> void
+{
+    const auto& oldLines = oldFile.comparedLines;
+    const auto& newLines = newFile.comparedLines;
+
+    while (oldBegin < oldEnd && newBegin < newEnd && oldLines[static_cast<std::size_t>(oldBegin)] == newLines[static_cast<std::size_t>(newBegin)])
+    {
+        ++oldBegin;
+        ++newBegin;
+    }
+    while (oldBegin < oldEnd && newBegin < newEnd && oldLines[static_cast<std::size_t>(oldEnd - 1)] == newLines[static_cast<std::size_t>(newEnd - 1)])
+    {
+        --oldEnd;
+        --newEnd;
+    }
+
+    if (oldBegin == oldEnd)
+    {
+        for (auto i = newBegin; i < newEnd; ++i)
+        {
+            newFile.setChanged(newFile.comparedIndices[static_cast<std::size_t>(i)], true);
+        }
+    }
+    else if (newBegin == newEnd)
+    {
+        for (auto i = oldBegin; i < oldEnd; ++i)
+        {
+            oldFile.setChanged(oldFile.comparedIndices[static_cast<std::size_t>(i)], true);
+        }
+    }
+    else
+    {
+        const auto split = splitRange(oldFile, oldBegin, oldEnd, newFile, newBegin, newEnd, needMinimal, context);
+
+        compareRange(oldFile, oldBegin, split.oldSplit, newFile, newBegin, split.newSplit, split.minimalLow, context);
+        compareRange(oldFile, split.oldSplit, oldEnd, newFile, split.newSplit, newEnd, split.minimalHigh, context);
+    }
+}
+
+auto LineDiff::splitRange(const DiffSide& oldFile, const std::ptrdiff_t oldBegin, const std::ptrdiff_t oldEnd, const DiffSide& newFile, const std::ptrdiff_t newBegin, const std::ptrdiff_t newEnd, const bool needMinimal, SearchContext& context) -> Split
+{
+    // Myers' bisection, the same as xdl_split() of git's xdiff: paths of the same cost are extended from both corners until they overlap.
+    // Diagonal d holds points where oldIndex - newIndex == d, forward paths store the furthest oldIndex, backward paths the nearest one.
+    const auto oldLine = [&oldFile](const std::ptrdiff_t index) { return oldFile.comparedLines[static_cast<std::size_t>(index)]; };
+    const auto newLine = [&newFile](const std::ptrdiff_t index) { return newFile.comparedLines[static_cast<std::size_t>(index)]; };
+
+    const auto minDiagonal = oldBegin - newEnd;
+    const auto maxDiagonal = oldEnd - newBegin;
+    const auto forwardMid = oldBegin - newBegin;
+    const auto backwardMid = oldEnd - newEnd;
+    const auto isOdd = ((forwardMid - backwardMid) & 1) != 0;
+
+    auto forwardMin = forwardMid;
+    auto forwardMax = forwardMid;
+    auto backwardMin = backwardMid;
+    auto backwardMax = backwardMid;
+
+    context.forwardAt(forwardMid) = oldBegin;
+    context.backwardAt(backwardMid) = oldEnd;
+
+    for (auto cost = std::ptrdiff_t{ 1 };; ++cost)
+    {
+        auto gotSnake = false;
+
+        if (forwardMin > minDiagonal)
+        {
+            context.forwardAt(--forwardMin - 1) = -1;
+        }
+        else
+        {
+            ++forwardMin;
+        }
+        if (forwardMax < maxDiagonal)
+        {
+            context.forwardAt(++forwardMax + 1) = -1;
+        }
+        else
+        {
+            --forwardMax;
+        }
+
+        for (auto diagonal = forwardMax; diagonal >= forwardMin; diagonal -= 2)
+        {
+            auto oldIndex = (context.forwardAt(diagonal - 1) >= context.forwardAt(diagonal + 1) ? context.forwardAt(diagonal - 1) + 1 : context.forwardAt(diagonal + 1));
+            const auto previousOldIndex = oldIndex;
+            auto newIndex = oldIndex - diagonal;
+            while (oldIndex < oldEnd && newIndex < newEnd && oldLine(oldIndex) == newLine(newIndex))
+            {
+                ++oldIndex;
+                ++newIndex;
+            }
+            if (oldIndex - previousOldIndex > SNAKE_COUNT)
+            {
+                gotSnake = true;
+            }
+            context.forwardAt(diagonal) = oldIndex;
+
+            if (isOdd && backwardMin <= diagonal && diagonal <= backwardMax && context.backwardAt(diagonal) <= oldIndex)
+            {
+                return Split{ .oldSplit = oldIndex, .newSplit = newIndex, .minimalLow = true, .minimalHigh = true };
+            }
+        }
+
+        if (backwardMin > minDiagonal)
+        {
+            context.backwardAt(--backwardMin - 1) = std::numeric_limits<std::ptrdiff_t>::max();
+        }
+        else
+        {
+            ++backwardMin;
+        }
+        if (backwardMax < maxDiagonal)
+        {
+            context.backwardAt(++backwardMax + 1) = std::numeric_limits<std::ptrdiff_t>::max();
+        }
+        else
+        {
+            --backwardMax;
+        }
+
+        for (auto diagonal = backwardMax; diagonal >= backwardMin; diagonal -= 2)
+        {
+            auto oldIndex = (context.backwardAt(diagonal - 1) < context.backwardAt(diagonal + 1) ? context.backwardAt(diagonal - 1) : context.backwardAt(diagonal + 1) - 1);
+            const auto previousOldIndex = oldIndex;
+            auto newIndex = oldIndex - diagonal;
+            while (oldIndex > oldBegin && newIndex > newBegin && oldLine(oldIndex - 1) == newLine(newIndex - 1))
+            {
+                --oldIndex;
+                --newIndex;
+            }
+            if (previousOldIndex - oldIndex > SNAKE_COUNT)
+            {
+                gotSnake = true;
+            }
+            context.backwardAt(diagonal) = oldIndex;
+
+            if (!isOdd && forwardMin <= diagonal && diagonal <= forwardMax && oldIndex <= context.forwardAt(diagonal))
+            {
+                return Split{ .oldSplit = oldIndex, .newSplit = newIndex, .minimalLow = true, .minimalHigh = true };
+            }
+        }
+
+        if (needMinimal)
+        {
+            continue;
+        }
+
+        // When the cost gets high, a path that went far enough and ends with a long snake is good enough
+        if (gotSnake && cost > HEURISTIC_MIN_COST)
+        {
+            auto best = std::ptrdiff_t{ 0 };
+            auto split = Split{ .oldSplit = 0, .newSplit = 0, .minimalLow = true, .minimalHigh = false };
+            for (auto diagonal = forwardMax; diagonal >= forwardMin; diagonal -= 2)
+            {
+                const auto distanceFromMid = (diagonal > forwardMid ? diagonal - forwardMid : forwardMid - diagonal);
+                const auto oldIndex = context.forwardAt(diagonal);
+                const auto newIndex = oldIndex - diagonal;
+                const auto value = (oldIndex - oldBegin) + (newIndex - newBegin) - distanceFromMid;
+
+                if (value > HEURISTIC_FACTOR * cost && value > best && oldBegin + SNAKE_COUNT <= oldIndex && oldIndex < oldEnd && newBegin + SNAKE_COUNT <= newIndex && newIndex < newEnd)
+                {
+                    for (auto k = std::ptrdiff_t{ 1 }; oldLine(oldIndex - k) == newLine(newIndex - k); ++k)
+                    {
+                        if (k == SNAKE_COUNT)
+                        {
+                            best = value;
+                            split.oldSplit = oldIndex;
+                            split.newSplit = newIndex;
+                            break;
+                        }
+                    }
+                }
+            }
+            if (best > 0)
+            {
+                return split;
+            }
+
+            split = Split{ .oldSplit = 0, .newSplit = 0, .minimalLow = false, .minimalHigh = true };
+            for (auto diagonal = backwardMax; diagonal >= backwardMin; diagonal -= 2)
+            {
+                const auto distanceFromMid = (diagonal > backwardMid ? diagonal - backwardMid : backwardMid - diagonal);
+                const auto oldIndex = context.backwardAt(diagonal);
+                const auto newIndex = oldIndex - diagonal;
+                const auto value = (oldEnd - oldIndex) + (newEnd - newIndex) - distanceFromMid;
+
+                if (value > HEURISTIC_FACTOR * cost && value > best && oldBegin < oldIndex && oldIndex <= oldEnd - SNAKE_COUNT && newBegin < newIndex && newIndex <= newEnd - SNAKE_COUNT)
+                {
+                    for (auto k = std::ptrdiff_t{ 0 }; oldLine(oldIndex + k) == newLine(newIndex + k); ++k)
+                    {
+                        if (k == SNAKE_COUNT - 1)
+                        {
+                            best = value;
+                            split.oldSplit = oldIndex;
+                            split.newSplit = newIndex;
+                            break;
+                        }
+                    }
+                }
+            }
+            if (best > 0)
+            {
+                return split;
+            }
+        }
+
+        // Too expensive, take the furthest reaching path of either direction
+        if (cost >= context.maxCost)
+        {
+            auto forwardBest = std::ptrdiff_t{ -1 };
+            auto forwardBestOldIndex = std::ptrdiff_t{ -1 };
+            for (auto diagonal = forwardMax; diagonal >= forwardMin; diagonal -= 2)
+            {
+                auto oldIndex = std::min(context.forwardAt(diagonal), oldEnd);
+                auto newIndex = oldIndex - diagonal;
+                if (newEnd < newIndex)
+                {
+                    oldIndex = newEnd + diagonal;
+                    newIndex = newEnd;
+                }
+                if (forwardBest < oldIndex + newIndex)
+                {
+                    forwardBest = oldIndex + newIndex;
+                    forwardBestOldIndex = oldIndex;
+                }
+            }
+
+            auto backwardBest = std::numeric_limits<std::ptrdiff_t>::max();
+            auto backwardBestOldIndex = std::numeric_limits<std::ptrdiff_t>::max();
+            for (auto diagonal = backwardMax; diagonal >= backwardMin; diagonal -= 2)
+            {
+                auto oldIndex = std::max(oldBegin, context.backwardAt(diagonal));
+                auto newIndex = oldIndex - diagonal;
+                if (newIndex < newBegin)
+                {
+                    oldIndex = newBegin + diagonal;
+                    newIndex = newBegin;
+                }
+                if (oldIndex + newIndex < backwardBest)
+                {
+                    backwardBest = oldIndex + newIndex;
+                    backwardBestOldIndex = oldIndex;
+                }
+            }
+
+            if ((oldEnd + newEnd) - backwardBest < forwardBest - (oldBegin + newBegin))
+            {
+                return Split{ .oldSplit = forwardBestOldIndex, .newSplit = forwardBest - forwardBestOldIndex, .minimalLow = true, .minimalHigh = false };
+            }
+
+            return Split{ .oldSplit = backwardBestOldIndex, .newSplit = backwardBest - backwardBestOldIndex, .minimalLow = false, .minimalHigh = true };
+        }
+    }
+}
+
+auto LineDiff::patienceDiff(DiffSide& oldFile, std::ptrdiff_t oldBegin, const std::ptrdiff_t oldEnd, DiffSide& newFile, std::ptrdiff_t newBegin, const std::ptrdiff_t newEnd) -> void
+{
+    // Same as git's xpatience.c: lines unique in both ranges are matched by the longest increasing sequence,
+    // matches are extended by equal neighbouring lines and ranges between them are diffed recursively
+    constexpr auto NOT_MATCHED = std::ptrdiff_t{ -1 };
+    constexpr auto NOT_UNIQUE = std::ptrdiff_t{ -2 };
+
+    if (oldBegin == oldEnd)
+    {
+        markChanged(newFile, newBegin, newEnd);
+        return;
+    }
+    if (newBegin == newEnd)
+    {
+        markChanged(oldFile, oldBegin, oldEnd);
+        return;
+    }
+
+    auto entries = std::vector<PatienceEntry>{};
+    auto entryIndices = std::unordered_map<LineId, std::size_t>{};
+    for (auto i = oldBegin; i < oldEnd; ++i)
+    {
+        const auto [entryIt, inserted] = entryIndices.try_emplace(oldFile.lines[static_cast<std::size_t>(i)], entries.size());
+        if (inserted)
+        {
+            entries.push_back(PatienceEntry{ .oldIndex = i, .newIndex = NOT_MATCHED });
+        }
+        else
+        {
+            entries[entryIt->second].newIndex = NOT_UNIQUE;
+        }
+    }
+
+    auto hasMatches = false;
+    for (auto i = newBegin; i < newEnd; ++i)
+    {
+        const auto entryIt = entryIndices.find(newFile.lines[static_cast<std::size_t>(i)]);
+        if (entryIt == entryIndices.end())
+        {
+            continue;
+        }
+
+        hasMatches = true;
+        auto& entry = entries[entryIt->second];
+        entry.newIndex = (entry.newIndex == NOT_MATCHED ? i : NOT_UNIQUE);
+    }
+
+    if (!hasMatches)
+    {
+        markChanged(oldFile, oldBegin, oldEnd);
+        markChanged(newFile, newBegin, newEnd);
+        return;
+    }
+
+    const auto sequence = findPatienceSequence(entries);
+    if (sequence.empty())
+    {
+        fallBackToMyersDiff(oldFile, oldBegin, oldEnd, newFile, newBegin, newEnd);
+        return;
+    }
+
+    const auto linesMatch = [&oldFile, &newFile](const std::ptrdiff_t oldIndex, const std::ptrdiff_t newIndex) {
+        return oldFile.lines[static_cast<std::size_t>(oldIndex)] == newFile.lines[static_cast<std::size_t>(newIndex)];
+    };
+
+    auto sequenceIt = sequence.begin();
+    while (true)
+    {
+        auto nextOld = oldEnd;
+        auto nextNew = newEnd;
+        if (sequenceIt != sequence.end())
+        {
+            nextOld = sequenceIt->oldIndex;
+            nextNew = sequenceIt->newIndex;
+            while (nextOld > oldBegin && nextNew > newBegin && linesMatch(nextOld - 1, nextNew - 1))
+            {
+                --nextOld;
+                --nextNew;
+            }
+        }
+        while (oldBegin < nextOld && newBegin < nextNew && linesMatch(oldBegin, newBegin))
+        {
+            ++oldBegin;
+            ++newBegin;
+        }
+
+        if (nextOld > oldBegin || nextNew > newBegin)
+        {
+            patienceDiff(oldFile, oldBegin, nextOld, newFile, newBegin, nextNew);
+        }
+
+        if (sequenceIt == sequence.end())
+        {
+            return;
+        }
+
+        while (std::next(sequenceIt) != sequence.end() && std::next(sequenceIt)->oldIndex == sequenceIt->oldIndex + 1 && std::next(sequenceIt)->newIndex == sequenceIt->newIndex + 1)
+        {
+            ++sequenceIt;
+        }
+
+        oldBegin = sequenceIt->oldIndex + 1;
+        newBegin = sequenceIt->newIndex + 1;
+        ++sequenceIt;
+    }
+}
+
+auto LineDiff::findPatienceSequence(std::vector<PatienceEntry>& entries) -> std::vector<PatienceEntry>
+{
+    // Patience sorting: for every length only the sequence ending with the smallest position in the new file is kept
+    auto sequenceEnds = std::vector<std::size_t>{};
+    auto previousEntries = std::vector<std::ptrdiff_t>(entries.size(), -1);
+
+    for (auto entryIndex = std::size_t{ 0 }; entryIndex < entries.size(); ++entryIndex)
+    {
+        const auto& entry = entries[entryIndex];
+        if (entry.newIndex < 0)
+        {
+            continue;
+        }
+
+        const auto sequenceEndIt = std::ranges::partition_point(sequenceEnds, [&entries, &entry](const std::size_t endIndex) { return entries[endIndex].newIndex < entry.newIndex; });
+        if (sequenceEndIt != sequenceEnds.begin())
+        {
+            previousEntries[entryIndex] = static_cast<std::ptrdiff_t>(*std::prev(sequenceEndIt));
+        }
+
+        if (sequenceEndIt == sequenceEnds.end())
+        {
+            sequenceEnds.push_back(entryIndex);
+        }
+        else
+        {
+            *sequenceEndIt = entryIndex;
+        }
+    }
+
+    auto sequence = std::vector<PatienceEntry>{};
+    if (sequenceEnds.empty())
+    {
+        return sequence;
+    }
+
+    for (auto entryIndex = static_cast<std::ptrdiff_t>(sequenceEnds.back()); entryIndex != -1; entryIndex = previousEntries[static_cast<std::size_t>(entryIndex)])
+    {
+        sequence.push_back(entries[static_cast<std::size_t>(entryIndex)]);
+    }
+    std::ranges::reverse(sequence);
+
+    return sequence;
+}
+
+auto LineDiff::histogramDiff(DiffSide& oldFile, std::ptrdiff_t oldBegin, const std::ptrdiff_t oldEnd, DiffSide& newFile, std::ptrdiff_t newBegin, const std::ptrdiff_t newEnd) -> void
+{
+    while (true)
+    {
+        if (oldBegin == oldEnd)
+        {
+            markChanged(newFile, newBegin, newEnd);
+            return;
+        }
+        if (newBegin == newEnd)
+        {
+            markChanged(oldFile, oldBegin, oldEnd);
+            return;
+        }
+
+        const auto searchResult = findHistogramRegion(oldFile, oldBegin, oldEnd, newFile, newBegin, newEnd);
+        if (searchResult.fallBack)
+        {
+            fallBackToMyersDiff(oldFile, oldBegin, oldEnd, newFile, newBegin, newEnd);
+            return;
+        }
+        if (!searchResult.region)
+        {
+            markChanged(oldFile, oldBegin, oldEnd);
+            markChanged(newFile, newBegin, newEnd);
+            return;
+        }
+
+        const auto& region = *searchResult.region;
+        histogramDiff(oldFile, oldBegin, region.oldBegin, newFile, newBegin, region.newBegin);
+
+        oldBegin = region.oldEnd + 1;
+        newBegin = region.newEnd + 1;
+    }
+}
+
+auto LineDiff::findHistogramRegion(const DiffSide& oldFile, const std::ptrdiff_t oldBegin, const std::ptrdiff_t oldEnd, const DiffSide& newFile, const std::ptrdiff_t newBegin, const std::ptrdiff_t newEnd) -> HistogramSearchResult
+{
+    // Same as find_lcs() of git's xhistogram.c: the longest common region is searched, preferring regions whose lines occur less often in the old range
+    constexpr auto NO_NEXT = std::ptrdiff_t{ -1 };
+
+    const auto oldLine = [&oldFile](const std::ptrdiff_t index) { return oldFile.lines[static_cast<std::size_t>(index)]; };
+    const auto newLine = [&newFile](const std::ptrdiff_t index) { return newFile.lines[static_cast<std::size_t>(index)]; };
+
+    auto records = std::vector<HistogramRecord>{};
+    auto recordIndices = std::unordered_map<LineId, std::size_t>{};
+    auto lineRecords = std::vector<std::size_t>(static_cast<std::size_t>(oldEnd - oldBegin));
+    auto nextOccurrences = std::vector<std::ptrdiff_t>(static_cast<std::size_t>(oldEnd - oldBegin), NO_NEXT);
+
+    for (auto i = oldEnd - 1; i >= oldBegin; --i)
+    {
+        const auto [recordIt, inserted] = recordIndices.try_emplace(oldLine(i), records.size());
+        if (inserted)
+        {
+            records.push_back(HistogramRecord{ .firstIndex = i, .count = 1 });
+        }
+        else
+        {
+            auto& record = records[recordIt->second];
+            nextOccurrences[static_cast<std::size_t>(i - oldBegin)] = record.firstIndex;
+            record.firstIndex = i;
+            ++record.count;
+        }
+        lineRecords[static_cast<std::size_t>(i - oldBegin)] = recordIt->second;
+    }
+
+    const auto occurrencesCount = [&](const std::ptrdiff_t index) { return records[lineRecords[static_cast<std::size_t>(index - oldBegin)]].count; };
+    const auto nextOccurrence = [&](const std::ptrdiff_t index) { return nextOccurrences[static_cast<std::size_t>(index - oldBegin)]; };
+
+    auto result = HistogramSearchResult{ .region = std::nullopt, .fallBack = false };
+    auto hasCommon = false;
+    auto lowestCount = HISTOGRAM_MAX_CHAIN_LENGTH + 1;
+
+    for (auto newIndex = newBegin; newIndex < newEnd;)
+    {
+        auto nextNewIndex = newIndex + 1;
+
+        const auto recordIt = recordIndices.find(newLine(newIndex));
+        if (recordIt == recordIndices.end())
+        {
+            newIndex = nextNewIndex;
+            continue;
+        }
+
+        const auto& record = records[recordIt->second];
+        hasCommon = true;
+        if (record.count > lowestCount)
+        {
+            newIndex = nextNewIndex;
+            continue;
+        }
+
+        for (auto oldIndex = record.firstIndex;;)
+        {
+            auto nextOldIndex = nextOccurrence(oldIndex);
+            auto regionOldBegin = oldIndex;
+            auto regionOldEnd = oldIndex;
+            auto regionNewBegin = newIndex;
+            auto regionNewEnd = newIndex;
+            auto regionCount = record.count;
+
+            while (oldBegin < regionOldBegin && newBegin < regionNewBegin && oldLine(regionOldBegin - 1) == newLine(regionNewBegin - 1))
+            {
+                --regionOldBegin;
+                --regionNewBegin;
+                if (1 < regionCount)
+                {
+                    regionCount = std::min(regionCount, occurrencesCount(regionOldBegin));
+                }
+            }
+            while (regionOldEnd < oldEnd - 1 && regionNewEnd < newEnd - 1 && oldLine(regionOldEnd + 1) == newLine(regionNewEnd + 1))
+            {
+                ++regionOldEnd;
+                ++regionNewEnd;
+                if (1 < regionCount)
+                {
+                    regionCount = std::min(regionCount, occurrencesCount(regionOldEnd));
+                }
+            }
+
+            nextNewIndex = std::max(nextNewIndex, regionNewEnd + 1);
+
+            const auto bestLength = (result.region ? result.region->oldEnd - result.region->oldBegin : 0);
+            if (bestLength < regionOldEnd - regionOldBegin || regionCount < lowestCount)
+            {
+                result.region = HistogramRegion{ .oldBegin = regionOldBegin, .oldEnd = regionOldEnd, .newBegin = regionNewBegin, .newEnd = regionNewEnd };
+                lowestCount = regionCount;
+            }
+
+            while (nextOldIndex != NO_NEXT && nextOldIndex <= regionOldEnd)
+            {
+                nextOldIndex = nextOccurrence(nextOldIndex);
+            }
+            if (nextOldIndex == NO_NEXT)
+            {
+                break;
+            }
+            oldIndex = nextOldIndex;
+        }
+
+        newIndex = nextNewIndex;
+    }
+
+    // All common lines occur too often, the region isn't a good split point
+    result.fallBack = (hasCommon && HISTOGRAM_MAX_CHAIN_LENGTH < lowestCount);
+
+    return result;
+}
+
+auto LineDiff::compact(DiffSide& file, DiffSide& otherFile, const bool indentHeuristic) -> void
+{
+    // Mirrors xdl_change_compact() of git's xdiff: every group of changes is slid up and down as far as possible, merging with neighbouring groups,
+    // then it's lined up with the last matching group of the other file, placed by indent heuristic or left at the lowest position
+    auto group = initGroup(file);
+    auto otherGroup = initGroup(otherFile);
+
+    const auto throwOutOfSync = [] { throw std::runtime_error("Line diff groups out of sync"); };
+
+    while (true)
+    {
+        if (group.end != group.start)
+        {
+            auto groupSize = std::ptrdiff_t{ 0 };
+            auto earliestEnd = std::ptrdiff_t{ 0 };
+            auto endMatchingOther = std::ptrdiff_t{ -1 };
+
+            do
+            {
+                groupSize = group.end - group.start;
+                endMatchingOther = -1;
+
+                while (slideGroupUp(file, group))
+                {
+                    if (!previousGroup(otherFile, otherGroup))
+                    {
+                        throwOutOfSync();
+                    }
+                }
+
+                earliestEnd = group.end;
+                if (otherGroup.end > otherGroup.start)
+                {
+                    endMatchingOther = group.end;
+                }
+
+                while (slideGroupDown(file, group))
+                {
+                    if (!nextGroup(otherFile, otherGroup))
+                    {
+                        throwOutOfSync();
+                    }
+                    if (otherGroup.end > otherGroup.start)
+                    {
+                        endMatchingOther = group.end;
+                    }
+                }
+            } while (groupSize != group.end - group.start);
+
+            if (group.end == earliestEnd)
+            {
+                // The group can't be slid
+            }
+            else if (endMatchingOther != -1)
+            {
+                while (otherGroup.end == otherGroup.start)
+                {
+                    if (!slideGroupUp(file, group) || !previousGroup(otherFile, otherGroup))
+                    {
+                        throwOutOfSync();
+                    }
+                }
+            }
+            else if (indentHeuristic)
+            {
+                const auto bestShift = findBestIndentShift(file, group, earliestEnd, groupSize);
+                while (group.end > bestShift)
+                {
+                    if (!slideGroupUp(file, group) || !previousGroup(otherFile, otherGroup))
+                    {
+                        throwOutOfSync();
+                    }
+                }
+            }
+        }
+
+        if (!nextGroup(file, group))
+        {
+            break;
+        }
+        if (!nextGroup(otherFile, otherGroup))
+        {
+            throwOutOfSync();
+        }
+    }
+}
+
+auto LineDiff::findBestIndentShift(const DiffSide& file, const Group& group, const std::ptrdiff_t earliestEnd, const std::ptrdiff_t groupSize) -> std::ptrdiff_t
+{
+    // Every position of the group gives two splits (before and after the group), the position with the best sum of their scores wins
+    auto shift = std::max({ earliestEnd, group.end - groupSize - 1, group.end - INDENT_HEURISTIC_MAX_SLIDING });
+    auto bestShift = std::ptrdiff_t{ -1 };
+    auto bestScore = SplitScore{ .effectiveIndent = 0, .penalty = 0 };
+
+    for (; shift <= group.end; ++shift)
+    {
+        auto score = SplitScore{ .effectiveIndent = 0, .penalty = 0 };
+        addSplitScore(measureSplit(file, shift), score);
+        addSplitScore(measureSplit(file, shift - groupSize), score);
+
+        if (bestShift == -1 || compareScores(score, bestScore) <= 0)
+        {
+            bestScore = score;
+            bestShift = shift;
+        }
+    }
+
+    return bestShift;
+}
+
+auto LineDiff::getIndent(const std::string_view line) -> int
+{
+    auto indent = 0;
+    for (const auto character : line)
+    {
+        if (std::isspace(static_cast<unsigned char>(character)) == 0)
+        {
+            return indent;
+        }
+
+        if (character == ' ')
+        {
+            indent += 1;
+        }
+        else if (character == '\t')
+        {
+            indent += 8 - (indent % 8);
+        }
+
+        if (indent >= MAX_INDENT)
+        {
+            return MAX_INDENT;
+        }
+    }
+
+    // Line contains only whitespace
+    return -1;
+}
+
+auto LineDiff::measureSplit(const DiffSide& file, const std::ptrdiff_t split) -> SplitMeasurement
+{
+    const auto indentAt = [&file](const std::ptrdiff_t index) { return file.indents[static_cast<std::size_t>(index)]; };
+
+    auto measurement = SplitMeasurement{ .endOfFile = split >= file.size(), .indent = -1, .preBlank = 0, .preIndent = -1, .postBlank = 0, .postIndent = -1 };
+    if (!measurement.endOfFile)
+    {
+        measurement.indent = indentAt(split);
+    }
+
+    for (auto i = split - 1; i >= 0; --i)
+    {
+        measurement.preIndent = indentAt(i);
+        if (measurement.preIndent != -1)
+        {
+            break;
+        }
+        if (++measurement.preBlank == MAX_BLANKS)
+        {
+            measurement.preIndent = 0;
+            break;
+        }
+    }
+
+    for (auto i = split + 1; i < file.size(); ++i)
+    {
+        measurement.postIndent = indentAt(i);
+        if (measurement.postIndent != -1)
+        {
+            break;
+        }
+        if (++measurement.postBlank == MAX_BLANKS)
+        {
+            measurement.postIndent = 0;
+            break;
+        }
+    }
+
+    return measurement;
+}
+
+auto LineDiff::addSplitScore(const SplitMeasurement& measurement, SplitScore& score) -> void
+{
+    // Weights are the same as in git's xdiff, tuned on a corpus of human-rated diffs
+    constexpr auto START_OF_FILE_PENALTY = 1;
+    constexpr auto END_OF_FILE_PENALTY = 21;
+    constexpr auto TOTAL_BLANK_WEIGHT = -30;
+    constexpr auto POST_BLANK_WEIGHT = 6;
+    constexpr auto RELATIVE_INDENT_PENALTY = -4;
+    constexpr auto RELATIVE_INDENT_WITH_BLANK_PENALTY = 10;
+    constexpr auto RELATIVE_OUTDENT_PENALTY = 24;
+    constexpr auto RELATIVE_OUTDENT_WITH_BLANK_PENALTY = 17;
+    constexpr auto RELATIVE_DEDENT_PENALTY = 23;
+    constexpr auto RELATIVE_DEDENT_WITH_BLANK_PENALTY = 17;
+
+    if (measurement.preIndent == -1 && measurement.preBlank == 0)
+    {
+        score.penalty += START_OF_FILE_PENALTY;
+    }
+    if (measurement.endOfFile)
+    {
+        score.penalty += END_OF_FILE_PENALTY;
+    }
+
+    const auto postBlank = (measurement.indent == -1 ? 1 + measurement.postBlank : 0);
+    const auto totalBlank = measurement.preBlank + postBlank;
+    const auto anyBlanks = (totalBlank != 0);
+
+    score.penalty += TOTAL_BLANK_WEIGHT * totalBlank;
+    score.penalty += POST_BLANK_WEIGHT * postBlank;
+
+    const auto indent = (measurement.indent != -1 ? measurement.indent : measurement.postIndent);
+    score.effectiveIndent += indent;
+
+    if (indent == -1 || measurement.preIndent == -1 || indent == measurement.preIndent)
+    {
+        return;
+    }
+
+    if (indent > measurement.preIndent)
+    {
+        score.penalty += anyBlanks ? RELATIVE_INDENT_WITH_BLANK_PENALTY : RELATIVE_INDENT_PENALTY;
+    }
+    else if (measurement.postIndent != -1 && measurement.postIndent > indent)
+    {
+        // Less indented than the previous line, but the next one is indented more, so it's likely a start of a block
+        score.penalty += anyBlanks ? RELATIVE_OUTDENT_WITH_BLANK_PENALTY : RELATIVE_OUTDENT_PENALTY;
+    }
+    else
+    {
+        score.penalty += anyBlanks ? RELATIVE_DEDENT_WITH_BLANK_PENALTY : RELATIVE_DEDENT_PENALTY;
+    }
+}
+
+auto LineDiff::compareScores(const SplitScore& score, const SplitScore& otherScore) -> int
+{
+    constexpr auto INDENT_WEIGHT = 60;
+
+    const auto indentsComparison = (score.effectiveIndent > otherScore.effectiveIndent ? 1 : 0) - (score.effectiveIndent < otherScore.effectiveIndent ? 1 : 0);
+
+    return (INDENT_WEIGHT * indentsComparison) + (score.penalty - otherScore.penalty);
+}
+
+auto LineDiff::initGroup(const DiffSide& file) -> Group
+{
+    auto group = Group{ .start = 0, .end = 0 };
+    while (file.isChanged(group.end))
+    {
+        ++group.end;
+    }
+
+    return group;
+}
+
+auto LineDiff::nextGroup(const DiffSide& file, Group& group) -> bool
+{
+    if (group.end == file.size())
+    {
+        return false;
+    }
+
+    group.start = group.end + 1;
+    group.end = group.start;
+    while (file.isChanged(group.end))
+    {
+        ++group.end;
+    }
+
+    return true;
+}
+
+auto LineDiff::previousGroup(const DiffSide& file, Group& group) -> bool
+{
+    if (group.start == 0)
+    {
+        return false;
+    }
+
+    group.end = group.start - 1;
+    group.start = group.end;
+    while (file.isChanged(group.start - 1))
+    {
+        --group.start;
+    }
+
+    return true;
+}
+
+auto LineDiff::slideGroupDown(DiffSide& file, Group& group) -> bool
+{
+    if (group.end >= file.size() || file.lines[static_cast<std::size_t>(group.start)] != file.lines[static_cast<std::size_t>(group.end)])
+    {
+        return false;
+    }
+
+    file.setChanged(group.start++, false);
+    file.setChanged(group.end++, true);
+    while (file.isChanged(group.end))
+    {
+        ++group.end;
+    }
+
+    return true;
+}
+
+auto LineDiff::slideGroupUp(DiffSide& file, Group& group) -> bool
+{
+    if (group.start <= 0 || file.lines[static_cast<std::size_t>(group.start - 1)] != file.lines[static_cast<std::size_t>(group.end - 1)])
+    {
+        return false;
+    }
+
+    file.setChanged(--group.start, true);
+    file.setChanged(--group.end, false);
+    while (file.isChanged(group.start - 1))
+    {
+        --group.start;
+    }
+
+    return true;
+}
+
+} // namespace CppGit::_details
@@ -0,0 +1,801 @@
+#include "CppGit/_details/MergeBaseFinder.hpp"
+
+#include "CppGit/Repository.hpp"
+#include "CppGit/Timestamp.hpp"
+#include "CppGit/_details/CommitGraphReader.hpp"
+#include "CppGit/_details/ReferencesReader.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <ranges>
+#include <span>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace CppGit::_details {
+
+namespace {
+
+constexpr auto PARENT1 = std::uint8_t{ 1U << 0U };
+constexpr auto PARENT2 = std::uint8_t{ 1U << 1U };
+constexpr auto STALE = std::uint8_t{ 1U << 2U };
+constexpr auto RESULT = std::uint8_t{ 1U << 3U };
+
+// Commits missing in the commit-graph are walked before all the others, like in git
+constexpr auto GENERATION_INFINITY = std::numeric_limits<std::uint64_t>::max();
+
+// Tags pointing to tags are peeled up to this depth
+constexpr auto MAX_PEEL_DEPTH = 10;
+
+struct QueueEntry
+{
+    std::uint64_t generation;
+    std::uint64_t commitTime;
+    std::uint64_t insertionOrder;
+    std::uint32_t nodeId;
+};
+
+// Max-heap order: higher generation first, then newer commit, then the one inserted earlier
+auto isLowerPriority(const QueueEntry& lhs, const QueueEntry& rhs) -> bool
+{
+    if (lhs.generation != rhs.generation)
+    {
+        return lhs.generation < rhs.generation;
+    }
+    if (lhs.commitTime != rhs.commitTime)
+    {
+        return lhs.commitTime < rhs.commitTime;
+    }
+
+    return lhs.insertionOrder > rhs.insertionOrder;
+}
+
+auto getHeaderValue(const std::string_view line, const std::string_view header) -> std::optional<std::string_view>
+{
+    if (line.size() <= header.size() || !line.starts_with(header) || line[header.size()] != ' ')
+    {
+        return std::nullopt;
+    }
+
+    return line.substr(header.size() + 1);
+}
+
+// Committer line: "<name> <<email>> <timestamp> <timezone>"
+auto parseCommitterTime(const std::string_view committer) -> std::uint64_t
+{
+    const auto emailEnd = committer.rfind('>');
+    if (emailEnd == std::string_view::npos)
+    {
+        return 0;
+    }
+
+    auto date = committer.substr(emailEnd + 1);
+    date.remove_prefix(std::min(date.find_first_not_of(' '), date.size()));
+    const auto timestamp = Timestamp::parse(date);
+
+    return timestamp ? static_cast<std::uint64_t>(std::max(timestamp->secondsSinceEpoch, std::int64_t{ 0 })) : 0;
+}
+
+// The same conditions as git uses to ignore the commit-graph, as it describes history without grafts and replacements
+auto isCommitGraphCompatible(const std::filesystem::path& commonDirectoryPath) -> bool
+{
+    auto error = std::error_code{};
+    const auto replaceRefsPath = commonDirectoryPath / "refs" / "replace";
+    return !std::filesystem::exists(replaceRefsPath, error) || std::filesystem::is_empty(replaceRefsPath, error);
+}
+
+} // namespace
+
+MergeBaseFinder::MergeBaseFinder(const Repository& repo)
+    : repository{ &repo }
+{
+}
+
+auto MergeBaseFinder::initialize() -> void
+{
+    if (initialized)
+    {
+        return;
+    }
+    initialized = true;
+
+    const auto commonDirectoryPath = repository->getCommonDirectoryPath();
+
+    // In shallow and grafted repositories parents differ from the ones stored in the commits, only git knows them
+    auto error = std::error_code{};
+    supported = !std::filesystem::exists(commonDirectoryPath / "shallow", error) && !std::filesystem::exists(commonDirectoryPath / "info" / "grafts", error);
+
+    if (supported && isCommitGraphCompatible(commonDirectoryPath))
+    {
+        commitGraphReader = std::make_unique<CommitGraphReader>(commonDirectoryPath / "objects");
+        if (!commitGraphReader->isValid())
+        {
+            commitGraphReader.reset();
+        }
+    }
+}
+
+auto MergeBaseFinder::getMergeBase(const std::string_view first, const std::string_view second) -> std::optional<std::string>
+{
+    const auto lock = std::lock_guard{ mutex };
+    initialize();
+
+    auto referencesReader = createReferencesReader();
+    const auto firstNode = resolveCommit(referencesReader, first);
+    const auto secondNode = resolveCommit(referencesReader, second);
+    if (!firstNode || !secondNode)
+    {
+        return std::nullopt;
+    }
+
+    return getMergeBaseImpl(*firstNode, *secondNode);
+}
+
+auto MergeBaseFinder::getMergeBases(const std::vector<std::pair<std::string, std::string>>& pairs) -> std::vector<std::optional<std::string>>
+{
+    const auto lock = std::lock_guard{ mutex };
+    initialize();
+
+    auto mergeBases = std::vector<std::optional<std::string>>(pairs.size());
+    auto referencesReader = createReferencesReader();
+
+    auto pairsNodes = std::vector<std::optional<std::pair<NodeId, NodeId>>>{};
+    pairsNodes.reserve(pairs.size());
+    auto sidesCounts = std::unordered_map<NodeId, std::size_t>{};
+    for (const auto& [first, second] : pairs)
+    {
+        const auto firstNode = resolveCommit(referencesReader, first);
+        const auto secondNode = resolveCommit(referencesReader, second);
+        if (!firstNode || !secondNode)
+        {
+            pairsNodes.emplace_back(std::nullopt);
+            continue;
+        }
+
+        pairsNodes.emplace_back(std::pair{ *firstNode, *secondNode });
+        ++sidesCounts[*firstNode];
+        ++sidesCounts[*secondNode];
+    }
+
+    // Every pair is grouped by its side shared with the most other pairs
+    auto groups = std::vector<std::pair<NodeId, std::vector<std::size_t>>>{};
+    auto groupsByShared = std::unordered_map<NodeId, std::size_t>{};
+    for (auto i = std::size_t{ 0 }; i < pairsNodes.size(); ++i)
+    {
+        if (!pairsNodes[i])
+        {
+            continue;
+        }
+
+        const auto [first, second] = *pairsNodes[i];
+        const auto shared = sidesCounts[first] > sidesCounts[second] ? first : second;
+        const auto [groupIt, inserted] = groupsByShared.try_emplace(shared, groups.size());
+        if (inserted)
+        {
+            groups.emplace_back(shared, std::vector<std::size_t>{});
+        }
+        groups[groupIt->second].second.push_back(i);
+    }
+
+    for (const auto& [shared, pairsIndexes] : groups)
+    {
+        if (pairsIndexes.size() == 1)
+        {
+            const auto [first, second] = *pairsNodes[pairsIndexes.front()];
+            mergeBases[pairsIndexes.front()] = getMergeBaseImpl(first, second);
+            continue;
+        }
+
+        for (auto chunkStart = std::size_t{ 0 }; chunkStart < pairsIndexes.size(); chunkStart += MAX_SHARED_WALK_PAIRS)
+        {
+            const auto chunk = std::span{ pairsIndexes }.subspan(chunkStart, std::min(MAX_SHARED_WALK_PAIRS, pairsIndexes.size() - chunkStart));
+
+            auto chunkPairs = std::vector<std::pair<NodeId, NodeId>>{};
+            chunkPairs.reserve(chunk.size());
+            for (const auto pairIndex : chunk)
+            {
+                chunkPairs.push_back(*pairsNodes[pairIndex]);
+            }
+
+            if (auto chunkMergeBases = getSharedMergeBases(shared, chunkPairs); chunkMergeBases)
+            {
+                for (auto i = std::size_t{ 0 }; i < chunk.size(); ++i)
+                {
+                    mergeBases[chunk[i]] = std::move((*chunkMergeBases)[i]);
+                }
+            }
+        }
+    }
+
+    return mergeBases;
+}
+
+auto MergeBaseFinder::isAncestor(const std::string_view ancestor, const std::string_view descendant) -> std::optional<bool>
+{
+    const auto lock = std::lock_guard{ mutex };
+    initialize();
+
+    auto result = areAncestorsImpl({ std::string{ ancestor } }, descendant);
+    if (!result)
+    {
+        return std::nullopt;
+    }
+
+    return result->front();
+}
+
+auto MergeBaseFinder::areAncestors(const std::vector<std::string>& ancestors, const std::string_view descendant) -> std::optional<std::vector<bool>>
+{
+    const auto lock = std::lock_guard{ mutex };
+    initialize();
+
+    return areAncestorsImpl(ancestors, descendant);
+}
+
+auto MergeBaseFinder::areAncestorsImpl(const std::vector<std::string>& ancestors, const std::string_view descendant) -> std::optional<std::vector<bool>>
+{
+    auto referencesReader = createReferencesReader();
+    const auto descendantNode = resolveCommit(referencesReader, descendant);
+    if (!descendantNode)
+    {
+        return std::nullopt;
+    }
+
+    auto ancestorsNodes = std::vector<NodeId>{};
+    ancestorsNodes.reserve(ancestors.size());
+    for (const auto& ancestor : ancestors)
+    {
+        const auto ancestorNode = resolveCommit(referencesReader, ancestor);
+        if (!ancestorNode)
+        {
+            return std::nullopt;
+        }
+        ancestorsNodes.push_back(*ancestorNode);
+    }
+
+    if (ancestorsNodes.empty())
+    {
+        return std::vector<bool>{};
+    }
+
+    // Commits with lower generation than every possible ancestor can't lead to any of them
+    const auto minGeneration = std::ranges::min(ancestorsNodes | std::views::transform([this](const NodeId nodeId) { return nodes[nodeId].generation; }));
+    if (!markReachable({ *descendantNode }, minGeneration))
+    {
+        clearMarks();
+        return std::nullopt;
+    }
+
+    auto result = std::vector<bool>{};
+    result.reserve(ancestorsNodes.size());
+    for (const auto ancestorNode : ancestorsNodes)
+    {
+        result.push_back((nodes[ancestorNode].flags & PARENT1) != 0);
+    }
+    clearMarks();
+
+    return result;
+}
+
+auto MergeBaseFinder::createReferencesReader() const -> ReferencesReader
+{
+    return ReferencesReader{ repository->getGitDirectoryPath(), repository->getCommonDirectoryPath() };
+}
+
+auto MergeBaseFinder::resolveCommit(ReferencesReader& referencesReader, const std::string_view name) -> std::optional<NodeId>
+{
+    if (!supported)
+    {
+        return std::nullopt;
+    }
+
+    auto lookup = referencesReader.resolveShortRef(name);
+    if (lookup.status != ReferenceLookupStatus::FOUND)
+    {
+        return std::nullopt;
+    }
+
+    return getNode(lookup.value);
+}
+
+auto MergeBaseFinder::getNode(const std::string& hash) -> std::optional<NodeId>
+{
+    if (const auto nodeIt = nodesByHash.find(hash); nodeIt != nodesByHash.end())
+    {
+        return nodeIt->second;
+    }
+
+    if (commitGraphReader)
+    {
+        if (const auto position = commitGraphReader->findCommit(hash); position)
+        {
+            return getNodeByGraphPosition(*position);
+        }
+    }
+
+    auto object = repository->readObject(hash);
+    for (auto depth = 0; object && object->type == "tag" && depth < MAX_PEEL_DEPTH; ++depth)
+    {
+        const auto firstLine = std::string_view{ object->content }.substr(0, object->content.find('\n'));
+        const auto taggedObject = getHeaderValue(firstLine, "object");
+        object = taggedObject ? repository->readObject(*taggedObject) : std::nullopt;
+    }
+
+    if (!object || object->type != "commit")
+    {
+        return std::nullopt;
+    }
+
+    // Peeled tag points to the commit, which may be known already or be in the commit-graph
+    if (object->hash != hash)
+    {
+        return getNode(object->hash);
+    }
+
+    auto node = Node{};
+    node.hash = std::move(object->hash);
+    node.generation = GENERATION_INFINITY;
+    for (const auto line : std::string_view{ object->content } | std::views::split('\n'))
+    {
+        const auto headerLine = std::string_view{ line.begin(), line.end() };
+        if (headerLine.empty())
+        {
+            break;
+        }
+
+        if (const auto parent = getHeaderValue(headerLine, "parent"); parent)
+        {
+            node.parentsHashes.emplace_back(*parent);
+        }
+        else if (const auto committer = getHeaderValue(headerLine, "committer"); committer)
+        {
+            node.commitTime = parseCommitterTime(*committer);
+        }
+    }
+
+    const auto nodeId = static_cast<NodeId>(nodes.size());
+    nodesByHash.emplace(node.hash, nodeId);
+    nodes.push_back(std::move(node));
+
+    return nodeId;
+}
+
+auto MergeBaseFinder::getNodeByGraphPosition(const std::uint32_t position) -> NodeId
+{
+    if (const auto nodeIt = nodesByGraphPosition.find(position); nodeIt != nodesByGraphPosition.end())
+    {
+        return nodeIt->second;
+    }
+
+    const auto nodeId = static_cast<NodeId>(nodes.size());
+    auto& node = nodes.emplace_back();
+    node.hash = commitGraphReader->getCommitHash(position);
+    node.generation = commitGraphReader->getGeneration(position);
+    node.commitTime = commitGraphReader->getCommitTime(position);
+    node.graphPosition = position;
+    nodesByGraphPosition.emplace(position, nodeId);
+    nodesByHash.emplace(node.hash, nodeId);
+
+    return nodeId;
+}
+
+auto MergeBaseFinder::loadParents(const NodeId nodeId) -> bool
+{
+    if (nodes[nodeId].parentsLoaded)
+    {
+        return true;
+    }
+
+    // Nodes vector may grow while parents are added, so the node is always accessed by its id
+    auto parents = std::vector<NodeId>{};
+    if (nodes[nodeId].graphPosition != CommitGraphReader::NO_PARENT)
+    {
+        for (const auto parentPosition : commitGraphReader->getParents(nodes[nodeId].graphPosition))
+        {
+            parents.push_back(getNodeByGraphPosition(parentPosition));
+        }
+    }
+    else
+    {
+        const auto parentsHashes = std::move(nodes[nodeId].parentsHashes);
+        for (const auto& parentHash : parentsHashes)
+        {
+            const auto parentNode = getNode(parentHash);
+            if (!parentNode)
+            {
+                // Missing parent (e.g. partial clone), git knows better what to do
+                nodes[nodeId].parentsHashes = parentsHashes;
+                return false;
+            }
+            parents.push_back(*parentNode);
+        }
+    }
+
+    nodes[nodeId].parents = std::move(parents);
+    nodes[nodeId].parentsLoaded = true;
+
+    return true;
+}
+
+auto MergeBaseFinder::paintDownToCommon(const NodeId first, const NodeId second, const std::uint64_t minGeneration) -> std::optional<std::vector<NodeId>>
+{
+    auto result = std::vector<NodeId>{};
+    auto queue = std::vector<QueueEntry>{};
+    auto insertionOrder = std::uint64_t{ 0 };
+
+    const auto push = [&](const NodeId nodeId) {
+        queue.push_back(QueueEntry{ .generation = nodes[nodeId].generation, .commitTime = nodes[nodeId].commitTime, .insertionOrder = insertionOrder++, .nodeId = nodeId });
+        std::ranges::push_heap(queue, isLowerPriority);
+    };
+
+    markNode(first, PARENT1);
+    push(first);
+    markNode(second, PARENT2);
+    push(second);
+
+    // Walk ends when everything left in the queue is reachable from an already found merge base
+    const auto hasNonStale = [&]() { return std::ranges::any_of(queue, [this](const QueueEntry& entry) { return (nodes[entry.nodeId].flags & STALE) == 0; }); };
+
+    while (hasNonStale())
+    {
+        std::ranges::pop_heap(queue, isLowerPriority);
+        const auto nodeId = queue.back().nodeId;
+        queue.pop_back();
+
+        if (nodes[nodeId].generation < minGeneration)
+        {
+            break;
+        }
+
+        auto flags = static_cast<std::uint8_t>(nodes[nodeId].flags & (PARENT1 | PARENT2 | STALE));
+        if (flags == (PARENT1 | PARENT2))
+        {
+            if ((nodes[nodeId].flags & RESULT) == 0)
+            {
+                markNode(nodeId, RESULT);
+                insertByDate(result, nodeId);
+            }
+
+            // Parents of the found merge base can't be the best merge bases
+            flags |= STALE;
+        }
+
+        if (!loadParents(nodeId))
+        {
+            return std::nullopt;
+        }
+
+        for (const auto parentId : nodes[nodeId].parents)
+        {
+            if ((nodes[parentId].flags & flags) == flags)
+            {
+                continue;
+            }
+
+            markNode(parentId, flags);
+            push(parentId);
+        }
+    }
+
+    return result;
+}
+
+auto MergeBaseFinder::removeRedundant(std::vector<NodeId> candidates) -> std::optional<std::vector<NodeId>>
+{
+    // Candidate reachable from any other candidate isn't the best common ancestor
+    auto redundant = std::vector<bool>(candidates.size(), false);
+    for (auto i = std::size_t{ 0 }; i < candidates.size(); ++i)
+    {
+        auto others = std::vector<NodeId>{};
+        for (auto j = std::size_t{ 0 }; j < candidates.size(); ++j)
+        {
+            if (i != j && !redundant[j])
+            {
+                others.push_back(candidates[j]);
+            }
+        }
+
+        const auto reachable = markReachable(others, nodes[candidates[i]].generation);
+        redundant[i] = reachable && (nodes[candidates[i]].flags & PARENT1) != 0;
+        clearMarks();
+        if (!reachable)
+        {
+            return std::nullopt;
+        }
+    }
+
+    auto result = std::vector<NodeId>{};
+    for (auto i = std::size_t{ 0 }; i < candidates.size(); ++i)
+    {
+        if (!redundant[i])
+        {
+            result.push_back(candidates[i]);
+        }
+    }
+
+    return result;
+}
+
+auto MergeBaseFinder::markReachable(const std::vector<NodeId>& tips, const std::uint64_t minGeneration) -> bool
+{
+    auto stack = std::vector<NodeId>{};
+    for (const auto tip : tips)
+    {
+        if ((nodes[tip].flags & PARENT1) == 0)
+        {
+            markNode(tip, PARENT1);
+            stack.push_back(tip);
+        }
+    }
+
+    while (!stack.empty())
+    {
+        const auto nodeId = stack.back();
+        stack.pop_back();
+
+        // Parents always have lower generation, so they can't reach anything with generation at least minGeneration
+        if (nodes[nodeId].generation <= minGeneration && nodes[nodeId].generation != GENERATION_INFINITY)
+        {
+            continue;
+        }
+
+        if (!loadParents(nodeId))
+        {
+            return false;
+        }
+
+        for (const auto parentId : nodes[nodeId].parents)
+        {
+            if ((nodes[parentId].flags & PARENT1) == 0)
+            {
+                markNode(parentId, PARENT1);
+                stack.push_back(parentId);
+            }
+        }
+    }
+
+    return true;
+}
+
+auto MergeBaseFinder::getMergeBaseImpl(const NodeId first, const NodeId second) -> std::optional<std::string>
+{
+    if (first == second)
+    {
+        return nodes[first].hash;
+    }
+
+    const auto paintResult = paintDownToCommon(first, second, 0);
+    if (!paintResult)
+    {
+        clearMarks();
+        return std::nullopt;
+    }
+
+    auto mergeBases = std::vector<NodeId>{};
+    for (const auto nodeId : *paintResult)
+    {
+        if ((nodes[nodeId].flags & STALE) == 0)
+        {
+            insertByDate(mergeBases, nodeId);
+        }
+    }
+    clearMarks();
+
+    const auto bestMergeBases = selectBestMergeBases(std::move(mergeBases));
+    if (!bestMergeBases)
+    {
+        return std::nullopt;
+    }
+
+    return bestMergeBases->empty() ? std::string{} : nodes[bestMergeBases->front()].hash;
+}
+
+auto MergeBaseFinder::getSharedMergeBases(const NodeId shared, const std::vector<std::pair<NodeId, NodeId>>& pairs) -> std::optional<std::vector<std::optional<std::string>>>
+{
+    auto others = std::vector<NodeId>{};
+    others.reserve(pairs.size());
+    for (const auto& [first, second] : pairs)
+    {
+        others.push_back(first == shared ? second : first);
+    }
+
+    const auto paintResult = paintDownToCommonShared(shared, others);
+    if (!paintResult)
+    {
+        clearMarks();
+        pairsMarks.clear();
+        return std::nullopt;
+    }
+
+    auto candidates = std::vector<std::vector<NodeId>>(others.size());
+    for (auto i = std::size_t{ 0 }; i < others.size(); ++i)
+    {
+        const auto pairBit = std::uint64_t{ 1 } << i;
+        for (const auto nodeId : (*paintResult)[i])
+        {
+            if ((getPairsMarks(nodeId).stale & pairBit) == 0)
+            {
+                insertByDate(candidates[i], nodeId);
+            }
+        }
+    }
+    clearMarks();
+    pairsMarks.clear();
+
+    auto mergeBases = std::vector<std::optional<std::string>>{};
+    mergeBases.reserve(others.size());
+    for (auto i = std::size_t{ 0 }; i < others.size(); ++i)
+    {
+        if (others[i] == shared)
+        {
+            mergeBases.emplace_back(nodes[shared].hash);
+            continue;
+        }
+
+        const auto bestMergeBases = selectBestMergeBases(std::move(candidates[i]));
+        if (!bestMergeBases || bestMergeBases->empty())
+        {
+            mergeBases.push_back(bestMergeBases ? std::optional{ std::string{} } : std::nullopt);
+        }
+        else if (bestMergeBases->size() > 1 && nodes[(*bestMergeBases)[0]].commitTime == nodes[(*bestMergeBases)[1]].commitTime)
+        {
+            // Git prints the merge base found first among equally old ones, which depends on the order of the pair
+            // and the walk of that pair alone
+            const auto [first, second] = pairs[i];
+            mergeBases.push_back(getMergeBaseImpl(first, second));
+        }
+        else
+        {
+            mergeBases.emplace_back(nodes[bestMergeBases->front()].hash);
+        }
+    }
+
+    return mergeBases;
+}
+
+auto MergeBaseFinder::paintDownToCommonShared(const NodeId shared, const std::vector<NodeId>& others) -> std::optional<std::vector<std::vector<NodeId>>>
+{
+    // The same walk as paintDownToCommon(), with PARENT2 and STALE kept for every pair separately.
+    // Shared commit is PARENT1 of all the pairs, so it's painted only once
+    auto results = std::vector<std::vector<NodeId>>(others.size());
+    auto queue = std::vector<QueueEntry>{};
+    auto insertionOrder = std::uint64_t{ 0 };
+    auto walkedPairs = std::uint64_t{ 0 };
+
+    const auto push = [&](const NodeId nodeId) {
+        queue.push_back(QueueEntry{ .generation = nodes[nodeId].generation, .commitTime = nodes[nodeId].commitTime, .insertionOrder = insertionOrder++, .nodeId = nodeId });
+        std::ranges::push_heap(queue, isLowerPriority);
+    };
+
+    markNode(shared, PARENT1);
+    push(shared);
+    for (auto i = std::size_t{ 0 }; i < others.size(); ++i)
+    {
+        // Merge base of the shared commit with itself is known without walking
+        if (others[i] != shared)
+        {
+            walkedPairs |= std::uint64_t{ 1 } << i;
+            getPairsMarks(others[i]).others |= std::uint64_t{ 1 } << i;
+            markNode(others[i], PARENT2);
+            push(others[i]);
+        }
+    }
+
+    // Pairs the commit is painted for and isn't stale in
+    const auto getNonStalePairs = [&](const NodeId nodeId) {
+        const auto& marks = getPairsMarks(nodeId);
+        const auto painted = ((nodes[nodeId].flags & PARENT1) != 0 ? walkedPairs : 0) | marks.others;
+        return painted & ~marks.stale;
+    };
+    const auto hasNonStale = [&]() { return std::ranges::any_of(queue, [&](const QueueEntry& entry) { return getNonStalePairs(entry.nodeId) != 0; }); };
+
+    while (hasNonStale())
+    {
+        std::ranges::pop_heap(queue, isLowerPriority);
+        const auto nodeId = queue.back().nodeId;
+        queue.pop_back();
+
+        const auto isShared = (nodes[nodeId].flags & PARENT1) != 0;
+        auto marks = getPairsMarks(nodeId);
+        const auto common = (isShared ? marks.others : 0) & ~marks.stale;
+        for (auto newResults = common & ~marks.results; newResults != 0; newResults &= newResults - 1)
+        {
+            insertByDate(results[static_cast<std::size_t>(std::countr_zero(newResults))], nodeId);
+        }
+        getPairsMarks(nodeId).results |= common;
+
+        // Parents of the found merge base can't be the best merge bases of that pair
+        marks.stale |= common;
+
+        if (!loadParents(nodeId))
+        {
+            return std::nullopt;
+        }
+
+        for (const auto parentId : nodes[nodeId].parents)
+        {
+            auto& parentMarks = getPairsMarks(parentId);
+            const auto parentShared = (nodes[parentId].flags & PARENT1) != 0;
+            if ((parentShared || !isShared) && (parentMarks.others & marks.others) == marks.others && (parentMarks.stale & marks.stale) == marks.stale)
+            {
+                continue;
+            }
+
+            parentMarks.others |= marks.others;
+            parentMarks.stale |= marks.stale;
+            markNode(parentId, isShared ? PARENT1 : PARENT2);
+            push(parentId);
+        }
+    }
+
+    return results;
+}
+
+auto MergeBaseFinder::selectBestMergeBases(std::vector<NodeId> mergeBases) -> std::optional<std::vector<NodeId>>
+{
+    if (mergeBases.size() > 1)
+    {
+        auto bestMergeBases = removeRedundant(std::move(mergeBases));
+        if (!bestMergeBases)
+        {
+            return std::nullopt;
+        }
+
+        mergeBases.clear();
+        for (const auto nodeId : *bestMergeBases)
+        {
+            insertByDate(mergeBases, nodeId);
+        }
+    }
+
+    return mergeBases;
+}
+
+auto MergeBaseFinder::getPairsMarks(const NodeId nodeId) -> PairsMarks&
+{
+    // Nodes are added during the walk, so marks grow with them
+    if (pairsMarks.size() < nodes.size())
+    {
+        pairsMarks.resize(nodes.size());
+    }
+
+    return pairsMarks[nodeId];
+}
+
+auto MergeBaseFinder::markNode(const NodeId nodeId, const std::uint8_t flags) -> void
+{
+    if (nodes[nodeId].flags == 0)
+    {
+        touchedNodes.push_back(nodeId);
+    }
+    nodes[nodeId].flags |= flags;
+}
+
+auto MergeBaseFinder::clearMarks() -> void
+{
+    for (const auto nodeId : touchedNodes)
+    {
+        nodes[nodeId].flags = 0;
+    }
+    touchedNodes.clear();
+}
+
+auto MergeBaseFinder::insertByDate(std::vector<NodeId>& list, const NodeId nodeId) const -> void
+{
+    // Before the first older commit, so commits with the same date keep their order
+    const auto position = std::ranges::find_if(list, [this, nodeId](const NodeId listNodeId) { return nodes[listNodeId].commitTime < nodes[nodeId].commitTime; });
+    list.insert(position, nodeId);
+}
+
+} // namespace CppGit::_details
@@ -1,9 +1,16 @@
 #include "CppGit/_details/Parser/CommitParser.hpp"
 
 #include "CppGit/Commit.hpp"
+#include "CppGit/ObjectId.hpp"
+#include "CppGit/Timestamp.hpp"
+#include "CppGit/_details/SignaturePool.hpp"
 
+#include <algorithm>
+#include <charconv>
 #include <cstddef>
-#include <regex>
+#include <iterator>
+#include <optional>
+#include <stdexcept>
 #include <string>
 #include <string_view>
 #include <utility>
@@ -13,46 +20,141 @@ namespace CppGit {
 
 auto CommitParser::parseCommit_CatFile(const std::string_view commitLog) -> Commit
 {
-    static constexpr auto regexStr = R"(^tree\s+([a-z0-9]{40})(?:\r\n|\r|\n)(parent [\S\s]+?)?author\s+(.+?)\s+<(.+?)>\s+(\d+ [+-]\d{4})(?:\r\n|\r|\n)committer\s+(.+?)\s+<(.+?)>\s+(\d+ [+-]\d{4})(?:\r\n|\r|\n){2}([\S\s]+?)(?:(?:\r\n|\r|\n){2,}|$)([\s\S]+)?$)";
-    const auto regex = std::regex{ regexStr };
-
-
-    auto match = std::cmatch{};
-    std::regex_search(commitLog.begin(), commitLog.end(), match, regex);
-
-    constexpr auto treeHashIndex = std::size_t{ 1 };
-    constexpr auto parentIndex = std::size_t{ 2 };
-    constexpr auto authorNameIndex = std::size_t{ 3 };
-    constexpr auto authorEmailIndex = std::size_t{ 4 };
-    constexpr auto authorDateIndex = std::size_t{ 5 };
-    constexpr auto committerNameIndex = std::size_t{ 6 };
-    constexpr auto committerEmailIndex = std::size_t{ 7 };
-    constexpr auto committerDateIndex = std::size_t{ 8 };
-    constexpr auto messageIndex = std::size_t{ 9 };
-    constexpr auto descriptionIndex = std::size_t{ 10 };
-
-    auto treeHash = match[treeHashIndex].str();
-    const auto parentStr = match[parentIndex].str();
-    const auto parentSV = splitToStringViewsVector(parentStr, "parent ");
-    auto parents = std::vector<std::string>{};
-    for (auto parent : parentSV)
+    return parseCommitObject(ObjectId{}, commitLog);
+}
+
+auto CommitParser::parseCommits_CatFileBatch(std::string_view batchOutput) -> std::vector<Commit>
+{
+    auto commits = std::vector<Commit>{};
+
+    // Every object is "<hash> <type> <size>\n<content>\n", missing ones are just "<name> missing\n"
+    while (!batchOutput.empty())
+    {
+        auto header = getNextLine(batchOutput);
+        const auto hashEnd = header.find(' ');
+        const auto typeEnd = header.find(' ', hashEnd == std::string_view::npos ? header.size() : hashEnd + 1);
+        if (typeEnd == std::string_view::npos)
+        {
+            continue;
+        }
+
+        const auto sizeSV = header.substr(typeEnd + 1);
+        auto size = std::size_t{ 0 };
+        std::from_chars(sizeSV.data(), sizeSV.data() + sizeSV.size(), size);
+        size = std::min(size, batchOutput.size());
+
+        auto content = batchOutput.substr(0, size);
+        batchOutput.remove_prefix(size);
+        if (batchOutput.starts_with('\n'))
+        {
+            batchOutput.remove_prefix(1);
+        }
+
+        if (header.substr(hashEnd + 1, typeEnd - hashEnd - 1) != "commit")
+        {
+            continue;
+        }
+
+        // Same as for a single commit read from cat-file, the message ends without new line
+        if (content.ends_with('\n'))
+        {
+            content.remove_suffix(1);
+        }
+
+        commits.push_back(parseCommitObject(ObjectId::fromHex(header.substr(0, hashEnd)), content));
+    }
+
+    return commits;
+}
+
+auto CommitParser::parseCommitObject(const ObjectId& hash, std::string_view content) -> Commit
+{
+    auto treeHash = ObjectId{};
+    auto parents = std::vector<ObjectId>{};
+    auto author = SignatureLine{};
+    auto committer = SignatureLine{};
+
+    // Headers end with an empty line, values of multi-line headers (gpgsig, mergetag) continue in lines starting with a space.
+    // Only headers stored in Commit are read, others (like encoding) are skipped.
+    while (!content.empty())
     {
-        if (!parent.empty())
+        const auto line = getNextLine(content);
+        if (line.empty())
+        {
+            break;
+        }
+
+        const auto keyEnd = std::min(line.find(' '), line.size());
+        const auto key = line.substr(0, keyEnd);
+        const auto value = line.substr(std::min(keyEnd + 1, line.size()));
+
+        if (key == "tree")
+        {
+            treeHash = ObjectId::fromHex(value);
+        }
+        else if (key == "parent")
+        {
+            parents.push_back(ObjectId::fromHex(value));
+        }
+        else if (key == "author")
         {
-            parent.remove_suffix(1);
-            parents.emplace_back(parent);
+            author = parseSignatureLine(value);
         }
+        else if (key == "committer")
+        {
+            committer = parseSignatureLine(value);
+        }
+    }
+
+    const auto [message, description] = splitRawMessage(content);
+
+    return { hash, std::move(parents), _details::SignaturePool::intern(author.name, author.email), Timestamp::parse(author.date), _details::SignaturePool::intern(committer.name, committer.email), Timestamp::parse(committer.date), std::string{ message }, std::string{ description }, treeHash };
+}
+
+auto CommitParser::splitRawMessage(const std::string_view rawMessage) -> std::pair<std::string_view, std::string_view>
+{
+    // Message is the first paragraph, description is everything after the empty lines following it
+    const auto messageEnd = rawMessage.find("\n\n");
+    if (messageEnd == std::string_view::npos)
+    {
+        return { rawMessage, std::string_view{} };
+    }
+
+    auto description = rawMessage.substr(messageEnd);
+    description.remove_prefix(std::min(description.find_first_not_of('\n'), description.size()));
+
+    return { rawMessage.substr(0, messageEnd), description };
+}
+
+auto CommitParser::parseSignatureLine(const std::string_view value) -> SignatureLine
+{
+    // <name> <<email>> <timestamp> <timezone>
+    const auto emailStart = value.find('<');
+    const auto emailEnd = value.find('>', emailStart == std::string_view::npos ? value.size() : emailStart);
+    if (emailEnd == std::string_view::npos)
+    {
+        return {};
+    }
+
+    auto name = value.substr(0, emailStart);
+    while (name.ends_with(' '))
+    {
+        name.remove_suffix(1);
     }
-    auto authorName = match[authorNameIndex].str();
-    auto authorEmail = match[authorEmailIndex].str();
-    auto authorDate = match[authorDateIndex].str();
-    auto committerName = match[committerNameIndex].str();
-    auto committerEmail = match[committerEmailIndex].str();
-    auto committerDate = match[committerDateIndex].str();
-    auto message = match[messageIndex].str();
-    auto description = match[descriptionIndex].str();
 
-    return { "", std::move(parents), std::move(authorName), std::move(authorEmail), std::move(authorDate), std::move(committerName), std::move(committerEmail), std::move(committerDate), std::move(message), std::move(description), std::move(treeHash) };
+    auto date = value.substr(emailEnd + 1);
+    date.remove_prefix(std::min(date.find_first_not_of(' '), date.size()));
+
+    return SignatureLine{ .name = name, .email = value.substr(emailStart + 1, emailEnd - emailStart - 1), .date = date };
+}
+
+auto CommitParser::getNextLine(std::string_view& text) -> std::string_view
+{
+    const auto lineEnd = std::min(text.find('\n'), text.size());
+    const auto line = text.substr(0, lineEnd);
+    text.remove_prefix(std::min(lineEnd + 1, text.size()));
+
+    return line;
 }
 
 
@@ -66,17 +168,17 @@ auto CommitParser::parseCommit_PrettyFormat(const std::string_view commitLog, co
     const std::vector<std::string_view> commitTokens = splitToStringViewsVector(commitLog, delimiter);
     const std::vector<std::string_view> formatTokens = splitToStringViewsVector(format, delimiter);
 
-    std::string hash;
-    std::vector<std::string> parents;
-    std::string authorName;
-    std::string authorEmail;
-    std::string authorDate;
-    std::string committerName;
-    std::string committerEmail;
-    std::string committerDate;
+    ObjectId hash;
+    std::vector<ObjectId> parents;
+    std::string_view authorName;
+    std::string_view authorEmail;
+    std::optional<Timestamp> authorDate;
+    std::string_view committerName;
+    std::string_view committerEmail;
+    std::optional<Timestamp> committerDate;
     std::string message;
     std::string description;
-    std::string treeHash;
+    ObjectId treeHash;
 
     for (auto i = std::size_t{ 0 }; i < formatTokens.size(); ++i)
     {
@@ -85,14 +187,14 @@ auto CommitParser::parseCommit_PrettyFormat(const std::string_view commitLog, co
 
         if (isHashToken(formatToken))
         {
-            hash = commitToken;
+            hash = parseHash(commitToken);
         }
         else if (isParentsToken(formatToken))
         {
             const auto parents_sv = splitToStringViewsVector(commitToken, ' ');
             if (parents_sv.size() > 1 || (parents_sv.size() == 1 && !parents_sv[0].empty()))
             {
-                parents = std::vector<std::string>(parents_sv.begin(), parents_sv.end());
+                std::ranges::transform(parents_sv, std::back_inserter(parents), [](const auto parent) { return parseHash(parent); });
             }
         }
         else if (isAuthorNameToken(formatToken))
@@ -105,7 +207,7 @@ auto CommitParser::parseCommit_PrettyFormat(const std::string_view commitLog, co
         }
         else if (isAuthorDateToken(formatToken))
         {
-            authorDate = commitToken;
+            authorDate = parseDateToken(formatToken, commitToken);
         }
         else if (isCommitterNameToken(formatToken))
         {
@@ -117,7 +219,7 @@ auto CommitParser::parseCommit_PrettyFormat(const std::string_view commitLog, co
         }
         else if (isCommitterDateToken(formatToken))
         {
-            committerDate = commitToken;
+            committerDate = parseDateToken(formatToken, commitToken);
         }
         else if (isMessageToken(formatToken))
         {
@@ -133,12 +235,79 @@ auto CommitParser::parseCommit_PrettyFormat(const std::string_view commitLog, co
         }
         else if (isTreeHashToken(formatToken))
         {
-            treeHash = commitToken;
+            treeHash = parseHash(commitToken);
         }
     }
 
-    return { std::move(hash), std::move(parents), std::move(authorName), std::move(authorEmail), std::move(authorDate), std::move(committerName), std::move(committerEmail), std::move(committerDate), std::move(message), std::move(description), std::move(treeHash) };
+    return { hash, std::move(parents), _details::SignaturePool::intern(authorName, authorEmail), authorDate, _details::SignaturePool::intern(committerName, committerEmail), committerDate, std::move(message), std::move(description), treeHash };
+}
+
+auto CommitParser::createCommit(const CommitLogRecord& record) -> Commit
+{
+    auto parents = std::vector<ObjectId>{};
+    auto parentsSV = record.parents;
+    while (!parentsSV.empty())
+    {
+        const auto parentEnd = std::min(parentsSV.find(' '), parentsSV.size());
+        if (parentEnd != 0)
+        {
+            parents.push_back(parseHash(parentsSV.substr(0, parentEnd)));
+        }
+        parentsSV.remove_prefix(std::min(parentEnd + 1, parentsSV.size()));
+    }
+
+    auto description = record.description;
+    while (description.ends_with('\n'))
+    {
+        description.remove_suffix(1);
+    }
+
+    return { parseHash(record.hash), std::move(parents), _details::SignaturePool::intern(record.authorName, record.authorEmail), parseDate(record.authorDate), _details::SignaturePool::intern(record.committerName, record.committerEmail), parseDate(record.committerDate), std::string{ record.message }, std::string{ description }, parseHash(record.treeHash) };
+}
+
+auto CommitParser::parseHash(const std::string_view hash) -> ObjectId
+{
+    if (hash.empty())
+    {
+        return ObjectId{};
+    }
+
+    auto objectId = ObjectId::fromHex(hash);
+    if (objectId.isEmpty())
+    {
+        throw std::runtime_error("Invalid commit hash: " + std::string{ hash });
+    }
+
+    return objectId;
 }
+
+auto CommitParser::parseDate(const std::string_view date) -> std::optional<Timestamp>
+{
+    if (date.empty())
+    {
+        return std::nullopt;
+    }
+
+    auto timestamp = Timestamp::parse(date);
+    if (!timestamp)
+    {
+        throw std::runtime_error("Invalid commit date, expected raw format: " + std::string{ date });
+    }
+
+    return timestamp;
+}
+
+auto CommitParser::parseDateToken(const std::string_view formatToken, const std::string_view commitToken) -> std::optional<Timestamp>
+{
+    // Other date formats (%ai, %at, ...) can't be stored as Timestamp without losing the timezone or the precision
+    if (formatToken != "%ad" && formatToken != "%cd")
+    {
+        throw std::runtime_error("Unsupported date format " + std::string{ formatToken } + ", use %ad or %cd with --date=raw");
+    }
+
+    return parseDate(commitToken);
+}
+
 auto CommitParser::isHashToken(const std::string_view token) -> bool
 {
     return token == "%H" || token == "%h";
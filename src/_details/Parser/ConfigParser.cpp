@@ -0,0 +1,339 @@
+#include "CppGit/_details/Parser/ConfigParser.hpp"
+
+#include <algorithm>
+#include <cctype>
+#include <cstddef>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace CppGit {
+
+namespace {
+
+constexpr auto UTF8_BOM = std::string_view{ "\xEF\xBB\xBF" };
+
+auto isSpace(const char character) -> bool
+{
+    return std::isspace(static_cast<unsigned char>(character)) != 0;
+}
+
+auto isAlpha(const char character) -> bool
+{
+    return std::isalpha(static_cast<unsigned char>(character)) != 0;
+}
+
+auto isKeyChar(const char character) -> bool
+{
+    return std::isalnum(static_cast<unsigned char>(character)) != 0 || character == '-';
+}
+
+auto toLower(std::string value) -> std::string
+{
+    std::ranges::transform(value, value.begin(), [](const unsigned char character) { return static_cast<char>(std::tolower(character)); });
+    return value;
+}
+
+/// Reads config content char by char, turning CRLF into LF and tracking line numbers for errors
+class ConfigReader
+{
+public:
+    explicit ConfigReader(const std::string_view content)
+        : content{ content.starts_with(UTF8_BOM) ? content.substr(UTF8_BOM.size()) : content }
+    {
+    }
+
+    auto isEnd() const -> bool
+    {
+        return position >= content.size();
+    }
+
+    // End of the content is reported as LF, so every construct can be finished the same way
+    auto peek() const -> char
+    {
+        if (isEnd())
+        {
+            return '\n';
+        }
+
+        if (content[position] == '\r' && position + 1 < content.size() && content[position + 1] == '\n')
+        {
+            return '\n';
+        }
+
+        return content[position];
+    }
+
+    auto next() -> char
+    {
+        const auto character = peek();
+        if (!isEnd())
+        {
+            position += (content[position] == '\r' && character == '\n') ? 2 : 1;
+        }
+
+        if (character == '\n')
+        {
+            ++line;
+        }
+
+        return character;
+    }
+
+    auto skipToEndOfLine() -> void
+    {
+        while (!isEnd() && next() != '\n') { }
+    }
+
+    [[noreturn]] auto throwError(const std::string_view message) const -> void
+    {
+        throw std::runtime_error("Bad config line " + std::to_string(line) + ": " + std::string{ message });
+    }
+
+private:
+    std::string_view content;
+    std::size_t position{ 0 };
+    std::size_t line{ 1 };
+};
+
+auto parseSectionHeader(ConfigReader& reader) -> std::string
+{
+    reader.next(); // [
+
+    auto name = std::string{};
+    while (isKeyChar(reader.peek()) || reader.peek() == '.')
+    {
+        name.push_back(reader.next());
+    }
+
+    if (name.empty())
+    {
+        reader.throwError("empty section name");
+    }
+
+    // Deprecated [section.subsection] form is case-insensitive as a whole
+    if (reader.peek() == ']')
+    {
+        reader.next();
+        return toLower(std::move(name));
+    }
+
+    if (!isSpace(reader.peek()) || reader.peek() == '\n')
+    {
+        reader.throwError("invalid section header");
+    }
+
+    while (reader.peek() != '\n' && isSpace(reader.peek()))
+    {
+        reader.next();
+    }
+
+    if (reader.next() != '"')
+    {
+        reader.throwError("subsection name has to be quoted");
+    }
+
+    auto subsection = std::string{};
+    while (true)
+    {
+        auto character = reader.next();
+        if (character == '\n')
+        {
+            reader.throwError("unterminated subsection name");
+        }
+
+        if (character == '"')
+        {
+            break;
+        }
+
+        // In subsections backslash just escapes the next character
+        if (character == '\\')
+        {
+            character = reader.next();
+            if (character == '\n')
+            {
+                reader.throwError("unterminated subsection name");
+            }
+        }
+
+        subsection.push_back(character);
+    }
+
+    if (reader.next() != ']')
+    {
+        reader.throwError("invalid section header");
+    }
+
+    return toLower(std::move(name)) + "." + subsection;
+}
+
+auto parseValue(ConfigReader& reader) -> std::string
+{
+    auto value = std::string{};
+    auto inQuotes = false;
+    auto inComment = false;
+    auto pendingSpaces = std::size_t{ 0 };
+
+    while (true)
+    {
+        auto character = reader.next();
+        if (character == '\n')
+        {
+            if (inQuotes)
+            {
+                reader.throwError("unterminated quoted value");
+            }
+
+            return value;
+        }
+
+        if (inComment)
+        {
+            continue;
+        }
+
+        // Leading and trailing whitespaces are dropped, each inner one outside of quotes becomes a space
+        if (!inQuotes && isSpace(character))
+        {
+            if (!value.empty())
+            {
+                ++pendingSpaces;
+            }
+            continue;
+        }
+
+        if (!inQuotes && (character == '#' || character == ';'))
+        {
+            inComment = true;
+            continue;
+        }
+
+        value.append(pendingSpaces, ' ');
+        pendingSpaces = 0;
+
+        if (character == '\\')
+        {
+            character = reader.next();
+            switch (character)
+            {
+            case '\n':
+                continue;
+            case 't':
+                character = '\t';
+                break;
+            case 'b':
+                character = '\b';
+                break;
+            case 'n':
+                character = '\n';
+                break;
+            case '\\':
+            case '"':
+                break;
+            default:
+                reader.throwError("invalid escape sequence");
+            }
+
+            value.push_back(character);
+            continue;
+        }
+
+        if (character == '"')
+        {
+            inQuotes = !inQuotes;
+            continue;
+        }
+
+        value.push_back(character);
+    }
+}
+
+} // namespace
+
+auto ConfigParser::parseConfigFile(const std::string_view configContent) -> std::vector<ConfigFileEntry>
+{
+    auto entries = std::vector<ConfigFileEntry>{};
+    auto reader = ConfigReader{ configContent };
+    auto section = std::string{};
+
+    while (!reader.isEnd())
+    {
+        const auto character = reader.peek();
+
+        if (isSpace(character))
+        {
+            reader.next();
+            continue;
+        }
+
+        if (character == '#' || character == ';')
+        {
+            reader.skipToEndOfLine();
+            continue;
+        }
+
+        if (character == '[')
+        {
+            section = parseSectionHeader(reader);
+            continue;
+        }
+
+        if (!isAlpha(character))
+        {
+            reader.throwError("invalid key");
+        }
+
+        auto name = std::string{};
+        while (isKeyChar(reader.peek()))
+        {
+            name.push_back(reader.next());
+        }
+
+        if (section.empty())
+        {
+            reader.throwError("key outside of any section");
+        }
+
+        while (reader.peek() != '\n' && isSpace(reader.peek()))
+        {
+            reader.next();
+        }
+
+        auto value = std::optional<std::string>{};
+        if (reader.peek() == '=')
+        {
+            reader.next();
+            value = parseValue(reader);
+        }
+        else if (reader.peek() == '\n' || reader.peek() == '#' || reader.peek() == ';')
+        {
+            reader.skipToEndOfLine();
+        }
+        else
+        {
+            reader.throwError("invalid key");
+        }
+
+        entries.emplace_back(section + "." + toLower(std::move(name)), std::move(value));
+    }
+
+    return entries;
+}
+
+auto ConfigParser::normalizeKey(const std::string_view key) -> std::string
+{
+    const auto firstDot = key.find('.');
+    const auto lastDot = key.rfind('.');
+    if (firstDot == std::string_view::npos || firstDot == lastDot)
+    {
+        return toLower(std::string{ key });
+    }
+
+    return toLower(std::string{ key.substr(0, firstDot) }) + std::string{ key.substr(firstDot, lastDot - firstDot + 1) } + toLower(std::string{ key.substr(lastDot + 1) });
+}
+
+} // namespace CppGit
@@ -3,10 +3,10 @@
 #include "CppGit/DiffFile.hpp"
 
 #include <algorithm>
+#include <array>
 #include <charconv>
 #include <cstddef>
-#include <iterator>
-#include <regex>
+#include <string>
 #include <string_view>
 #include <tuple>
 #include <utility>
@@ -14,217 +14,218 @@
 
 namespace CppGit {
 
+DiffParser::DiffParser(DiffFileConsumer diffFileConsumer)
+    : diffFileConsumer{ std::move(diffFileConsumer) }
+{
+}
+
 auto DiffParser::parse(const std::string_view diffContent) -> std::vector<DiffFile>
 {
-    const auto splittedDiff = splitToStringViewsVector(diffContent, '\n');
-    std::vector<HeaderLine> headersLines;
+    auto diffFiles = std::vector<DiffFile>{};
+    auto diffParser = DiffParser{ [&diffFiles](DiffFile&& parsedDiffFile) { diffFiles.push_back(std::move(parsedDiffFile)); } };
+
+    diffParser.feed(diffContent);
+    diffParser.finish();
 
-    std::vector<DiffFile> diffFiles;
-    auto diffFile = DiffFile{};
-    diffFile.diffStatus = DiffStatus::UNKNOWN;
+    return diffFiles;
+}
 
-    const auto endIterator = splittedDiff.cend();
-    for (auto iterator = splittedDiff.cbegin(); iterator < endIterator; ++iterator)
+auto DiffParser::feed(std::string_view chunk) -> void
+{
+    if (!unfinishedLine.empty())
     {
-        const auto line = *iterator;
-        switch (currentState)
+        const auto lineEnd = chunk.find('\n');
+        if (lineEnd == std::string_view::npos)
         {
-        case ParseState::WAITING_FOR_DIFF: {
-            currentState = ParseState::HEADER;
-            headersLines.clear();
-
-            const auto diffLine = parseDiffLine(line);
-            diffFile.isCombined = diffLine.isCombined;
-            diffFile.fileA = diffLine.fileA;
-            diffFile.fileB = diffLine.fileB;
-            break;
+            unfinishedLine.append(chunk);
+            return;
         }
 
-        case ParseState::HEADER: {
-            const auto lastHeaderLineType = headersLines.empty() ? HeaderLineType::NO_LINE : headersLines.back().type;
-            const auto headerLine = parseHeaderLine(line, lastHeaderLineType);
+        unfinishedLine.append(chunk.substr(0, lineEnd));
+        parseLine(unfinishedLine);
+        unfinishedLine.clear();
+        chunk.remove_prefix(lineEnd + 1);
+    }
 
+    // Complete lines are parsed straight from the chunk, only the unfinished one is copied
+    auto lineEnd = chunk.find('\n');
+    while (lineEnd != std::string_view::npos)
+    {
+        parseLine(chunk.substr(0, lineEnd));
+        chunk.remove_prefix(lineEnd + 1);
+        lineEnd = chunk.find('\n');
+    }
 
-            headersLines.push_back(headerLine);
-            processHeaderLine(headerLine, diffFile);
+    unfinishedLine.append(chunk);
+}
+
+auto DiffParser::finish() -> void
+{
+    if (!unfinishedLine.empty())
+    {
+        parseLine(unfinishedLine);
+        unfinishedLine.clear();
+    }
 
-            if (const auto nextLine = peakNextLine(iterator, endIterator); nextLine == "Binary files differ")
-            {
-                currentState = ParseState::BINARY_FILE;
-            }
-            else if (nextLine.starts_with("---"))
-            {
-                currentState = ParseState::HUNK_FILE_A;
-            }
+    if (diffFile.diffStatus != DiffStatus::UNKNOWN)
+    {
+        passDiffFile();
+    }
 
+    diffFile = DiffFile{};
+    currentState = ParseState::WAITING_FOR_DIFF;
+}
 
-            break;
-        }
+auto DiffParser::parseLine(const std::string_view line) -> void
+{
+    // Hunk content lines always start with a prefix, so "diff" line means the next file's diff begins
+    if (currentState != ParseState::WAITING_FOR_DIFF && line.starts_with("diff"))
+    {
+        passDiffFile();
+    }
 
-        case ParseState::HUNK_FILE_A: {
+    switch (currentState)
+    {
+    case ParseState::WAITING_FOR_DIFF: {
+        currentState = ParseState::HEADER;
+        lastHeaderLineType = HeaderLineType::NO_LINE;
+
+        const auto diffLine = parseDiffLine(line);
+        diffFile.isCombined = diffLine.isCombined;
+        diffFile.fileA = diffLine.fileA;
+        diffFile.fileB = diffLine.fileB;
+        break;
+    }
+
+    case ParseState::HEADER: {
+        if (line == "Binary files differ")
+        {
+            diffFile.diffStatus = DiffStatus::BINARY_CHANGED;
+            currentState = ParseState::BINARY_FILE;
+        }
+        else if (line.starts_with("---"))
+        {
             diffFile.fileA = parseHunkFileLine(line, "a/");
             currentState = ParseState::HUNK_FILE_B;
-            break;
         }
-        case ParseState::HUNK_FILE_B:
-            diffFile.fileB = parseHunkFileLine(line, "b/");
-            currentState = ParseState::HUNK_HEADER;
-            break;
-
-        case ParseState::HUNK_HEADER: {
-            auto [rangesBefore, rangeAfter] = parseHunkHeader(line);
-            diffFile.hunkRangesBefore = std::move(rangesBefore);
-            diffFile.hunkRangeAfter = std::move(rangeAfter);
-
-            currentState = ParseState::HUNK_CONTENT;
-            break;
+        else
+        {
+            const auto headerLine = parseHeaderLine(line, lastHeaderLineType);
+            lastHeaderLineType = headerLine.type;
+            processHeaderLine(headerLine, diffFile);
         }
+        break;
+    }
 
-        case ParseState::HUNK_CONTENT:
-            diffFile.hunkContent.emplace_back(line);
-            break;
+    case ParseState::HUNK_FILE_B:
+        diffFile.fileB = parseHunkFileLine(line, "b/");
+        currentState = ParseState::HUNK_HEADER;
+        break;
 
-        case ParseState::BINARY_FILE:
-            diffFile.diffStatus = DiffStatus::BINARY_CHANGED;
-            currentState = ParseState::WAITING_FOR_DIFF;
-            break;
-        }
+    case ParseState::HUNK_HEADER: {
+        auto [rangesBefore, rangeAfter] = parseHunkHeader(line);
+        diffFile.hunkRangesBefore = std::move(rangesBefore);
+        diffFile.hunkRangeAfter = std::move(rangeAfter);
 
-        if (peakNextLine(iterator, endIterator).starts_with("diff"))
-        {
-            diffFiles.push_back(std::move(diffFile));
-            diffFile = DiffFile{};
-            diffFile.diffStatus = DiffStatus::UNKNOWN;
-            currentState = ParseState::WAITING_FOR_DIFF;
-        }
+        currentState = ParseState::HUNK_CONTENT;
+        break;
     }
-    if (diffFile.diffStatus != DiffStatus::UNKNOWN)
-    {
-        diffFiles.push_back(std::move(diffFile));
+
+    case ParseState::HUNK_CONTENT:
+        diffFile.hunkContent.emplace_back(line);
+        break;
+
+    case ParseState::BINARY_FILE:
+        break;
     }
+}
 
-    return diffFiles;
+auto DiffParser::passDiffFile() -> void
+{
+    diffFileConsumer(std::move(diffFile));
+    diffFile = DiffFile{};
+    currentState = ParseState::WAITING_FOR_DIFF;
 }
 
 
 auto DiffParser::parseHeaderLine(const std::string_view line, const HeaderLineType headerLineBefore) -> HeaderLine
 {
-    static constexpr auto oldModePrefix = "old mode";
-    static constexpr auto oldModePattern = R"(^old mode (\d{6})$)";
-    static constexpr auto newModePattern = R"(^new mode (\d{6})$)";
-    static constexpr auto deletedFilePrefix = "deleted file mode";
-    static constexpr auto deletedFilePattern = R"(^deleted file mode (\d{6})$)";
-    static constexpr auto newFilePrefix = "new file mode";
-    static constexpr auto newFilePattern = R"(^new file mode (\d{6})$)";
-    static constexpr auto copyFromPrefix = "copy from";
-    static constexpr auto copyFromPattern = R"(^copy from (\S+)$)";
-    static constexpr auto copyToPattern = R"(^copy to (\S+)$)";
-    static constexpr auto renamedFromprefix = "rename from";
-    static constexpr auto renamedFromPattern = R"(^rename from (\S+)$)";
-    static constexpr auto renamedToPattern = R"(^rename to (\S+)$)";
-    static constexpr auto similarityIndexPrefix = "similarity index";
-    static constexpr auto similarityIndexPattern = R"(^similarity index (\d+)%$)";
-    static constexpr auto indexPrefix = "index";
-    static constexpr auto indexPattern = R"(^index ([\w\d,]+)..([\w\d]+)\s?([\w\d]+)?$)";
-
-    auto getIntValueFromStringViewMatch = [](const std::match_results<std::string_view::const_iterator>& match, std::size_t index) {
-        auto value = 0;
-
-        if (match[index].first != match[index].second)
-        {
-            std::from_chars(match[index].first, match[index].second, value);
-        }
-
-        return value;
+    // Which header lines may follow each other, in the order git writes them
+    static constexpr auto headerLineRules = std::array{
+        HeaderLineRule{ .typeBefore = HeaderLineType::NO_LINE, .prefix = "index ", .type = HeaderLineType::INDEX },
+        HeaderLineRule{ .typeBefore = HeaderLineType::NO_LINE, .prefix = "new file mode ", .type = HeaderLineType::NEW_FILE },
+        HeaderLineRule{ .typeBefore = HeaderLineType::NO_LINE, .prefix = "deleted file mode ", .type = HeaderLineType::DELETED_FILE },
+        HeaderLineRule{ .typeBefore = HeaderLineType::NO_LINE, .prefix = "similarity index ", .type = HeaderLineType::SIMILARITY_INDEX },
+        HeaderLineRule{ .typeBefore = HeaderLineType::NO_LINE, .prefix = "old mode ", .type = HeaderLineType::OLD_MODE },
+        HeaderLineRule{ .typeBefore = HeaderLineType::SIMILARITY_INDEX, .prefix = "rename from ", .type = HeaderLineType::RENAME_FROM },
+        HeaderLineRule{ .typeBefore = HeaderLineType::SIMILARITY_INDEX, .prefix = "copy from ", .type = HeaderLineType::COPY_FROM },
+        HeaderLineRule{ .typeBefore = HeaderLineType::RENAME_FROM, .prefix = "rename to ", .type = HeaderLineType::RENAME_TO },
+        HeaderLineRule{ .typeBefore = HeaderLineType::COPY_FROM, .prefix = "copy to ", .type = HeaderLineType::COPY_TO },
+        HeaderLineRule{ .typeBefore = HeaderLineType::OLD_MODE, .prefix = "new mode ", .type = HeaderLineType::NEW_MODE },
+        HeaderLineRule{ .typeBefore = HeaderLineType::RENAME_TO, .prefix = "index ", .type = HeaderLineType::INDEX },
+        HeaderLineRule{ .typeBefore = HeaderLineType::COPY_TO, .prefix = "index ", .type = HeaderLineType::INDEX },
+        HeaderLineRule{ .typeBefore = HeaderLineType::NEW_MODE, .prefix = "index ", .type = HeaderLineType::INDEX },
+        HeaderLineRule{ .typeBefore = HeaderLineType::NEW_FILE, .prefix = "index ", .type = HeaderLineType::INDEX },
+        HeaderLineRule{ .typeBefore = HeaderLineType::DELETED_FILE, .prefix = "index ", .type = HeaderLineType::INDEX },
     };
 
-    auto match = std::match_results<std::string_view::const_iterator>();
-
-    switch (headerLineBefore)
+    for (const auto& rule : headerLineRules)
     {
-    case HeaderLineType::NO_LINE:
-        if (line.starts_with(indexPrefix))
-        {
-            std::regex_match(line.cbegin(), line.cend(), match, std::regex{ indexPattern });
-            return HeaderLine{ .type = HeaderLineType::INDEX, .value = std::make_tuple(string_viewIteratorToString_view(match[1].first, match[1].second), string_viewIteratorToString_view(match[2].first, match[2].second), getIntValueFromStringViewMatch(match, 3)) };
-        }
-        else if (line.starts_with(newFilePrefix))
+        if (rule.typeBefore == headerLineBefore && line.starts_with(rule.prefix))
         {
-            std::regex_match(line.cbegin(), line.cend(), match, std::regex{ newFilePattern });
-            return HeaderLine{ .type = HeaderLineType::NEW_FILE, .value = getIntValueFromStringViewMatch(match, 1) };
+            return parseHeaderLineValue(rule.type, line.substr(rule.prefix.size()));
         }
-        else if (line.starts_with(deletedFilePrefix))
-        {
-            std::regex_match(line.begin(), line.end(), match, std::regex{ deletedFilePattern });
-            return HeaderLine{ .type = HeaderLineType::DELETED_FILE, .value = getIntValueFromStringViewMatch(match, 1) };
-        }
-        else if (line.starts_with(similarityIndexPrefix))
-        {
-            std::regex_match(line.begin(), line.end(), match, std::regex{ similarityIndexPattern });
-            return HeaderLine{ .type = HeaderLineType::SIMILARITY_INDEX, .value = getIntValueFromStringViewMatch(match, 1) };
-        }
-        else if (line.starts_with(oldModePrefix))
-        {
-            std::regex_match(line.cbegin(), line.cend(), match, std::regex{ oldModePattern });
-            return HeaderLine{ .type = HeaderLineType::OLD_MODE, .value = getIntValueFromStringViewMatch(match, 1) };
-        }
-
-        break;
+    }
 
-    case HeaderLineType::SIMILARITY_INDEX:
-        if (line.starts_with(renamedFromprefix))
-        {
-            std::regex_match(line.cbegin(), line.cend(), match, std::regex{ renamedFromPattern });
-            return HeaderLine{ .type = HeaderLineType::RENAME_FROM, .value = string_viewIteratorToString_view(match[1].first, match[1].second) };
-        }
-        else if (line.starts_with(copyFromPrefix))
-        {
-            std::regex_match(line.cbegin(), line.cend(), match, std::regex{ copyFromPattern });
-            return HeaderLine{ .type = HeaderLineType::COPY_FROM, .value = string_viewIteratorToString_view(match[1].first, match[1].second) };
-        }
-        break;
+    return {};
+}
 
-    case HeaderLineType::RENAME_FROM:
-        std::regex_match(line.cbegin(), line.cend(), match, std::regex{ renamedToPattern });
-        return HeaderLine{ .type = HeaderLineType::RENAME_TO, .value = string_viewIteratorToString_view(match[1].first, match[1].second) };
+auto DiffParser::parseHeaderLineValue(const HeaderLineType type, const std::string_view value) -> HeaderLine
+{
+    switch (type)
+    {
+    case HeaderLineType::INDEX:
+        return HeaderLine{ .type = type, .value = parseIndexValue(value) };
 
     case HeaderLineType::COPY_FROM:
-        std::regex_match(line.cbegin(), line.cend(), match, std::regex{ copyToPattern });
-        return HeaderLine{ .type = HeaderLineType::COPY_TO, .value = string_viewIteratorToString_view(match[1].first, match[1].second) };
-
-    case HeaderLineType::OLD_MODE:
-        std::regex_match(line.cbegin(), line.cend(), match, std::regex{ newModePattern });
-        return HeaderLine{ .type = HeaderLineType::NEW_MODE, .value = getIntValueFromStringViewMatch(match, 1) };
-
-    case HeaderLineType::RENAME_TO:
     case HeaderLineType::COPY_TO:
-    case HeaderLineType::NEW_MODE:
-    case HeaderLineType::NEW_FILE:
-    case HeaderLineType::DELETED_FILE:
-        std::regex_match(line.cbegin(), line.cend(), match, std::regex{ indexPattern });
-        return HeaderLine{ .type = HeaderLineType::INDEX, .value = std::make_tuple(string_viewIteratorToString_view(match[1].first, match[1].second), string_viewIteratorToString_view(match[2].first, match[2].second), getIntValueFromStringViewMatch(match, 3)) };
+    case HeaderLineType::RENAME_FROM:
+    case HeaderLineType::RENAME_TO:
+        return HeaderLine{ .type = type, .value = value };
+
     default:
-        break;
+        // Modes and similarity index (which ends with '%', parsing stops there)
+        return HeaderLine{ .type = type, .value = parseInt(value, 0) };
     }
+}
 
-    return {};
+auto DiffParser::parseIndexValue(const std::string_view value) -> std::tuple<std::string_view, std::string_view, int>
+{
+    // <hash>[,<hash>...]..<hash>[ <mode>]
+    const auto separatorPosition = value.find("..");
+    if (separatorPosition == std::string_view::npos)
+    {
+        return {};
+    }
+
+    auto indexAfterAndMode = value.substr(separatorPosition + 2);
+    const auto indexAfter = getNextToken(indexAfterAndMode);
+    const auto mode = parseInt(getNextToken(indexAfterAndMode), 0);
+
+    return std::make_tuple(value.substr(0, separatorPosition), indexAfter, mode);
 }
 
 
 auto DiffParser::parseHunkFileLine(const std::string_view line, const std::string_view prefix) -> std::string
 {
-    auto file = splitToStringViewsVector(line, ' ')[1];
+    auto rest = line;
+    getNextToken(rest); // "---" or "+++"
+    auto file = getNextToken(rest);
     removePrefixFromFileIfStartsWith(file, prefix);
 
     return std::string{ file };
 }
 
-auto DiffParser::peakNextLine(std::vector<std::string_view>::const_iterator iterator, const std::vector<std::string_view>::const_iterator endIterator) -> std::string_view
-{
-    ++iterator;
-    return (iterator == endIterator) ? "" : *iterator;
-}
-
 auto DiffParser::removePrefixFromFileIfStartsWith(std::string_view& file, const std::string_view prefix) -> void
 {
     if (file.starts_with(prefix))
@@ -317,68 +318,80 @@ auto DiffParser::processHeaderLine(const HeaderLine& headerLine, DiffFile& diffF
 
 auto DiffParser::parseHunkHeader(const std::string_view line) -> std::pair<std::vector<std::pair<int, int>>, std::pair<int, int>>
 {
-    static constexpr auto hunkHeaderPattern = R"(^@{2,} ((?:-\d+(?:,\d+)?\s)+)(\+\d+(?:,\d+)?) @{2,}$)";
-
-    auto match = std::match_results<std::string_view::const_iterator>();
-    std::regex_match(line.cbegin(), line.cend(), match, std::regex{ hunkHeaderPattern });
-    auto beforeIndicesSV = string_viewIteratorToString_view(match[1].first, match[1].second);
-    beforeIndicesSV.remove_suffix(1); // we have extra space at the end. May change regex to avoid this later
-
-    auto beforeIndices = splitToStringViewsVector(beforeIndicesSV, ' ');
-
+    // @@ -<range> +<range> @@[ <function name>], combined diffs have more '@' and one "-<range>" for every parent
     auto hunkRangesBefore = std::vector<std::pair<int, int>>{};
+    auto hunkRangeAfter = std::pair<int, int>{};
 
-    std::ranges::transform(beforeIndices, std::back_inserter(hunkRangesBefore), [](const auto& range) {
-        return parseHunkHeaderRange(range);
-    });
-
-    auto hunkRangeAfter = parseHunkHeaderRange(string_viewIteratorToString_view(match[2].first, match[2].second));
+    auto rest = line;
+    getNextToken(rest);
+    for (auto token = getNextToken(rest); !token.empty() && !token.starts_with('@'); token = getNextToken(rest))
+    {
+        if (token.starts_with('-'))
+        {
+            hunkRangesBefore.push_back(parseHunkHeaderRange(token));
+        }
+        else if (token.starts_with('+'))
+        {
+            hunkRangeAfter = parseHunkHeaderRange(token);
+        }
+    }
 
     return std::make_pair(std::move(hunkRangesBefore), std::move(hunkRangeAfter));
 }
 
 
-auto DiffParser::parseHunkHeaderRange(const std::string_view range) -> std::pair<int, int>
+auto DiffParser::parseHunkHeaderRange(std::string_view range) -> std::pair<int, int>
 {
-    auto splittedRange = splitToStringViewsVector(range, ',');
-    splittedRange[0].remove_prefix(1); // remove the leading '+' or '-', do we need it later?
+    range.remove_prefix(1); // remove the leading '+' or '-'
 
-    auto left = 1;
-    std::from_chars(splittedRange[0].cbegin(), splittedRange[0].cend(), left);
-
-    auto right = -1;
-    if (splittedRange.size() == 2)
+    const auto commaPosition = range.find(',');
+    if (commaPosition == std::string_view::npos)
     {
-        std::from_chars(splittedRange[1].cbegin(), splittedRange[1].cend(), right);
+        return std::make_pair(parseInt(range, 1), -1);
     }
 
-    return std::make_pair(left, right);
+    return std::make_pair(parseInt(range.substr(0, commaPosition), 1), parseInt(range.substr(commaPosition + 1), -1));
 }
 
 auto DiffParser::parseDiffLine(const std::string_view line) -> DiffLine
 {
-    static constexpr auto pattern = R"(^diff --(\w{2,3}) (\S+)\s?(\S+)?$)";
+    // diff --git a/<file> b/<file> or diff --cc <file>
+    auto rest = line;
+    getNextToken(rest);
+    const auto format = getNextToken(rest);
 
-    auto match = std::match_results<std::string_view::const_iterator>();
-    std::regex_match(line.cbegin(), line.cend(), match, std::regex{ pattern });
+    auto fileA = getNextToken(rest);
+    removePrefixFromFileIfStartsWith(fileA, "a/");
 
-    auto isCombined = false;
-    if (string_viewIteratorToString_view(match[1].first, match[1].second) == "cc")
-    {
-        isCombined = true;
-    }
+    auto fileB = getNextToken(rest);
+    removePrefixFromFileIfStartsWith(fileB, "b/");
 
-    auto fileA = string_viewIteratorToString_view(match[2].first, match[2].second);
-    removePrefixFromFileIfStartsWith(fileA, "a/");
+    return DiffLine{ .isCombined = (format == "--cc"), .fileA = fileA, .fileB = fileB };
+}
 
-    auto fileB = std::string_view{};
-    if (match[3].matched)
+auto DiffParser::getNextToken(std::string_view& text) -> std::string_view
+{
+    const auto tokenStart = text.find_first_not_of(' ');
+    if (tokenStart == std::string_view::npos)
     {
-        fileB = string_viewIteratorToString_view(match[3].first, match[3].second);
-        removePrefixFromFileIfStartsWith(fileB, "b/");
+        text = std::string_view{};
+        return text;
     }
 
-    return DiffLine{ .isCombined = isCombined, .fileA = fileA, .fileB = fileB };
+    text.remove_prefix(tokenStart);
+    const auto tokenEnd = std::min(text.find(' '), text.size());
+    const auto token = text.substr(0, tokenEnd);
+    text.remove_prefix(tokenEnd);
+
+    return token;
+}
+
+auto DiffParser::parseInt(const std::string_view text, const int defaultValue) -> int
+{
+    auto value = defaultValue;
+    std::from_chars(text.data(), text.data() + text.size(), value);
+
+    return value;
 }
 
 
@@ -1,6 +1,7 @@
 #include "CppGit/_details/Parser/IndexParser.hpp"
 
 #include "CppGit/IndexManager.hpp"
+#include "CppGit/ObjectId.hpp"
 
 #include <algorithm>
 #include <charconv>
@@ -22,7 +23,7 @@ auto IndexParser::parseStageDetailedEntry(const std::string_view indexEntryLine)
 
     auto fileMode = 0;
     std::from_chars(match[1].first, match[1].second, fileMode);
-    return IndexEntry{ .fileMode = fileMode, .stageNumber = std::stoi(match[3].str()), .objectHash = match[2].str(), .path = match[4].str() };
+    return IndexEntry{ .fileMode = fileMode, .stageNumber = std::stoi(match[3].str()), .objectHash = ObjectId::fromHex(std::string_view{ match[2].first, match[2].second }), .path = match[4].str() };
 }
 
 auto IndexParser::parseStageDetailedList(const std::string_view indexContent) -> std::vector<IndexEntry>
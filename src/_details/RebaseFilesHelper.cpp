@@ -10,6 +10,7 @@
 #include <filesystem>
 #include <ios>
 #include <optional>
+#include <span>
 #include <string>
 #include <string_view>
 #include <utility>
@@ -63,9 +64,10 @@ auto RebaseFilesHelper::getOrigHead() const -> std::string
 
 auto RebaseFilesHelper::createAuthorScriptFile(const std::string_view authorName, const std::string_view authorEmail, const std::string_view authorDate) const -> void
 {
-    const auto authorScript = "GIT_AUTHOR_NAME=" + std::string{ authorName } + "\n"
-                            + "GIT_AUTHOR_EMAIL=" + std::string{ authorEmail } + "\n"
-                            + "GIT_AUTHOR_DATE=" + std::string{ authorDate };
+    // Values are single-quoted the same way as git does, so git can read this file too
+    const auto authorScript = "GIT_AUTHOR_NAME=" + quoteAuthorScriptValue(authorName) + "\n"
+                            + "GIT_AUTHOR_EMAIL=" + quoteAuthorScriptValue(authorEmail) + "\n"
+                            + "GIT_AUTHOR_DATE=" + quoteAuthorScriptValue(authorDate);
     _details::FileUtility::createOrOverwriteFile(repository->getGitDirectoryPath() / "rebase-merge" / "author-script", authorScript);
 }
 
@@ -73,7 +75,58 @@ auto RebaseFilesHelper::getAuthorScriptFile() const -> std::vector<std::string>
 {
     const auto autorScript = _details::FileUtility::readFile(repository->getGitDirectoryPath() / "rebase-merge" / "author-script");
 
-    return Parser::splitToStringsVector(autorScript, '\n');
+    auto envp = Parser::splitToStringsVector(autorScript, '\n');
+    for (auto& variable : envp)
+    {
+        if (const auto equalPos = variable.find('='); equalPos != std::string::npos)
+        {
+            variable = variable.substr(0, equalPos + 1) + unquoteAuthorScriptValue(std::string_view{ variable }.substr(equalPos + 1));
+        }
+    }
+
+    return envp;
+}
+
+auto RebaseFilesHelper::quoteAuthorScriptValue(const std::string_view value) -> std::string
+{
+    auto quoted = std::string{ "'" };
+    for (const auto character : value)
+    {
+        if (character == '\'')
+        {
+            quoted += "'\\''";
+        }
+        else
+        {
+            quoted += character;
+        }
+    }
+    quoted += '\'';
+
+    return quoted;
+}
+
+auto RebaseFilesHelper::unquoteAuthorScriptValue(const std::string_view value) -> std::string
+{
+    auto unquoted = std::string{};
+    auto inQuotes = false;
+    for (auto i = std::size_t{ 0 }; i < value.size(); ++i)
+    {
+        if (value[i] == '\'')
+        {
+            inQuotes = !inQuotes;
+        }
+        else if (value[i] == '\\' && !inQuotes && i + 1 < value.size())
+        {
+            unquoted += value[++i];
+        }
+        else
+        {
+            unquoted += value[i];
+        }
+    }
+
+    return unquoted;
 }
 
 auto RebaseFilesHelper::removeAuthorScriptFile() const -> void
@@ -179,67 +232,56 @@ auto RebaseFilesHelper::removeMessageFile() const -> void
 
 auto RebaseFilesHelper::generateTodoFile(const std::vector<RebaseTodoCommand>& rebaseTodoCommands) const -> void
 {
-    auto file = std::ofstream{ repository->getGitDirectoryPath() / "rebase-merge" / "git-rebase-todo" };
-    for (const auto& command : rebaseTodoCommands)
-    {
-        file << command.toString() << "\n";
-    }
-    file.close();
+    writeTodoFile(rebaseTodoCommands);
 
     std::filesystem::copy(repository->getGitDirectoryPath() / "rebase-merge" / "git-rebase-todo", repository->getGitDirectoryPath() / "rebase-merge" / "git-rebase-todo.backup");
 }
 
-auto RebaseFilesHelper::peekTodoFile() const -> std::optional<RebaseTodoCommand>
+auto RebaseFilesHelper::writeTodoFile(const std::span<const RebaseTodoCommand> rebaseTodoCommands) const -> void
 {
-    const auto todoFilePath = repository->getGitDirectoryPath() / "rebase-merge" / "git-rebase-todo";
-    auto todoFile = std::ifstream{ todoFilePath };
-    std::string todoLine;
-    std::getline(todoFile, todoLine);
-    todoFile.close();
-
-    auto commandTodo = parseTodoCommandLine(todoLine);
-
-    return commandTodo;
+    auto file = std::ofstream{ repository->getGitDirectoryPath() / "rebase-merge" / "git-rebase-todo" };
+    for (const auto& command : rebaseTodoCommands)
+    {
+        file << command.toString() << "\n";
+    }
 }
 
-auto RebaseFilesHelper::popTodoFile() const -> void
+auto RebaseFilesHelper::getTodoFileCommands() const -> std::vector<RebaseTodoCommand>
 {
-    const auto todoFilePath = repository->getGitDirectoryPath() / "rebase-merge" / "git-rebase-todo";
-    const auto tempFilePath = repository->getGitDirectoryPath() / "rebase-merge" / "git-rebase-todo.temp";
+    const auto todoFile = _details::FileUtility::readFile(repository->getGitDirectoryPath() / "rebase-merge" / "git-rebase-todo");
 
-    auto todoFile = std::ifstream{ todoFilePath };
-    auto tempFile = std::ofstream{ tempFilePath };
-
-    std::string line;
-    std::getline(todoFile, line); // skip first line
-
-    while (std::getline(todoFile, line))
+    auto commands = std::vector<RebaseTodoCommand>{};
+    for (const auto line : Parser::splitToStringViewsVector(todoFile, '\n'))
     {
-        tempFile << line << "\n";
+        if (auto command = parseTodoCommandLine(line))
+        {
+            commands.push_back(std::move(*command));
+        }
     }
 
-    todoFile.close();
-    tempFile.close();
-
-    std::filesystem::remove(todoFilePath);
-    std::filesystem::rename(tempFilePath, todoFilePath);
+    return commands;
 }
 
-auto RebaseFilesHelper::peakAndPopTodoFile() const -> std::optional<RebaseTodoCommand>
+auto RebaseFilesHelper::appendDoneFile(const RebaseTodoCommand& rebaseTodoCommand) const -> void
 {
-    const auto command = peekTodoFile();
+    _details::FileUtility::createOrAppendFile(repository->getGitDirectoryPath() / "rebase-merge" / "done", rebaseTodoCommand.toString(), "\n");
+}
 
-    if (command)
+auto RebaseFilesHelper::appendDoneFile(const std::span<const RebaseTodoCommand> rebaseTodoCommands) const -> void
+{
+    if (rebaseTodoCommands.empty())
     {
-        popTodoFile();
+        return;
     }
 
-    return command;
-}
+    auto doneLines = std::string{};
+    for (const auto& command : rebaseTodoCommands)
+    {
+        doneLines += command.toString();
+        doneLines += '\n';
+    }
 
-auto RebaseFilesHelper::appendDoneFile(const RebaseTodoCommand& rebaseTodoCommand) const -> void
-{
-    _details::FileUtility::createOrAppendFile(repository->getGitDirectoryPath() / "rebase-merge" / "done", rebaseTodoCommand.toString(), "\n");
+    _details::FileUtility::createOrAppendFile(repository->getGitDirectoryPath() / "rebase-merge" / "done", doneLines);
 }
 
 auto RebaseFilesHelper::getLastDoneCommand() const -> std::optional<RebaseTodoCommand>
@@ -0,0 +1,54 @@
+#include "CppGit/_details/RebaseTodoList.hpp"
+
+#include "CppGit/RebaseTodoCommand.hpp"
+
+#include <optional>
+#include <span>
+#include <utility>
+#include <vector>
+
+namespace CppGit::_details {
+
+RebaseTodoList::RebaseTodoList(std::vector<RebaseTodoCommand> commands)
+    : commands{ std::move(commands) }
+{
+}
+
+auto RebaseTodoList::peek() const -> std::optional<RebaseTodoCommand>
+{
+    if (cursor == commands.size())
+    {
+        return std::nullopt;
+    }
+
+    return commands[cursor];
+}
+
+auto RebaseTodoList::pop() -> std::optional<RebaseTodoCommand>
+{
+    auto command = peek();
+
+    if (command)
+    {
+        ++cursor;
+    }
+
+    return command;
+}
+
+auto RebaseTodoList::getRemainingCommands() const -> std::span<const RebaseTodoCommand>
+{
+    return std::span{ commands }.subspan(cursor);
+}
+
+auto RebaseTodoList::getNotFlushedDoneCommands() const -> std::span<const RebaseTodoCommand>
+{
+    return std::span{ commands }.subspan(flushedCount, cursor - flushedCount);
+}
+
+auto RebaseTodoList::markFlushed() -> void
+{
+    flushedCount = cursor;
+}
+
+} // namespace CppGit::_details
@@ -2,6 +2,7 @@
 
 #include "CppGit/Repository.hpp"
 #include "CppGit/_details/GitFilesHelper.hpp"
+#include "CppGit/_details/ReferencesReader.hpp"
 
 #include <string>
 #include <string_view>
@@ -17,6 +18,12 @@ ReferencesManager::ReferencesManager(const Repository& repository)
 
 auto ReferencesManager::getRefHash(const std::string_view refName) const -> std::string
 {
+    if (auto lookup = ReferencesReader{ repository->getGitDirectoryPath(), repository->getCommonDirectoryPath() }.resolveShortRef(refName); lookup.status == ReferenceLookupStatus::FOUND)
+    {
+        return std::move(lookup.value);
+    }
+
+    // Revision expressions, abbreviated hashes and not existing refs are resolved by git
     auto output = repository->executeGitCommand("rev-parse", refName);
     return std::move(output.stdout);
 }
@@ -24,6 +31,11 @@ auto ReferencesManager::getRefHash(const std::string_view refName) const -> std:
 
 auto ReferencesManager::getSymbolicRef(const std::string_view refName) const -> std::string
 {
+    if (auto lookup = ReferencesReader{ repository->getGitDirectoryPath(), repository->getCommonDirectoryPath() }.resolveSymbolicRef(refName); lookup.status != ReferenceLookupStatus::UNSUPPORTED)
+    {
+        return std::move(lookup.value);
+    }
+
     auto output = repository->executeGitCommand("symbolic-ref", refName);
     return std::move(output.stdout);
 }
@@ -31,6 +43,15 @@ auto ReferencesManager::getSymbolicRef(const std::string_view refName) const ->
 
 auto ReferencesManager::refExists(const std::string_view refName) const -> bool
 {
+    // show-ref --verify accepts only full names, so there is no need to disambiguate
+    if (refName == "HEAD" || refName.starts_with("refs/"))
+    {
+        if (const auto lookup = ReferencesReader{ repository->getGitDirectoryPath(), repository->getCommonDirectoryPath() }.resolveRef(refName); lookup.status != ReferenceLookupStatus::UNSUPPORTED)
+        {
+            return lookup.status == ReferenceLookupStatus::FOUND;
+        }
+    }
+
     const auto output = repository->executeGitCommand("show-ref", "--verify", "--quiet", refName);
     return output.return_code == 0;
 }
@@ -0,0 +1,401 @@
+#include "CppGit/_details/ReferencesReader.hpp"
+
+#include "CppGit/ObjectId.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cerrno>
+#include <cstddef>
+#include <cstring>
+#include <fcntl.h>
+#include <filesystem>
+#include <string>
+#include <string_view>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <system_error>
+#include <unistd.h>
+#include <utility>
+
+namespace CppGit::_details {
+
+namespace {
+
+constexpr auto MAX_SYMBOLIC_REF_DEPTH = 5; // the same limit as git has
+constexpr auto MAX_LOOSE_REF_SIZE = std::size_t{ 4096 };
+
+constexpr auto SYMBOLIC_REF_PREFIX = std::string_view{ "ref:" };
+constexpr auto PACKED_REFS_HEADER = std::string_view{ "# pack-refs with:" };
+
+auto isHash(const std::string_view value) -> bool
+{
+    return (value.size() == ObjectId::SHA1_SIZE * 2 || value.size() == ObjectId::SHA256_SIZE * 2) && ObjectId::isHex(value);
+}
+
+// Conservative subset of git's check-ref-format rules, anything else is left to git
+auto isSupportedRefName(const std::string_view refName) -> bool
+{
+    if (refName.empty() || refName.starts_with('/') || refName.starts_with('.') || refName.starts_with('-') || refName.ends_with('/') || refName.ends_with('.') || refName.ends_with(".lock"))
+    {
+        return false;
+    }
+
+    if (refName.contains("..") || refName.contains("//") || refName.contains("/.") || refName.contains("@{") || refName == "@")
+    {
+        return false;
+    }
+
+    return std::ranges::none_of(refName, [](const char character) {
+        const auto byte = static_cast<unsigned char>(character);
+        return byte <= ' ' || byte == 0x7F || character == '~' || character == '^' || character == ':' || character == '?' || character == '*' || character == '[' || character == '\\';
+    });
+}
+
+// Names like HEAD or ORIG_HEAD, which git looks up directly in the .git directory
+auto isPseudoRefName(const std::string_view refName) -> bool
+{
+    return std::ranges::all_of(refName, [](const char character) { return (character >= 'A' && character <= 'Z') || character == '_'; });
+}
+
+// Refs which every worktree has its own, the rest is shared
+auto isWorktreeRefName(const std::string_view refName) -> bool
+{
+    return isPseudoRefName(refName) || refName.starts_with("refs/worktree/") || refName.starts_with("refs/bisect/") || refName.starts_with("refs/rewritten/");
+}
+
+auto trimTrailingWhitespaces(std::string_view value) -> std::string_view
+{
+    while (!value.empty() && (value.back() == '\n' || value.back() == '\r' || value.back() == ' ' || value.back() == '\t'))
+    {
+        value.remove_suffix(1);
+    }
+
+    return value;
+}
+
+} // namespace
+
+ReferencesReader::ReferencesReader(std::filesystem::path gitDirectoryPath, std::filesystem::path commonDirectoryPath)
+    : gitDirectoryPath{ std::move(gitDirectoryPath) },
+      commonDirectoryPath{ std::move(commonDirectoryPath) }
+{
+    auto error = std::error_code{};
+    supported = std::filesystem::is_directory(this->gitDirectoryPath, error) && std::filesystem::is_directory(this->commonDirectoryPath, error)
+             && !std::filesystem::exists(this->commonDirectoryPath / "reftable", error);
+}
+
+ReferencesReader::~ReferencesReader()
+{
+    if (packedRefsData != nullptr)
+    {
+        munmap(const_cast<char*>(packedRefsData), packedRefsSize); // NOLINT(cppcoreguidelines-pro-type-const-cast)
+    }
+}
+
+auto ReferencesReader::resolveRef(const std::string_view refName) -> ReferenceLookup
+{
+    if (!supported || !isSupportedRefName(refName))
+    {
+        return ReferenceLookup{ .status = ReferenceLookupStatus::UNSUPPORTED, .value = "" };
+    }
+
+    auto currentRefName = std::string{ refName };
+    auto value = std::string{};
+    for (auto depth = 0; depth <= MAX_SYMBOLIC_REF_DEPTH; ++depth)
+    {
+        switch (readLooseRef(currentRefName, value))
+        {
+        case LooseRefType::HASH:
+            return ReferenceLookup{ .status = ReferenceLookupStatus::FOUND, .value = std::move(value) };
+        case LooseRefType::SYMBOLIC:
+            currentRefName = std::move(value);
+            break;
+        case LooseRefType::MISSING:
+            return findPackedRef(currentRefName);
+        case LooseRefType::BROKEN:
+            return ReferenceLookup{ .status = ReferenceLookupStatus::UNSUPPORTED, .value = "" };
+        }
+    }
+
+    return ReferenceLookup{ .status = ReferenceLookupStatus::UNSUPPORTED, .value = "" };
+}
+
+auto ReferencesReader::resolveShortRef(const std::string_view name) -> ReferenceLookup
+{
+    if (!supported)
+    {
+        return ReferenceLookup{ .status = ReferenceLookupStatus::UNSUPPORTED, .value = "" };
+    }
+
+    if (isHash(name))
+    {
+        // Git accepts upper case hashes too, but always prints them in lower case
+        return ReferenceLookup{ .status = ReferenceLookupStatus::FOUND, .value = ObjectId::fromHex(name).toHex() };
+    }
+
+    if (!isSupportedRefName(name))
+    {
+        return ReferenceLookup{ .status = ReferenceLookupStatus::UNSUPPORTED, .value = "" };
+    }
+
+    // The same order as git uses to disambiguate short names
+    const auto nameStr = std::string{ name };
+    const auto candidates = std::array{
+        (name.starts_with("refs/") || isPseudoRefName(name)) ? nameStr : std::string{},
+        "refs/" + nameStr,
+        "refs/tags/" + nameStr,
+        "refs/heads/" + nameStr,
+        "refs/remotes/" + nameStr,
+        "refs/remotes/" + nameStr + "/HEAD"
+    };
+
+    for (const auto& candidate : candidates)
+    {
+        if (candidate.empty())
+        {
+            continue;
+        }
+
+        if (auto lookup = resolveRef(candidate); lookup.status != ReferenceLookupStatus::NOT_FOUND)
+        {
+            return lookup;
+        }
+    }
+
+    return ReferenceLookup{ .status = ReferenceLookupStatus::NOT_FOUND, .value = "" };
+}
+
+auto ReferencesReader::resolveSymbolicRef(const std::string_view refName) -> ReferenceLookup
+{
+    if (!supported || !isSupportedRefName(refName))
+    {
+        return ReferenceLookup{ .status = ReferenceLookupStatus::UNSUPPORTED, .value = "" };
+    }
+
+    auto target = std::string{};
+    const auto refType = readLooseRef(refName, target);
+    if (refType == LooseRefType::BROKEN)
+    {
+        return ReferenceLookup{ .status = ReferenceLookupStatus::UNSUPPORTED, .value = "" };
+    }
+
+    // Packed refs are never symbolic
+    if (refType != LooseRefType::SYMBOLIC)
+    {
+        return ReferenceLookup{ .status = ReferenceLookupStatus::NOT_FOUND, .value = "" };
+    }
+
+    auto nextTarget = std::string{};
+    for (auto depth = 0; depth < MAX_SYMBOLIC_REF_DEPTH; ++depth)
+    {
+        const auto targetType = readLooseRef(target, nextTarget);
+        if (targetType == LooseRefType::BROKEN)
+        {
+            return ReferenceLookup{ .status = ReferenceLookupStatus::UNSUPPORTED, .value = "" };
+        }
+
+        if (targetType != LooseRefType::SYMBOLIC)
+        {
+            break;
+        }
+
+        target = std::move(nextTarget);
+    }
+
+    return ReferenceLookup{ .status = ReferenceLookupStatus::FOUND, .value = std::move(target) };
+}
+
+auto ReferencesReader::readLooseRef(const std::string_view refName, std::string& value) const -> LooseRefType
+{
+    const auto& refsDirectoryPath = isWorktreeRefName(refName) ? gitDirectoryPath : commonDirectoryPath;
+    const auto fileDescriptor = open((refsDirectoryPath / refName).c_str(), O_RDONLY | O_CLOEXEC);
+    if (fileDescriptor == -1)
+    {
+        return (errno == ENOENT || errno == ENOTDIR) ? LooseRefType::MISSING : LooseRefType::BROKEN;
+    }
+
+    auto buffer = std::array<char, MAX_LOOSE_REF_SIZE>{};
+    auto contentSize = std::size_t{ 0 };
+    while (contentSize < buffer.size())
+    {
+        const auto bytesRead = read(fileDescriptor, buffer.data() + contentSize, buffer.size() - contentSize);
+        if (bytesRead == -1 && errno == EINTR)
+        {
+            continue;
+        }
+
+        if (bytesRead == -1)
+        {
+            // Directory with the same name as the reference (e.g. refs/heads) means there is no such reference
+            const auto isDirectory = errno == EISDIR;
+            close(fileDescriptor);
+            return isDirectory ? LooseRefType::MISSING : LooseRefType::BROKEN;
+        }
+
+        if (bytesRead == 0)
+        {
+            break;
+        }
+        contentSize += static_cast<std::size_t>(bytesRead);
+    }
+    close(fileDescriptor);
+
+    const auto content = trimTrailingWhitespaces(std::string_view{ buffer.data(), contentSize });
+
+    if (content.starts_with(SYMBOLIC_REF_PREFIX))
+    {
+        auto target = content.substr(SYMBOLIC_REF_PREFIX.size());
+        target.remove_prefix(std::min(target.find_first_not_of(" \t"), target.size()));
+        if (!isSupportedRefName(target))
+        {
+            return LooseRefType::BROKEN;
+        }
+
+        value = target;
+        return LooseRefType::SYMBOLIC;
+    }
+
+    if (!isHash(content))
+    {
+        return LooseRefType::BROKEN;
+    }
+
+    value = ObjectId::fromHex(content).toHex();
+    return LooseRefType::HASH;
+}
+
+auto ReferencesReader::loadPackedRefs() -> void
+{
+    packedRefsLoaded = true;
+
+    const auto fileDescriptor = open((commonDirectoryPath / "packed-refs").c_str(), O_RDONLY | O_CLOEXEC);
+    if (fileDescriptor == -1)
+    {
+        // No packed-refs is the same as empty one
+        packedRefsValid = errno == ENOENT;
+        return;
+    }
+
+    struct stat fileStat{};
+    if (fstat(fileDescriptor, &fileStat) == -1)
+    {
+        close(fileDescriptor);
+        return;
+    }
+
+    if (fileStat.st_size == 0)
+    {
+        close(fileDescriptor);
+        packedRefsValid = true;
+        return;
+    }
+
+    auto* const mapping = mmap(nullptr, static_cast<std::size_t>(fileStat.st_size), PROT_READ, MAP_PRIVATE, fileDescriptor, 0);
+    close(fileDescriptor);
+    if (mapping == MAP_FAILED)
+    {
+        return;
+    }
+
+    packedRefsData = static_cast<const char*>(mapping);
+    packedRefsSize = static_cast<std::size_t>(fileStat.st_size);
+
+    // Every record ends with LF, otherwise the file is corrupted or being written
+    if (packedRefsData[packedRefsSize - 1] != '\n')
+    {
+        return;
+    }
+
+    const auto content = std::string_view{ packedRefsData, packedRefsSize };
+    if (content.starts_with(PACKED_REFS_HEADER))
+    {
+        const auto headerEnd = content.find('\n');
+        const auto traits = content.substr(PACKED_REFS_HEADER.size(), headerEnd - PACKED_REFS_HEADER.size());
+        packedRefsSorted = traits.contains(" sorted ") || traits.ends_with(" sorted");
+        packedRefsRecordsStart = headerEnd + 1;
+    }
+
+    packedRefsValid = true;
+}
+
+auto ReferencesReader::findPackedRef(const std::string_view refName) -> ReferenceLookup
+{
+    if (!packedRefsLoaded)
+    {
+        loadPackedRefs();
+    }
+
+    if (!packedRefsValid)
+    {
+        return ReferenceLookup{ .status = ReferenceLookupStatus::UNSUPPORTED, .value = "" };
+    }
+
+    // <hash> SP <refname> LF, optionally followed by ^<peeled hash> LF for annotated tags
+    const auto content = std::string_view{ packedRefsData, packedRefsSize };
+    auto low = packedRefsRecordsStart;
+    auto high = packedRefsSize;
+    while (low < high)
+    {
+        const auto recordStart = packedRefsSorted ? getPackedRecordStart(low + ((high - low) / 2)) : low;
+        const auto lineEnd = content.find('\n', recordStart);
+        const auto line = content.substr(recordStart, lineEnd - recordStart);
+        const auto spacePos = line.find(' ');
+        if (spacePos == std::string_view::npos || !isHash(line.substr(0, spacePos)))
+        {
+            return ReferenceLookup{ .status = ReferenceLookupStatus::UNSUPPORTED, .value = "" };
+        }
+
+        const auto recordRefName = line.substr(spacePos + 1);
+        const auto comparison = recordRefName.compare(refName);
+        if (comparison == 0)
+        {
+            return ReferenceLookup{ .status = ReferenceLookupStatus::FOUND, .value = std::string{ line.substr(0, spacePos) } };
+        }
+
+        if (comparison < 0 || !packedRefsSorted)
+        {
+            low = getPackedRecordEnd(recordStart);
+        }
+        else
+        {
+            high = recordStart;
+        }
+    }
+
+    return ReferenceLookup{ .status = ReferenceLookupStatus::NOT_FOUND, .value = "" };
+}
+
+auto ReferencesReader::getPackedRecordStart(std::size_t position) const -> std::size_t
+{
+    while (position > packedRefsRecordsStart && packedRefsData[position - 1] != '\n')
+    {
+        --position;
+    }
+
+    // Peeled line belongs to the record above it
+    while (position > packedRefsRecordsStart && packedRefsData[position] == '^')
+    {
+        --position;
+        while (position > packedRefsRecordsStart && packedRefsData[position - 1] != '\n')
+        {
+            --position;
+        }
+    }
+
+    return position;
+}
+
+auto ReferencesReader::getPackedRecordEnd(std::size_t position) const -> std::size_t
+{
+    const auto content = std::string_view{ packedRefsData, packedRefsSize };
+
+    position = content.find('\n', position) + 1;
+    while (position < packedRefsSize && packedRefsData[position] == '^')
+    {
+        position = content.find('\n', position) + 1;
+    }
+
+    return position;
+}
+
+} // namespace CppGit::_details
@@ -0,0 +1,284 @@
+#include "CppGit/_details/RepositoryContext.hpp"
+
+#include "CppGit/GitConfigSnapshot.hpp"
+#include "CppGit/_details/FileUtility.hpp"
+#include "CppGit/_details/Parser/ConfigParser.hpp"
+
+#include <algorithm>
+#include <cctype>
+#include <cstdlib>
+#include <filesystem>
+#include <optional>
+#include <ranges>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <sys/stat.h>
+#include <system_error>
+#include <vector>
+
+namespace CppGit::_details {
+
+namespace {
+
+constexpr auto GITFILE_PREFIX = std::string_view{ "gitdir:" };
+
+// Settings from the repository config which affect discovery
+struct DiscoveryConfig
+{
+    std::optional<bool> bare;
+    bool hasWorktree{ false };
+    std::string objectFormat{ "sha1" };
+};
+
+auto trim(std::string_view value) -> std::string_view
+{
+    const auto isSpace = [](const char character) { return std::isspace(static_cast<unsigned char>(character)) != 0; };
+
+    while (!value.empty() && isSpace(value.front()))
+    {
+        value.remove_prefix(1);
+    }
+    while (!value.empty() && isSpace(value.back()))
+    {
+        value.remove_suffix(1);
+    }
+
+    return value;
+}
+
+auto isIncludeKey(const std::string_view key) -> bool
+{
+    return key == "include.path" || (key.starts_with("includeif.") && key.ends_with(".path"));
+}
+
+auto readDiscoveryConfig(const std::filesystem::path& configPath) -> std::optional<DiscoveryConfig>
+{
+    auto discoveryConfig = DiscoveryConfig{};
+    try
+    {
+        for (const auto& [key, value] : ConfigParser::parseConfigFile(FileUtility::readFile(configPath)))
+        {
+            // Included files and per-worktree config could set any of the values too, only git reads them properly
+            if (isIncludeKey(key) || (key == "extensions.worktreeconfig" && GitConfigSnapshot::parseBool(key, value)))
+            {
+                return std::nullopt;
+            }
+
+            if (key == "core.bare")
+            {
+                discoveryConfig.bare = GitConfigSnapshot::parseBool(key, value);
+            }
+            else if (key == "core.worktree")
+            {
+                discoveryConfig.hasWorktree = true;
+            }
+            else if (key == "extensions.objectformat" && value)
+            {
+                discoveryConfig.objectFormat = *value;
+            }
+        }
+    }
+    catch (const std::runtime_error&)
+    {
+        return std::nullopt;
+    }
+
+    return discoveryConfig;
+}
+
+auto getCommonDirectoryPath(const std::filesystem::path& gitDirectoryPath) -> std::filesystem::path
+{
+    // Git directories of linked worktrees point to the main one with commondir file
+    const auto commonDirFilePath = gitDirectoryPath / "commondir";
+    auto error = std::error_code{};
+    if (!std::filesystem::is_regular_file(commonDirFilePath, error))
+    {
+        return gitDirectoryPath;
+    }
+
+    const auto commonDir = std::filesystem::path{ trim(FileUtility::readFile(commonDirFilePath)) };
+    return std::filesystem::weakly_canonical(commonDir.is_absolute() ? commonDir : gitDirectoryPath / commonDir, error);
+}
+
+auto isGitDirectory(const std::filesystem::path& directoryPath) -> bool
+{
+    auto error = std::error_code{};
+    const auto commonDirectoryPath = getCommonDirectoryPath(directoryPath);
+
+    return std::filesystem::exists(directoryPath / "HEAD", error)
+        && std::filesystem::is_directory(commonDirectoryPath / "objects", error)
+        && std::filesystem::is_directory(commonDirectoryPath / "refs", error);
+}
+
+auto readGitFile(const std::filesystem::path& gitFilePath) -> std::optional<std::filesystem::path>
+{
+    const auto content = FileUtility::readFile(gitFilePath);
+    const auto line = trim(std::string_view{ content });
+    if (!line.starts_with(GITFILE_PREFIX))
+    {
+        return std::nullopt;
+    }
+
+    const auto gitDirectory = std::filesystem::path{ trim(line.substr(GITFILE_PREFIX.size())) };
+    auto error = std::error_code{};
+    auto gitDirectoryPath = std::filesystem::canonical(gitDirectory.is_absolute() ? gitDirectory : gitFilePath.parent_path() / gitDirectory, error);
+    if (error)
+    {
+        return std::nullopt;
+    }
+
+    return gitDirectoryPath;
+}
+
+auto getCeilingDirectories() -> std::vector<std::filesystem::path>
+{
+    const auto* const ceilingDirectoriesEnv = std::getenv("GIT_CEILING_DIRECTORIES");
+    if (ceilingDirectoriesEnv == nullptr)
+    {
+        return {};
+    }
+
+    auto ceilingDirectories = std::vector<std::filesystem::path>{};
+    for (const auto ceilingDirectory : std::string_view{ ceilingDirectoriesEnv } | std::views::split(':'))
+    {
+        const auto ceilingDirectoryPath = std::filesystem::path{ std::string_view{ ceilingDirectory.begin(), ceilingDirectory.end() } };
+        if (ceilingDirectoryPath.is_absolute())
+        {
+            auto error = std::error_code{};
+            ceilingDirectories.push_back(std::filesystem::weakly_canonical(ceilingDirectoryPath, error).lexically_normal());
+        }
+    }
+
+    return ceilingDirectories;
+}
+
+auto isDiscoveryAcrossFilesystemAllowed() -> bool
+{
+    const auto* const acrossFilesystemEnv = std::getenv("GIT_DISCOVERY_ACROSS_FILESYSTEM");
+    if (acrossFilesystemEnv == nullptr)
+    {
+        return false;
+    }
+
+    try
+    {
+        return GitConfigSnapshot::parseBool("GIT_DISCOVERY_ACROSS_FILESYSTEM", std::string{ acrossFilesystemEnv });
+    }
+    catch (const std::runtime_error&)
+    {
+        return false;
+    }
+}
+
+auto getDeviceId(const std::filesystem::path& path) -> std::optional<dev_t>
+{
+    struct stat pathStat{};
+    if (stat(path.c_str(), &pathStat) == -1)
+    {
+        return std::nullopt;
+    }
+
+    return pathStat.st_dev;
+}
+
+auto createContext(std::filesystem::path topLevelPath, std::filesystem::path gitDirectoryPath) -> std::optional<RepositoryContext>
+{
+    auto commonDirectoryPath = getCommonDirectoryPath(gitDirectoryPath);
+    const auto discoveryConfig = readDiscoveryConfig(commonDirectoryPath / "config");
+
+    // With core.worktree the working tree can be anywhere
+    if (!discoveryConfig || discoveryConfig->hasWorktree)
+    {
+        return std::nullopt;
+    }
+
+    // Working tree is used only if it has been found by .git entry and the repository isn't configured as bare
+    const auto bare = discoveryConfig->bare.value_or(topLevelPath.empty());
+    if (bare)
+    {
+        topLevelPath.clear();
+    }
+
+    return RepositoryContext{ .topLevelPath = std::move(topLevelPath),
+                              .gitDirectoryPath = std::move(gitDirectoryPath),
+                              .commonDirectoryPath = std::move(commonDirectoryPath),
+                              .objectFormat = discoveryConfig->objectFormat,
+                              .bare = bare };
+}
+
+} // namespace
+
+auto discoverRepositoryContext(const std::filesystem::path& path) -> std::optional<RepositoryContext>
+{
+    if (std::getenv("GIT_DIR") != nullptr || std::getenv("GIT_WORK_TREE") != nullptr || std::getenv("GIT_COMMON_DIR") != nullptr)
+    {
+        return std::nullopt;
+    }
+
+    auto error = std::error_code{};
+    auto directoryPath = std::filesystem::canonical(path, error);
+    if (error)
+    {
+        return std::nullopt;
+    }
+
+    const auto ceilingDirectories = getCeilingDirectories();
+
+    // Like git, the walk stops at the filesystem boundary unless GIT_DISCOVERY_ACROSS_FILESYSTEM is set
+    const auto acrossFilesystem = isDiscoveryAcrossFilesystemAllowed();
+    const auto deviceId = getDeviceId(directoryPath);
+    if (!deviceId)
+    {
+        return std::nullopt;
+    }
+
+    while (true)
+    {
+        const auto dotGitPath = directoryPath / ".git";
+        if (std::filesystem::is_directory(dotGitPath, error) && isGitDirectory(dotGitPath))
+        {
+            return createContext(directoryPath, dotGitPath);
+        }
+
+        if (std::filesystem::is_regular_file(dotGitPath, error))
+        {
+            auto gitDirectoryPath = readGitFile(dotGitPath);
+            if (!gitDirectoryPath || !isGitDirectory(*gitDirectoryPath))
+            {
+                return std::nullopt;
+            }
+
+            return createContext(directoryPath, std::move(*gitDirectoryPath));
+        }
+
+        if (isGitDirectory(directoryPath))
+        {
+            return createContext({}, directoryPath);
+        }
+
+        auto parentPath = directoryPath.parent_path();
+        if (parentPath == directoryPath || std::ranges::find(ceilingDirectories, parentPath) != ceilingDirectories.end())
+        {
+            return std::nullopt;
+        }
+        if (!acrossFilesystem && getDeviceId(parentPath) != deviceId)
+        {
+            return std::nullopt;
+        }
+        directoryPath = std::move(parentPath);
+    }
+}
+
+auto isRepositoryContextValid(const RepositoryContext& context) -> bool
+{
+    auto error = std::error_code{};
+    if (!isGitDirectory(context.gitDirectoryPath))
+    {
+        return false;
+    }
+
+    return context.topLevelPath.empty() || std::filesystem::exists(context.topLevelPath / ".git", error);
+}
+
+} // namespace CppGit::_details
@@ -0,0 +1,73 @@
+#include "CppGit/_details/SignaturePool.hpp"
+
+#include "CppGit/Signature.hpp"
+
+#include <cstddef>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_set>
+#include <utility>
+
+namespace CppGit::_details {
+
+namespace {
+
+using SignatureKey = std::pair<std::string_view, std::string_view>;
+
+struct SignatureHash
+{
+    using is_transparent = void;
+
+    auto operator()(const SignatureKey& key) const noexcept -> std::size_t
+    {
+        const auto hasher = std::hash<std::string_view>{};
+        return hasher(key.first) ^ (hasher(key.second) * 31);
+    }
+
+    auto operator()(const Signature& signature) const noexcept -> std::size_t
+    {
+        return (*this)(SignatureKey{ signature.name, signature.email });
+    }
+};
+
+struct SignatureEqual
+{
+    using is_transparent = void;
+
+    static auto toKey(const Signature& signature) -> SignatureKey
+    {
+        return { signature.name, signature.email };
+    }
+
+    static auto toKey(const SignatureKey& key) -> const SignatureKey&
+    {
+        return key;
+    }
+
+    auto operator()(const auto& lhs, const auto& rhs) const -> bool
+    {
+        return toKey(lhs) == toKey(rhs);
+    }
+};
+
+} // namespace
+
+auto SignaturePool::intern(const std::string_view name, const std::string_view email) -> const Signature&
+{
+    // Nodes of unordered_set are never moved, so references to the signatures stay valid after rehashing
+    static auto signatures = std::unordered_set<Signature, SignatureHash, SignatureEqual>{};
+    static auto signaturesMutex = std::mutex{};
+
+    const auto lock = std::lock_guard{ signaturesMutex };
+    const auto key = SignatureKey{ name, email };
+    if (const auto signatureIt = signatures.find(key); signatureIt != signatures.end())
+    {
+        return *signatureIt;
+    }
+
+    return *signatures.emplace(std::string{ name }, std::string{ email }).first;
+}
+
+} // namespace CppGit::_details
@@ -0,0 +1,55 @@
+#include "CppGit/_details/StreamRecordsSplitter.hpp"
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <utility>
+
+namespace CppGit::_details {
+
+StreamRecordsSplitter::StreamRecordsSplitter(std::string separator, const std::size_t separatorTailLength, RecordConsumer recordConsumer)
+    : separator{ std::move(separator) },
+      separatorTailLength{ separatorTailLength },
+      recordConsumer{ std::move(recordConsumer) }
+{
+}
+
+auto StreamRecordsSplitter::feed(const std::string_view chunk) -> void
+{
+    buffer.append(chunk);
+
+    const auto bufferSV = std::string_view{ buffer };
+    auto separatorPos = bufferSV.find(separator, searchFrom);
+    while (separatorPos != std::string_view::npos)
+    {
+        recordConsumer(bufferSV.substr(recordStart, separatorPos - recordStart));
+        recordStart = separatorPos + separator.size() - separatorTailLength;
+        separatorPos = bufferSV.find(separator, recordStart);
+    }
+
+    // Separator might have been cut between chunks, so next search has to start a bit earlier
+    const auto unfinishedSize = buffer.size() - recordStart;
+    searchFrom = recordStart + (unfinishedSize >= separator.size() ? unfinishedSize - separator.size() + 1 : 0);
+
+    // Drop already consumed records, but not too often to not move the unfinished record back and forth
+    if (recordStart > 0 && recordStart >= unfinishedSize)
+    {
+        buffer.erase(0, recordStart);
+        searchFrom -= recordStart;
+        recordStart = 0;
+    }
+}
+
+auto StreamRecordsSplitter::finish() -> void
+{
+    if (recordStart < buffer.size())
+    {
+        recordConsumer(std::string_view{ buffer }.substr(recordStart));
+    }
+
+    buffer.clear();
+    recordStart = 0;
+    searchFrom = 0;
+}
+
+} // namespace CppGit::_details
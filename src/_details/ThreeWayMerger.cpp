@@ -1,19 +1,84 @@
 #include "CppGit/_details/ThreeWayMerger.hpp"
 
+#include "CppGit/GitConfigSnapshot.hpp"
 #include "CppGit/IndexManager.hpp"
 #include "CppGit/Repository.hpp"
+#include "CppGit/_details/FileMerger.hpp"
 
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdlib>
+#include <exception>
 #include <filesystem>
 #include <fstream>
 #include <ios>
+#include <mutex>
+#include <stdexcept>
 #include <string>
 #include <string_view>
+#include <system_error>
+#include <thread>
+#include <unistd.h>
 #include <unordered_map>
 #include <utility>
 #include <vector>
 
 namespace CppGit::_details {
 
+namespace {
+
+/// Temporary file with given content, removed when the object is destroyed
+class TempFile
+{
+public:
+    TempFile(const std::filesystem::path& directory, const std::string_view content)
+    {
+        auto tempFilePath = (directory / ".merge_file_XXXXXX").string();
+        const auto fileDescriptor = mkstemp(tempFilePath.data());
+        if (fileDescriptor == -1)
+        {
+            throw std::runtime_error("Failed to create temporary file");
+        }
+        path = std::move(tempFilePath);
+
+        auto written = std::size_t{ 0 };
+        while (written < content.size())
+        {
+            const auto result = write(fileDescriptor, content.data() + written, content.size() - written);
+            if (result == -1)
+            {
+                close(fileDescriptor);
+                std::filesystem::remove(path);
+                throw std::runtime_error("Failed to write temporary file");
+            }
+            written += static_cast<std::size_t>(result);
+        }
+        close(fileDescriptor);
+    }
+
+    TempFile(const TempFile&) = delete;
+    TempFile(TempFile&&) = delete;
+    auto operator=(const TempFile&) -> TempFile& = delete;
+    auto operator=(TempFile&&) -> TempFile& = delete;
+
+    ~TempFile()
+    {
+        auto error = std::error_code{};
+        std::filesystem::remove(path, error);
+    }
+
+    [[nodiscard]] auto getPath() const -> const std::filesystem::path&
+    {
+        return path;
+    }
+
+private:
+    std::filesystem::path path;
+};
+
+} // namespace
+
 ThreeWayMerger::ThreeWayMerger(const Repository& repository)
     : repository{ &repository }
 {
@@ -21,44 +86,44 @@ ThreeWayMerger::ThreeWayMerger(const Repository& repository)
 
 auto ThreeWayMerger::mergeConflictedFiles(const std::vector<IndexEntry>& unmergedFilesEntries, const std::string_view sourceLabel, const std::string_view targetLabel) const -> void
 {
-    auto unmergedFiles = createUnmergedFileMap(unmergedFilesEntries);
+    const auto unmergedFiles = createUnmergedFileMap(unmergedFilesEntries);
 
     const auto repoRootPath = repository->getTopLevelPath();
 
+    // The object reader is a single process, so blobs are read one after another, only merging and writing is done in parallel
+    auto filesToMerge = std::vector<FileToMerge>{};
+    filesToMerge.reserve(unmergedFiles.size());
     for (const auto& [file, unmergedFile] : unmergedFiles)
     {
-        auto baseTempFile = unpackFile(unmergedFile.baseBlob);
-        auto targetTempFile = unpackFile(unmergedFile.targetBlob);
-        auto sourceTempFile = unpackFile(unmergedFile.sourceBlob);
+        filesToMerge.push_back(FileToMerge{ .path = repoRootPath / file,
+                                            .baseContent = readBlobContent(unmergedFile.baseBlob),
+                                            .targetContent = readBlobContent(unmergedFile.targetBlob),
+                                            .sourceContent = readBlobContent(unmergedFile.sourceBlob),
+                                            .targetFileMode = unmergedFile.targetFileMode });
+    }
 
-        if (baseTempFile.empty())
+    // FileMerger writes conflicts only in the default style, git merges the files when diff3 or zdiff3 style is configured
+    if (repository->getConfigSnapshot()->getString("merge.conflictStyle").value_or("merge") != "merge")
+    {
+        for (const auto& fileToMerge : filesToMerge)
         {
-            baseTempFile = "/dev/null";
+            mergeAndWriteFileWithGit(fileToMerge, sourceLabel, targetLabel);
         }
 
-        repository->executeGitCommand("merge-file", "-L", targetLabel, "-L", "ancestor", "-L", sourceLabel, targetTempFile, baseTempFile, sourceTempFile);
-
-        repository->executeGitCommand("checkout-index", "-f", "--stage=2", "--", file);
-
-        auto baseTempFilePath = std::filesystem::path{ repoRootPath / baseTempFile };
-
-        auto targetTempFilePath = std::filesystem::path{ repoRootPath / std::move(targetTempFile) };
-        auto sourceTempFilePath = std::filesystem::path{ repoRootPath / std::move(sourceTempFile) };
-        auto filePath = std::filesystem::path{ repoRootPath / file };
-
-        auto src_file = std::ifstream{ targetTempFilePath, std::ios::binary };
-        auto dst_file = std::ofstream{ filePath, std::ios::binary | std::ios::trunc };
-        dst_file << src_file.rdbuf();
-        src_file.close();
-        dst_file.close();
+        return;
+    }
 
-        std::filesystem::remove(targetTempFilePath);
-        std::filesystem::remove(sourceTempFilePath);
-        if (baseTempFile != "/dev/null")
+    if (filesToMerge.size() < PARALLEL_MERGE_MIN_FILES)
+    {
+        for (const auto& fileToMerge : filesToMerge)
         {
-            std::filesystem::remove(baseTempFilePath);
+            mergeAndWriteFile(fileToMerge, sourceLabel, targetLabel);
         }
     }
+    else
+    {
+        mergeAndWriteFilesInParallel(filesToMerge, sourceLabel, targetLabel);
+    }
 }
 
 auto ThreeWayMerger::createMergeMsgFile(const std::string_view msg, const std::string_view description) const -> void
@@ -92,15 +157,113 @@ auto ThreeWayMerger::getMergeMsg() const -> std::string
     return msg;
 }
 
-auto ThreeWayMerger::unpackFile(const std::string_view fileBlob) const -> std::string
+auto ThreeWayMerger::readBlobContent(const std::string_view fileBlob) const -> std::string
 {
     if (fileBlob.empty())
     {
         return std::string{};
     }
 
-    auto output = repository->executeGitCommand("unpack-file", fileBlob);
-    return std::move(output.stdout);
+    auto blob = repository->readObject(fileBlob);
+    if (!blob)
+    {
+        return std::string{};
+    }
+
+    return std::move(blob->content);
+}
+
+auto ThreeWayMerger::mergeAndWriteFile(const FileToMerge& file, const std::string_view sourceLabel, const std::string_view targetLabel) -> void
+{
+    const auto mergeResult = FileMerger::mergeFile(file.baseContent, file.targetContent, file.sourceContent, targetLabel, sourceLabel);
+    writeMergedFile(file, mergeResult.content);
+}
+
+auto ThreeWayMerger::mergeAndWriteFileWithGit(const FileToMerge& file, const std::string_view sourceLabel, const std::string_view targetLabel) const -> void
+{
+    const auto baseTempFile = TempFile{ repository->getGitDirectoryPath(), file.baseContent };
+    const auto targetTempFile = TempFile{ repository->getGitDirectoryPath(), file.targetContent };
+    const auto sourceTempFile = TempFile{ repository->getGitDirectoryPath(), file.sourceContent };
+
+    // Output is streamed, because the output of executeGitCommand has its trailing new line removed
+    auto mergedContent = std::string{};
+    const auto output = repository->executeGitCommandStreaming([&mergedContent](const std::string_view chunk) { mergedContent.append(chunk); },
+                                                               "merge-file",
+                                                               "-p",
+                                                               "-L",
+                                                               targetLabel,
+                                                               "-L",
+                                                               "ancestor",
+                                                               "-L",
+                                                               sourceLabel,
+                                                               targetTempFile.getPath().string(),
+                                                               baseTempFile.getPath().string(),
+                                                               sourceTempFile.getPath().string());
+
+    // Exit code is the number of conflicts, an error (e.g. binary file) leaves our side as it is
+    constexpr auto maxConflictsReturnCode = 127;
+    if (output.return_code < 0 || output.return_code > maxConflictsReturnCode)
+    {
+        writeMergedFile(file, file.targetContent);
+    }
+    else
+    {
+        writeMergedFile(file, mergedContent);
+    }
+}
+
+auto ThreeWayMerger::writeMergedFile(const FileToMerge& file, const std::string_view content) -> void
+{
+    auto fileStream = std::ofstream{ file.path, std::ios::binary | std::ios::trunc };
+    if (!fileStream)
+    {
+        throw std::runtime_error("Failed to write merged file");
+    }
+    fileStream.write(content.data(), static_cast<std::streamsize>(content.size()));
+    fileStream.close();
+
+    constexpr auto executablePermissions = std::filesystem::perms::owner_exec | std::filesystem::perms::group_exec | std::filesystem::perms::others_exec;
+    constexpr auto executableFileMode = 100'755;
+    std::filesystem::permissions(file.path, executablePermissions, file.targetFileMode == executableFileMode ? std::filesystem::perm_options::add : std::filesystem::perm_options::remove);
+}
+
+auto ThreeWayMerger::mergeAndWriteFilesInParallel(const std::vector<FileToMerge>& files, const std::string_view sourceLabel, const std::string_view targetLabel) -> void
+{
+    const auto threadsCount = std::min<std::size_t>(std::max(std::thread::hardware_concurrency(), 1U), files.size());
+
+    auto nextFileIndex = std::atomic<std::size_t>{ 0 };
+    auto firstException = std::exception_ptr{};
+    auto exceptionMutex = std::mutex{};
+
+    {
+        auto workers = std::vector<std::jthread>{};
+        workers.reserve(threadsCount);
+        for (auto i = std::size_t{ 0 }; i < threadsCount; ++i)
+        {
+            workers.emplace_back([&] {
+                try
+                {
+                    for (auto fileIndex = nextFileIndex++; fileIndex < files.size(); fileIndex = nextFileIndex++)
+                    {
+                        mergeAndWriteFile(files[fileIndex], sourceLabel, targetLabel);
+                    }
+                }
+                catch (...)
+                {
+                    auto lock = std::lock_guard{ exceptionMutex };
+                    if (!firstException)
+                    {
+                        firstException = std::current_exception();
+                    }
+                }
+            });
+        }
+    }
+
+    if (firstException)
+    {
+        std::rethrow_exception(firstException);
+    }
 }
 
 auto ThreeWayMerger::createUnmergedFileMap(const std::vector<IndexEntry>& unmergedFilesEntries) -> std::unordered_map<std::string, UnmergedFileBlobs>
@@ -110,7 +273,7 @@ auto ThreeWayMerger::createUnmergedFileMap(const std::vector<IndexEntry>& unmerg
     for (const auto& indexEntry : unmergedFilesEntries)
     {
         auto& unmergedFile = unmergedFiles[indexEntry.path];
-        const auto& fileBlob = indexEntry.objectHash;
+        const auto fileBlob = indexEntry.objectHash.toHex();
 
         if (indexEntry.stageNumber == 1)
         {
@@ -119,6 +282,7 @@ auto ThreeWayMerger::createUnmergedFileMap(const std::vector<IndexEntry>& unmerg
         else if (indexEntry.stageNumber == 2)
         {
             unmergedFile.targetBlob = fileBlob;
+            unmergedFile.targetFileMode = indexEntry.fileMode;
         }
         else if (indexEntry.stageNumber == 3)
         {
@@ -0,0 +1,178 @@
+#include "CppGit/_details/UnifiedDiffBuilder.hpp"
+
+#include "CppGit/DiffFile.hpp"
+#include "CppGit/_details/LineDiff.hpp"
+
+#include <algorithm>
+#include <cctype>
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace CppGit::_details {
+
+auto UnifiedDiffBuilder::isBinary(const std::string_view content) -> bool
+{
+    return content.substr(0, BINARY_CHECK_SIZE).find('\0') != std::string_view::npos;
+}
+
+auto UnifiedDiffBuilder::fillHunks(DiffFile& diffFile, const std::string_view oldContent, const std::string_view newContent, const DiffAlgorithm algorithm) -> bool
+{
+    const auto oldLines = LineDiff::splitLines(oldContent);
+    const auto newLines = LineDiff::splitLines(newContent);
+    const auto changes = LineDiff::diff(oldLines, newLines, algorithm, true);
+
+    if (changes.empty())
+    {
+        return false;
+    }
+
+    auto functionName = std::string{};
+    auto functionSearchLimit = std::size_t{ 0 };
+
+    for (auto firstChangeIndex = std::size_t{ 0 }; firstChangeIndex < changes.size();)
+    {
+        const auto lastChangeIndex = getLastChangeOfHunk(changes, firstChangeIndex);
+        const auto& firstChange = changes[firstChangeIndex];
+        const auto& lastChange = changes[lastChangeIndex];
+
+        const auto oldStart = firstChange.oldStart - std::min(firstChange.oldStart, CONTEXT_LINES);
+        const auto newStart = firstChange.newStart - std::min(firstChange.newStart, CONTEXT_LINES);
+        const auto oldEnd = std::min(lastChange.oldStart + lastChange.oldCount + CONTEXT_LINES, oldLines.size());
+        const auto newEnd = std::min(lastChange.newStart + lastChange.newCount + CONTEXT_LINES, newLines.size());
+
+        // Function name is searched backwards from the hunk start, but only up to the previous hunk start, otherwise the previous one is reused
+        findFunctionName(oldLines, oldStart, functionSearchLimit, functionName);
+        functionSearchLimit = oldStart;
+
+        if (firstChangeIndex == 0)
+        {
+            diffFile.hunkRangesBefore = { getHunkRange(oldStart, oldEnd - oldStart) };
+            diffFile.hunkRangeAfter = getHunkRange(newStart, newEnd - newStart);
+        }
+        else
+        {
+            diffFile.hunkContent.push_back(createHunkHeader(oldStart, oldEnd - oldStart, newStart, newEnd - newStart, functionName));
+        }
+
+        auto newIndex = newStart;
+        for (auto changeIndex = firstChangeIndex; changeIndex <= lastChangeIndex; ++changeIndex)
+        {
+            const auto& change = changes[changeIndex];
+            for (; newIndex < change.newStart; ++newIndex)
+            {
+                appendLine(diffFile.hunkContent, ' ', newLines[newIndex]);
+            }
+            for (auto oldIndex = change.oldStart; oldIndex < change.oldStart + change.oldCount; ++oldIndex)
+            {
+                appendLine(diffFile.hunkContent, '-', oldLines[oldIndex]);
+            }
+            for (; newIndex < change.newStart + change.newCount; ++newIndex)
+            {
+                appendLine(diffFile.hunkContent, '+', newLines[newIndex]);
+            }
+        }
+        for (; newIndex < newEnd; ++newIndex)
+        {
+            appendLine(diffFile.hunkContent, ' ', newLines[newIndex]);
+        }
+
+        firstChangeIndex = lastChangeIndex + 1;
+    }
+
+    return true;
+}
+
+auto UnifiedDiffBuilder::getLastChangeOfHunk(const std::vector<LineDiffChange>& changes, std::size_t firstChangeIndex) -> std::size_t
+{
+    // Changes are in the same hunk when their contexts overlap or touch
+    auto lastChangeIndex = firstChangeIndex;
+    while (lastChangeIndex + 1 < changes.size())
+    {
+        const auto& change = changes[lastChangeIndex];
+        const auto& nextChange = changes[lastChangeIndex + 1];
+        if (nextChange.oldStart - (change.oldStart + change.oldCount) > 2 * CONTEXT_LINES)
+        {
+            break;
+        }
+        ++lastChangeIndex;
+    }
+
+    return lastChangeIndex;
+}
+
+auto UnifiedDiffBuilder::findFunctionName(const std::vector<std::string_view>& oldLines, std::size_t start, const std::size_t limit, std::string& functionName) -> void
+{
+    // Same as git's default: a line starting with a letter, '_' or '$', trailing whitespace trimmed
+    while (start > limit)
+    {
+        const auto line = oldLines[--start];
+        if (line.empty())
+        {
+            continue;
+        }
+
+        if (const auto firstCharacter = static_cast<unsigned char>(line.front()); std::isalpha(firstCharacter) == 0 && firstCharacter != '_' && firstCharacter != '$')
+        {
+            continue;
+        }
+
+        auto name = line.substr(0, MAX_FUNCTION_NAME_SIZE);
+        while (!name.empty() && std::isspace(static_cast<unsigned char>(name.back())) != 0)
+        {
+            name.remove_suffix(1);
+        }
+        functionName = name;
+
+        return;
+    }
+}
+
+auto UnifiedDiffBuilder::createHunkHeader(const std::size_t oldStart, const std::size_t oldCount, const std::size_t newStart, const std::size_t newCount, const std::string_view functionName) -> std::string
+{
+    const auto formatRange = [](const char prefix, const std::size_t start, const std::size_t count) {
+        auto range = prefix + std::to_string(count == 0 ? start : start + 1);
+        if (count != 1)
+        {
+            range += "," + std::to_string(count);
+        }
+
+        return range;
+    };
+
+    auto header = "@@ " + formatRange('-', oldStart, oldCount) + " " + formatRange('+', newStart, newCount) + " @@";
+    if (!functionName.empty())
+    {
+        header += " ";
+        header += functionName;
+    }
+
+    return header;
+}
+
+auto UnifiedDiffBuilder::getHunkRange(const std::size_t start, const std::size_t count) -> std::pair<int, int>
+{
+    // Matches DiffParser, count of one line is omitted in hunk header, so it's -1
+    return { static_cast<int>(count == 0 ? start : start + 1), count == 1 ? -1 : static_cast<int>(count) };
+}
+
+auto UnifiedDiffBuilder::appendLine(std::vector<std::string>& hunkContent, const char prefix, std::string_view line) -> void
+{
+    const auto hasNewLine = line.ends_with('\n');
+    if (hasNewLine)
+    {
+        line.remove_suffix(1);
+    }
+
+    auto& contentLine = hunkContent.emplace_back(1, prefix);
+    contentLine += line;
+
+    if (!hasNewLine)
+    {
+        hunkContent.emplace_back(NO_NEW_LINE_MARKER);
+    }
+}
+
+} // namespace CppGit::_details
@@ -0,0 +1,154 @@
+#include "BaseRepositoryFixture.hpp"
+
+#include <CppGit/CommitsManager.hpp>
+#include <CppGit/_details/CommitGraphReader.hpp>
+#include <CppGit/_details/FileUtility.hpp>
+#include <CppGit/_details/Parser/Parser.hpp>
+#include <CppGit/_details/ReferencesManager.hpp>
+#include <algorithm>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <gtest/gtest.h>
+#include <string>
+#include <vector>
+
+class CommitGraphTests : public BaseRepositoryFixture
+{
+protected:
+    // Creates history with a regular merge and an octopus merge, so parents are read from both the commit data and the extra edges
+    auto createHistoryWithMerges() const -> void
+    {
+        const auto commitsManager = repository->CommitsManager();
+        const auto referencesManager = CppGit::_details::ReferencesManager{ *repository };
+
+        const auto initialCommitHash = commitsManager.createCommit("Initial commit");
+        const auto treeHash = repository->executeGitCommand("rev-parse", "HEAD^{tree}").stdout;
+        const auto firstCommitHash = repository->executeGitCommand("commit-tree", treeHash, "-p", initialCommitHash, "-m", "First").stdout;
+        const auto secondCommitHash = repository->executeGitCommand("commit-tree", treeHash, "-p", initialCommitHash, "-m", "Second").stdout;
+        const auto thirdCommitHash = repository->executeGitCommand("commit-tree", treeHash, "-p", initialCommitHash, "-m", "Third").stdout;
+        const auto mergeCommitHash = repository->executeGitCommand("commit-tree", treeHash, "-p", firstCommitHash, "-p", secondCommitHash, "-m", "Merge").stdout;
+        const auto octopusCommitHash = repository->executeGitCommand("commit-tree", treeHash, "-p", mergeCommitHash, "-p", secondCommitHash, "-p", thirdCommitHash, "-m", "Octopus").stdout;
+        referencesManager.updateRefHash("HEAD", octopusCommitHash);
+    }
+
+    // Compares every commit known to git with the commit-graph
+    auto expectCommitGraphSameAsGit(const CppGit::_details::CommitGraphReader& commitGraphReader) const -> void
+    {
+        const auto logOutput = repository->executeGitCommand("log", "--all", "--format=%H %T %ct %P").stdout;
+        const auto logLines = CppGit::Parser::splitToStringsVector(logOutput, '\n');
+
+        EXPECT_EQ(commitGraphReader.getCommitsCount(), logLines.size());
+        for (const auto& logLine : logLines)
+        {
+            const auto fields = CppGit::Parser::splitToStringsVector(logLine, ' ');
+            const auto position = commitGraphReader.findCommit(fields[0]);
+            ASSERT_TRUE(position.has_value()) << fields[0];
+
+            EXPECT_EQ(commitGraphReader.getCommitHash(*position), fields[0]);
+            EXPECT_EQ(commitGraphReader.getTreeHash(*position), fields[1]);
+            EXPECT_EQ(commitGraphReader.getCommitTime(*position), std::stoull(fields[2]));
+
+            auto parentsHashes = std::vector<std::string>{};
+            auto maxParentLevel = std::uint32_t{ 0 };
+            for (const auto parentPosition : commitGraphReader.getParents(*position))
+            {
+                parentsHashes.push_back(commitGraphReader.getCommitHash(parentPosition));
+                maxParentLevel = std::max(maxParentLevel, commitGraphReader.getTopologicalLevel(parentPosition));
+                EXPECT_GT(commitGraphReader.getGeneration(*position), commitGraphReader.getGeneration(parentPosition));
+            }
+            auto expectedParentsHashes = std::vector<std::string>(fields.begin() + 3, fields.end());
+            std::erase(expectedParentsHashes, ""); // root commits have empty %P
+            EXPECT_EQ(parentsHashes, expectedParentsHashes);
+            EXPECT_EQ(commitGraphReader.getTopologicalLevel(*position), maxParentLevel + 1);
+        }
+    }
+};
+
+TEST_F(CommitGraphTests, noCommitGraph)
+{
+    repository->CommitsManager().createCommit("Initial commit");
+
+
+    const auto commitGraphReader = CppGit::_details::CommitGraphReader{ repository->getCommonDirectoryPath() / "objects" };
+
+
+    EXPECT_FALSE(commitGraphReader.isValid());
+    EXPECT_EQ(commitGraphReader.getCommitsCount(), 0);
+    EXPECT_FALSE(commitGraphReader.findCommit(repository->executeGitCommand("rev-parse", "HEAD").stdout).has_value());
+}
+
+TEST_F(CommitGraphTests, singleFile)
+{
+    createHistoryWithMerges();
+    repository->executeGitCommand("commit-graph", "write", "--reachable");
+
+
+    const auto commitGraphReader = CppGit::_details::CommitGraphReader{ repository->getCommonDirectoryPath() / "objects" };
+
+
+    ASSERT_TRUE(commitGraphReader.isValid());
+    EXPECT_EQ(commitGraphReader.getLayersCount(), 1);
+    EXPECT_TRUE(commitGraphReader.hasCorrectedCommitDates());
+    EXPECT_EQ(commitGraphReader.getCommitsCount(), 6);
+    expectCommitGraphSameAsGit(commitGraphReader);
+    EXPECT_FALSE(commitGraphReader.findCommit(std::string(40, '0')).has_value());
+}
+
+TEST_F(CommitGraphTests, splitChain)
+{
+    createHistoryWithMerges();
+    repository->executeGitCommand("commit-graph", "write", "--reachable", "--split=no-merge");
+    const auto commitsManager = repository->CommitsManager();
+    commitsManager.createCommit("Fourth commit");
+    commitsManager.createCommit("Fifth commit");
+    repository->executeGitCommand("commit-graph", "write", "--reachable", "--split=no-merge");
+
+
+    const auto commitGraphReader = CppGit::_details::CommitGraphReader{ repository->getCommonDirectoryPath() / "objects" };
+
+
+    ASSERT_TRUE(commitGraphReader.isValid());
+    EXPECT_EQ(commitGraphReader.getLayersCount(), 2);
+    EXPECT_EQ(commitGraphReader.getCommitsCount(), 8);
+    expectCommitGraphSameAsGit(commitGraphReader);
+}
+
+TEST_F(CommitGraphTests, splitChain_corruptedLayer)
+{
+    createHistoryWithMerges();
+    repository->executeGitCommand("commit-graph", "write", "--reachable", "--split=no-merge");
+    const auto commitsManager = repository->CommitsManager();
+    commitsManager.createCommit("Fourth commit");
+    repository->executeGitCommand("commit-graph", "write", "--reachable", "--split=no-merge");
+    const auto chainDirectoryPath = repository->getCommonDirectoryPath() / "objects" / "info" / "commit-graphs";
+    const auto chainLayers = CppGit::Parser::splitToStringsVector(CppGit::_details::FileUtility::readFile(chainDirectoryPath / "commit-graph-chain"), '\n');
+    ASSERT_GE(chainLayers.size(), 2);
+    const auto topLayerPath = chainDirectoryPath / ("graph-" + chainLayers[1] + ".graph");
+    std::filesystem::permissions(topLayerPath, std::filesystem::perms::owner_write, std::filesystem::perm_options::add);
+    auto topLayerFile = std::fstream{ topLayerPath, std::ios::in | std::ios::out | std::ios::binary };
+    topLayerFile.write("XXXX", 4);
+    topLayerFile.close();
+
+
+    const auto commitGraphReader = CppGit::_details::CommitGraphReader{ repository->getCommonDirectoryPath() / "objects" };
+
+
+    EXPECT_FALSE(commitGraphReader.isValid());
+    EXPECT_EQ(commitGraphReader.getLayersCount(), 0);
+    EXPECT_FALSE(commitGraphReader.findCommit(commitsManager.getHeadCommitHash()).has_value());
+}
+
+TEST_F(CommitGraphTests, commitNotInCommitGraph)
+{
+    createHistoryWithMerges();
+    repository->executeGitCommand("commit-graph", "write", "--reachable");
+    const auto newCommitHash = repository->CommitsManager().createCommit("New commit");
+
+
+    const auto commitGraphReader = CppGit::_details::CommitGraphReader{ repository->getCommonDirectoryPath() / "objects" };
+
+
+    ASSERT_TRUE(commitGraphReader.isValid());
+    EXPECT_FALSE(commitGraphReader.findCommit(newCommitHash).has_value());
+}
@@ -138,6 +138,24 @@ TEST_F(CommitsLogTests, getlog_NoFilters)
     EXPECT_EQ(log[4].getParents(), std::vector<std::string>{});
 }
 
+TEST_F(CommitsLogTests, getlog_messageWithSeparators)
+{
+    const auto commitsManager = repository->CommitsManager();
+    const auto commitHash = commitsManager.createCommit("Commit;with;semicolons", "Description;with;semicolons\n\nSecond paragraph");
+
+
+    const auto commitsLogManager = repository->CommitsLogManager().setMaxCount(1);
+    const auto log = commitsLogManager.getCommitsLogDetailed();
+
+
+    ASSERT_EQ(log.size(), 1);
+    EXPECT_EQ(log[0].getHash(), commitHash);
+    EXPECT_EQ(log[0].getMessage(), "Commit;with;semicolons");
+    EXPECT_EQ(log[0].getDescription(), "Description;with;semicolons\n\nSecond paragraph");
+    EXPECT_EQ(log[0].getParents(), std::vector<std::string>{ commitsHashes[4] });
+    EXPECT_EQ(log[0].getTreeHash(), commitsManager.getCommitInfo(commitHash).getTreeHash());
+}
+
 TEST_F(CommitsLogTests, getlog_ToRef)
 {
     const auto commitsLogManager = repository->CommitsLogManager();
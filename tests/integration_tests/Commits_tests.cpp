@@ -5,9 +5,11 @@
 #include <CppGit/CommitsManager.hpp>
 #include <CppGit/DiffGenerator.hpp>
 #include <CppGit/IndexManager.hpp>
+#include <CppGit/ObjectId.hpp>
 #include <CppGit/_details/FileUtility.hpp>
 #include <filesystem>
 #include <gtest/gtest.h>
+#include <string>
 
 class CommitsTests : public BaseRepositoryFixture
 {
@@ -305,3 +307,68 @@ TEST_F(CommitsTests, amendCommit_withOneParent)
     checkCommitCommiterNotEqualTest(commitInfo);
     EXPECT_EQ(CppGit::_details::FileUtility::readFile(repositoryPath / ".git" / "ORIG_HEAD"), secondCommitHash);
 }
+
+TEST_F(CommitsTests, getCommitInfo_cached)
+{
+    const auto commitsManager = repository->CommitsManager();
+    const auto commitHash = commitsManager.createCommit("Initial commit", "Description");
+    auto& commitCache = repository->getCommitCache();
+    commitCache.clear();
+
+
+    const auto commitInfo = commitsManager.getCommitInfo(commitHash);
+    const auto cachedCommitInfo = commitsManager.getCommitInfo(commitHash);
+    const auto headCommitInfo = commitsManager.getCommitInfo("HEAD");
+
+
+    EXPECT_EQ(cachedCommitInfo.getHash(), commitHash);
+    EXPECT_EQ(cachedCommitInfo.getMessage(), "Initial commit");
+    EXPECT_EQ(cachedCommitInfo.getDescription(), "Description");
+    EXPECT_EQ(cachedCommitInfo.getTreeHash(), commitInfo.getTreeHash());
+    EXPECT_EQ(headCommitInfo.getHash(), commitHash);
+    const auto statistics = commitCache.getStatistics();
+    EXPECT_EQ(statistics.hits, 1);
+    EXPECT_EQ(statistics.misses, 1);
+    EXPECT_EQ(statistics.size, 1);
+}
+
+TEST_F(CommitsTests, getCommitInfo_cachedByLog)
+{
+    const auto commitsManager = repository->CommitsManager();
+    const auto commitHash = commitsManager.createCommit("Message\nin two lines", "Description");
+    auto& commitCache = repository->getCommitCache();
+    commitCache.clear();
+    const auto log = repository->CommitsLogManager().getCommitsLogDetailed();
+
+
+    const auto commitInfo = commitsManager.getCommitInfo(commitHash);
+
+
+    EXPECT_EQ(commitCache.getStatistics().hits, 1);
+    ASSERT_EQ(log.size(), 1);
+    EXPECT_EQ(log[0].getMessage(), "Message\nin two lines");
+    EXPECT_EQ(log[0].getDescription(), "Description");
+    EXPECT_EQ(commitInfo.getMessage(), "Message\nin two lines");
+    EXPECT_EQ(commitInfo.getDescription(), "Description");
+    EXPECT_EQ(commitInfo.getAuthorDate(), log[0].getAuthorDate());
+}
+
+TEST_F(CommitsTests, getCommitsLogDetailed_cachesOnlyNewestCommits)
+{
+    const auto commitsManager = repository->CommitsManager();
+    const auto oldestCommitHash = commitsManager.createCommit("Oldest commit");
+    for (auto i = 0; i < 64; ++i)
+    {
+        commitsManager.createCommit("Commit " + std::to_string(i));
+    }
+    auto& commitCache = repository->getCommitCache();
+    commitCache.clear();
+
+
+    const auto log = repository->CommitsLogManager().getCommitsLogDetailed();
+
+
+    ASSERT_EQ(log.size(), 65);
+    EXPECT_EQ(commitCache.getStatistics().size, 64);
+    EXPECT_FALSE(commitCache.get(CppGit::ObjectId::fromHex(oldestCommitHash)).has_value());
+}
@@ -0,0 +1,147 @@
+#include "BaseRepositoryFixture.hpp"
+
+#include <CppGit/GitConfigSnapshot.hpp>
+#include <CppGit/Repository.hpp>
+#include <CppGit/_details/FileUtility.hpp>
+#include <CppGit/_details/Parser/Parser.hpp>
+#include <gtest/gtest.h>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+class ConfigTests : public BaseRepositoryFixture
+{
+};
+
+TEST_F(ConfigTests, getConfig_sameAsGit)
+{
+    CppGit::_details::FileUtility::createOrAppendFile(repositoryPath / ".git" / "config",
+                                                      "\n[Remote \"Origin\"]\n"
+                                                      "\turl = https://example.com/repo.git ; comment\n"
+                                                      "\tfetch = +refs/heads/*:refs/remotes/origin/*\n"
+                                                      "[branch.Main]\n"
+                                                      "\tremote = \"origin\"\n"
+                                                      "[section]\n"
+                                                      "\timplicit\n"
+                                                      "\tmultiValued = first\n"
+                                                      "\tmultiValued = second\n");
+    const auto gitConfigOutput = repository->executeGitCommand("config", "--list", "--local").stdout;
+    const auto commandsCountBefore = repository->getCommandMetrics().getTotalCount();
+
+
+    const auto config = repository->getConfig();
+
+
+    auto expectedConfig = std::vector<CppGit::GitConfigEntry>{};
+    for (const auto& line : CppGit::Parser::splitToStringViewsVector(gitConfigOutput, '\n'))
+    {
+        const auto delimiterPos = line.find('=');
+        expectedConfig.emplace_back(std::string{ line.substr(0, delimiterPos) }, delimiterPos == std::string_view::npos ? "" : std::string{ line.substr(delimiterPos + 1) });
+    }
+    EXPECT_EQ(config, expectedConfig);
+    EXPECT_EQ(repository->getCommandMetrics().getTotalCount(), commandsCountBefore);
+}
+
+TEST_F(ConfigTests, getConfigSnapshot_includes)
+{
+    CppGit::_details::FileUtility::createOrOverwriteFile(repositoryPath / ".git" / "included.inc", "[user]\n\tname = Included\n[include]\n\tpath = nested.inc\n");
+    CppGit::_details::FileUtility::createOrOverwriteFile(repositoryPath / ".git" / "nested.inc", "[user]\n\temail = nested@email.com\n");
+    CppGit::_details::FileUtility::createOrOverwriteFile(repositoryPath / ".git" / "gitdir.inc", "[test]\n\tgitdir = matched\n");
+    CppGit::_details::FileUtility::createOrOverwriteFile(repositoryPath / ".git" / "branch.inc", "[test]\n\tbranch = matched\n");
+    CppGit::_details::FileUtility::createOrOverwriteFile(repositoryPath / ".git" / "other.inc", "[test]\n\tother = matched\n");
+    CppGit::_details::FileUtility::createOrAppendFile(repositoryPath / ".git" / "config",
+                                                      "\n[include]\n"
+                                                      "\tpath = included.inc\n"
+                                                      "\tpath = missing.inc\n"
+                                                      "[includeIf \"gitdir:integration-tests-repo/\"]\n"
+                                                      "\tpath = gitdir.inc\n"
+                                                      "[includeIf \"onbranch:main\"]\n"
+                                                      "\tpath = branch.inc\n"
+                                                      "[includeIf \"onbranch:other\"]\n"
+                                                      "\tpath = other.inc\n");
+
+
+    const auto snapshot = repository->getConfigSnapshot();
+    const auto localConfig = repository->getConfig();
+
+
+    const auto gitLocalConfigOutput = repository->executeGitCommand("config", "--list", "--local").stdout;
+    EXPECT_EQ(localConfig.size(), CppGit::Parser::splitToStringViewsVector(gitLocalConfigOutput, '\n').size());
+    for (const auto* const key : { "user.name", "user.email", "test.gitdir", "test.branch" })
+    {
+        EXPECT_EQ(snapshot->getString(key), repository->executeGitCommand("config", "--get", key).stdout) << key;
+    }
+    EXPECT_FALSE(snapshot->hasKey("test.other"));
+    EXPECT_EQ(repository->executeGitCommand("config", "--get", "test.other").return_code, 1);
+}
+
+TEST_F(ConfigTests, getConfigSnapshot_typedGetters)
+{
+    CppGit::_details::FileUtility::createOrAppendFile(repositoryPath / ".git" / "config",
+                                                      "\n[test]\n"
+                                                      "\timplicit\n"
+                                                      "\tyes = Yes\n"
+                                                      "\toff = off\n"
+                                                      "\tnumber = 2k\n"
+                                                      "\tnegative = -3\n"
+                                                      "\tinvalid = maybe\n"
+                                                      "\tvalue = first\n"
+                                                      "\tvalue = second\n");
+
+
+    const auto snapshot = repository->getConfigSnapshot();
+
+
+    EXPECT_EQ(snapshot->getBool("test.implicit"), true);
+    EXPECT_EQ(snapshot->getBool("Test.Yes"), true);
+    EXPECT_EQ(snapshot->getBool("test.off"), false);
+    EXPECT_EQ(snapshot->getBool("test.number"), true);
+    EXPECT_EQ(snapshot->getBool("core.bare"), false);
+    EXPECT_EQ(snapshot->getBool("test.notExisting"), std::nullopt);
+    EXPECT_EQ(snapshot->getInt("test.number"), 2048);
+    EXPECT_EQ(snapshot->getInt("test.negative"), -3);
+    EXPECT_THROW(static_cast<void>(snapshot->getBool("test.invalid")), std::runtime_error);
+    EXPECT_THROW(static_cast<void>(snapshot->getInt("test.invalid")), std::runtime_error);
+    EXPECT_EQ(snapshot->getString("test.value"), "second");
+    EXPECT_EQ(snapshot->getAll("test.value"), (std::vector<std::string>{ "first", "second" }));
+    EXPECT_EQ(snapshot->getString("test.implicit"), "");
+}
+
+TEST_F(ConfigTests, getConfigSnapshot_worktreeConfigEnabledIgnoringCase)
+{
+    CppGit::_details::FileUtility::createOrAppendFile(repositoryPath / ".git" / "config", "\n[extensions]\n\tworktreeConfig = True\n");
+    CppGit::_details::FileUtility::createOrOverwriteFile(repositoryPath / ".git" / "config.worktree", "[test]\n\tworktree = value\n");
+
+
+    const auto snapshot = repository->getConfigSnapshot();
+
+
+    EXPECT_EQ(snapshot->getString("test.worktree"), "value");
+    EXPECT_EQ(snapshot->getString("test.worktree"), repository->executeGitCommand("config", "--get", "test.worktree").stdout);
+}
+
+TEST_F(ConfigTests, getConfigSnapshot_reloadedAfterChange)
+{
+    const auto snapshot = repository->getConfigSnapshot();
+    const auto sameSnapshot = repository->getConfigSnapshot();
+
+    repository->executeGitCommand("config", "user.name", "Changed Name");
+    const auto changedSnapshot = repository->getConfigSnapshot();
+
+
+    EXPECT_EQ(snapshot, sameSnapshot);
+    EXPECT_NE(snapshot, changedSnapshot);
+    EXPECT_FALSE(snapshot->hasKey("user.name") && snapshot->getString("user.name") == "Changed Name");
+    EXPECT_EQ(changedSnapshot->getString("user.name"), "Changed Name");
+    EXPECT_TRUE(changedSnapshot->isUpToDate());
+    EXPECT_FALSE(snapshot->isUpToDate());
+}
+
+TEST_F(ConfigTests, getConfig_invalidConfigFallsBackToGit)
+{
+    CppGit::_details::FileUtility::createOrAppendFile(repositoryPath / ".git" / "config", "\n[section\n");
+
+
+    EXPECT_THROW(static_cast<void>(repository->getConfigSnapshot()), std::runtime_error);
+    EXPECT_TRUE(repository->getConfig().empty());
+}
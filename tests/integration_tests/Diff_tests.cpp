@@ -3,9 +3,15 @@
 #include <CppGit/CommitsManager.hpp>
 #include <CppGit/DiffGenerator.hpp>
 #include <CppGit/IndexManager.hpp>
+#include <CppGit/Repository.hpp>
 #include <CppGit/_details/FileUtility.hpp>
 #include <filesystem>
 #include <gtest/gtest.h>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
 
 class DiffTests : public BaseRepositoryFixture
 { };
@@ -422,6 +428,38 @@ TEST_F(DiffTests, diffBetweenTwoCommits)
     ASSERT_EQ(test2DiffFile->hunkContent.size(), 0);
 }
 
+TEST_F(DiffTests, diffBetweenTwoCommitsFileByFile)
+{
+    const auto diffGenerator = repository->DiffGenerator();
+    const auto commitsManager = repository->CommitsManager();
+    const auto indexManager = repository->IndexManager();
+
+
+    CppGit::_details::FileUtility::createOrOverwriteFile(repositoryPath / "test1.txt", "");
+    indexManager.add("test1.txt");
+    const auto initialCommitHash = commitsManager.createCommit("Initial commit");
+
+    CppGit::_details::FileUtility::createOrOverwriteFile(repositoryPath / "test1.txt", "Hello, World!\n");
+    CppGit::_details::FileUtility::createOrOverwriteFile(repositoryPath / "test2.txt", "Hello, World!\n");
+    indexManager.add("test1.txt");
+    indexManager.add("test2.txt");
+    const auto secondCommitHash = commitsManager.createCommit("Second commit");
+
+
+    auto diffFiles = std::vector<CppGit::DiffFile>{};
+    diffGenerator.getDiff(initialCommitHash, secondCommitHash, [&diffFiles](CppGit::DiffFile&& diffFile) { diffFiles.push_back(std::move(diffFile)); });
+
+
+    ASSERT_EQ(diffFiles.size(), 2);
+    EXPECT_EQ(diffFiles[0].diffStatus, CppGit::DiffStatus::MODDIFIED);
+    EXPECT_EQ(diffFiles[0].fileB, "test1.txt");
+    const auto expectedContent = std::vector<std::string>{ "+Hello, World!" };
+    EXPECT_EQ(diffFiles[0].hunkContent, expectedContent);
+    EXPECT_EQ(diffFiles[1].diffStatus, CppGit::DiffStatus::NEW);
+    EXPECT_EQ(diffFiles[1].fileB, "test2.txt");
+    EXPECT_EQ(diffFiles[1].hunkContent, expectedContent);
+}
+
 TEST_F(DiffTests, diffBetweenTwoCommitsGivenFile)
 {
     const auto diffGenerator = repository->DiffGenerator();
@@ -453,3 +491,199 @@ TEST_F(DiffTests, diffBetweenTwoCommitsGivenFile)
     ASSERT_EQ(diffFile.hunkRangesBefore.size(), 0);
     ASSERT_EQ(diffFile.hunkContent.size(), 0);
 }
+
+TEST_F(DiffTests, blobsDiff_sameAsGitDiff)
+{
+    const auto diffGenerator = repository->DiffGenerator();
+    const auto commitsManager = repository->CommitsManager();
+    const auto indexManager = repository->IndexManager();
+
+
+    auto oldContent = std::string{};
+    for (auto i = 1; i <= 30; ++i)
+    {
+        oldContent += (i % 5 == 0 ? "Function " : "    line ") + std::to_string(i) + "\n";
+    }
+    auto newContent = oldContent;
+    newContent.replace(newContent.find("line 2\n"), 7, "line 2 changed\n");
+    newContent.replace(newContent.find("line 17\n"), 8, "line 17 changed\n    added line\n");
+    newContent.erase(newContent.find("    line 29\n"), 12);
+
+    CppGit::_details::FileUtility::createOrOverwriteFile(repositoryPath / "file.txt", oldContent);
+    indexManager.add("file.txt");
+    commitsManager.createCommit("Initial commit");
+    CppGit::_details::FileUtility::createOrOverwriteFile(repositoryPath / "file.txt", newContent);
+    indexManager.add("file.txt");
+    commitsManager.createCommit("Second commit");
+
+    const auto oldBlobHash = repository->executeGitCommand("rev-parse", "HEAD~1:file.txt").stdout;
+    const auto newBlobHash = repository->executeGitCommand("rev-parse", "HEAD:file.txt").stdout;
+    const auto gitDiffFiles = diffGenerator.getDiff();
+
+
+    const auto diffFiles = diffGenerator.getBlobsDiff(oldBlobHash, newBlobHash);
+
+
+    ASSERT_EQ(gitDiffFiles.size(), 1);
+    ASSERT_EQ(diffFiles.size(), 1);
+    const auto& diffFile = diffFiles[0];
+    EXPECT_EQ(diffFile.diffStatus, CppGit::DiffStatus::MODDIFIED);
+    EXPECT_EQ(diffFile.fileA, oldBlobHash);
+    EXPECT_EQ(diffFile.fileB, newBlobHash);
+    ASSERT_EQ(diffFile.indicesBefore.size(), 1);
+    EXPECT_EQ(diffFile.indicesBefore[0], oldBlobHash);
+    EXPECT_EQ(diffFile.indexAfter, newBlobHash);
+    EXPECT_EQ(diffFile.hunkRangesBefore, gitDiffFiles[0].hunkRangesBefore);
+    EXPECT_EQ(diffFile.hunkRangeAfter, gitDiffFiles[0].hunkRangeAfter);
+    EXPECT_EQ(diffFile.hunkContent, gitDiffFiles[0].hunkContent);
+}
+
+TEST_F(DiffTests, blobsDiff_sameBlobs)
+{
+    const auto diffGenerator = repository->DiffGenerator();
+    const auto commitsManager = repository->CommitsManager();
+    const auto indexManager = repository->IndexManager();
+
+
+    CppGit::_details::FileUtility::createOrOverwriteFile(repositoryPath / "file.txt", "Hello, World!\n");
+    indexManager.add("file.txt");
+    commitsManager.createCommit("Initial commit");
+    const auto blobHash = repository->executeGitCommand("rev-parse", "HEAD:file.txt").stdout;
+
+
+    const auto diffFiles = diffGenerator.getBlobsDiff(blobHash, blobHash);
+
+
+    EXPECT_TRUE(diffFiles.empty());
+}
+
+TEST_F(DiffTests, blobsDiff_notBlob)
+{
+    const auto diffGenerator = repository->DiffGenerator();
+    const auto commitsManager = repository->CommitsManager();
+
+
+    const auto commitHash = commitsManager.createCommit("Initial commit");
+
+
+    EXPECT_THROW(static_cast<void>(diffGenerator.getBlobsDiff(commitHash, commitHash)), std::runtime_error);
+}
+
+TEST_F(DiffTests, contentsDiff)
+{
+    const auto diffGenerator = repository->DiffGenerator();
+
+
+    const auto diffFiles = diffGenerator.getContentsDiff("Line 1\nLine 2\nLine 3\n", "Line 1\nLine 2 changed\nLine 3\nLine 4");
+
+
+    ASSERT_EQ(diffFiles.size(), 1);
+    const auto& diffFile = diffFiles[0];
+    EXPECT_EQ(diffFile.diffStatus, CppGit::DiffStatus::MODDIFIED);
+    ASSERT_EQ(diffFile.hunkRangesBefore.size(), 1);
+    EXPECT_EQ(diffFile.hunkRangesBefore[0], std::make_pair(1, 3));
+    EXPECT_EQ(diffFile.hunkRangeAfter, std::make_pair(1, 4));
+    const auto expectedContent = std::vector<std::string>{ " Line 1", "-Line 2", "+Line 2 changed", " Line 3", "+Line 4", "\\ No newline at end of file" };
+    EXPECT_EQ(diffFile.hunkContent, expectedContent);
+}
+
+TEST_F(DiffTests, contentsDiff_binary)
+{
+    const auto diffGenerator = repository->DiffGenerator();
+
+
+    const auto diffFiles = diffGenerator.getContentsDiff(std::string_view{ "Binary\0content", 14 }, "Text content\n");
+
+
+    ASSERT_EQ(diffFiles.size(), 1);
+    EXPECT_EQ(diffFiles[0].diffStatus, CppGit::DiffStatus::BINARY_CHANGED);
+    EXPECT_TRUE(diffFiles[0].hunkContent.empty());
+}
+
+TEST_F(DiffTests, contentsDiff_algorithms)
+{
+    const auto diffGenerator = repository->DiffGenerator();
+    const auto oldContent = "{\n\n{\n\n}\nbar();\nfoo();\n\n";
+    const auto newContent = "{\n\n\n{\n{\n\n\n}\nbar();\nfoo();\n\n";
+
+
+    const auto myersDiffFiles = diffGenerator.getContentsDiff(oldContent, newContent, CppGit::DiffAlgorithm::MYERS);
+    const auto patienceDiffFiles = diffGenerator.getContentsDiff(oldContent, newContent, CppGit::DiffAlgorithm::PATIENCE);
+    const auto histogramDiffFiles = diffGenerator.getContentsDiff(oldContent, newContent, CppGit::DiffAlgorithm::HISTOGRAM);
+
+
+    ASSERT_EQ(myersDiffFiles.size(), 1);
+    ASSERT_EQ(patienceDiffFiles.size(), 1);
+    ASSERT_EQ(histogramDiffFiles.size(), 1);
+    const auto expectedMyersContent = std::vector<std::string>{ " {", " ", "+", "+{", " {", " ", "+", " }", " bar();", " foo();" };
+    const auto expectedPatienceContent = std::vector<std::string>{ " {", " ", "+", " {", "+{", "+", " ", " }", " bar();" };
+    EXPECT_EQ(myersDiffFiles[0].hunkContent, expectedMyersContent);
+    EXPECT_EQ(patienceDiffFiles[0].hunkContent, expectedPatienceContent);
+    EXPECT_EQ(histogramDiffFiles[0].hunkContent, expectedPatienceContent);
+}
+
+TEST_F(DiffTests, blobWorktreeFileDiff)
+{
+    const auto diffGenerator = repository->DiffGenerator();
+    const auto commitsManager = repository->CommitsManager();
+    const auto indexManager = repository->IndexManager();
+
+
+    CppGit::_details::FileUtility::createOrOverwriteFile(repositoryPath / "file.txt", "Hello, World!\n");
+    indexManager.add("file.txt");
+    commitsManager.createCommit("Initial commit");
+    const auto blobHash = repository->executeGitCommand("rev-parse", "HEAD:file.txt").stdout;
+    CppGit::_details::FileUtility::createOrOverwriteFile(repositoryPath / "file.txt", "Hello, World! Modified\n");
+
+
+    const auto diffFiles = diffGenerator.getBlobWorktreeFileDiff(blobHash, "file.txt");
+
+
+    ASSERT_EQ(diffFiles.size(), 1);
+    const auto& diffFile = diffFiles[0];
+    EXPECT_EQ(diffFile.diffStatus, CppGit::DiffStatus::MODDIFIED);
+    EXPECT_EQ(diffFile.fileA, "file.txt");
+    EXPECT_EQ(diffFile.fileB, "file.txt");
+    EXPECT_EQ(diffFile.hunkRangesBefore[0], std::make_pair(1, -1));
+    EXPECT_EQ(diffFile.hunkRangeAfter, std::make_pair(1, -1));
+    const auto expectedContent = std::vector<std::string>{ "-Hello, World!", "+Hello, World! Modified" };
+    EXPECT_EQ(diffFile.hunkContent, expectedContent);
+}
+
+TEST_F(DiffTests, blobWorktreeFileDiff_fileDeleted)
+{
+    const auto diffGenerator = repository->DiffGenerator();
+    const auto commitsManager = repository->CommitsManager();
+    const auto indexManager = repository->IndexManager();
+
+
+    CppGit::_details::FileUtility::createOrOverwriteFile(repositoryPath / "file.txt", "Hello, World!\n");
+    indexManager.add("file.txt");
+    commitsManager.createCommit("Initial commit");
+    const auto blobHash = repository->executeGitCommand("rev-parse", "HEAD:file.txt").stdout;
+    std::filesystem::remove(repositoryPath / "file.txt");
+
+
+    const auto diffFiles = diffGenerator.getBlobWorktreeFileDiff(blobHash, "file.txt");
+
+
+    ASSERT_EQ(diffFiles.size(), 1);
+    const auto& diffFile = diffFiles[0];
+    EXPECT_EQ(diffFile.diffStatus, CppGit::DiffStatus::DELETED);
+    EXPECT_EQ(diffFile.fileB, "/dev/null");
+    EXPECT_EQ(diffFile.hunkRangesBefore[0], std::make_pair(1, -1));
+    EXPECT_EQ(diffFile.hunkRangeAfter, std::make_pair(0, 0));
+    const auto expectedContent = std::vector<std::string>{ "-Hello, World!" };
+    EXPECT_EQ(diffFile.hunkContent, expectedContent);
+}
+
+TEST_F(DiffTests, blobWorktreeFileDiff_bareRepository)
+{
+    const auto bareRepository = CppGit::Repository{ repositoryPath / "bare.git" };
+    bareRepository.initRepository(true);
+    const auto diffGenerator = bareRepository.DiffGenerator();
+    const auto emptyBlobHash = std::string_view{ "e69de29bb2d1d6434b8b29ae775ad8c2e48c5391" };
+
+
+    EXPECT_THROW(static_cast<void>(diffGenerator.getBlobWorktreeFileDiff(emptyBlobHash, "file.txt")), std::runtime_error);
+}
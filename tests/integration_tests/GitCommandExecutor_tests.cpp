@@ -0,0 +1,257 @@
+#include "BaseRepositoryFixture.hpp"
+
+#include <CppGit/CommitsLogManager.hpp>
+#include <CppGit/CommitsManager.hpp>
+#include <CppGit/IndexManager.hpp>
+#include <CppGit/Repository.hpp>
+#include <CppGit/_details/FileUtility.hpp>
+#include <CppGit/_details/GitCommandExecutor/GitCommandExecutorMeasuring.hpp>
+#include <CppGit/_details/GitCommandExecutor/GitCommandExecutorRecording.hpp>
+#include <CppGit/_details/GitCommandExecutor/GitCommandExecutorReplay.hpp>
+#include <CppGit/_details/GitCommandExecutor/GitCommandExecutorUnix.hpp>
+#include <CppGit/_details/GitCommandExecutor/GitCommandMetrics.hpp>
+#include <algorithm>
+#include <filesystem>
+#include <gtest/gtest.h>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+class GitCommandExecutorTests : public BaseRepositoryFixture
+{
+};
+
+TEST_F(GitCommandExecutorTests, outputBiggerThanPipeCapacity)
+{
+    const auto commitsManager = repository->CommitsManager();
+    const auto indexManager = repository->IndexManager();
+
+    // Much more than default 64KiB pipe capacity
+    auto content = std::string{};
+    for (auto i = 0; i < 100'000; ++i)
+    {
+        content += "Line number " + std::to_string(i) + "\n";
+    }
+    CppGit::_details::FileUtility::createOrOverwriteFile(repositoryPath / "file.txt", content);
+    indexManager.add("file.txt");
+    commitsManager.createCommit("Initial commit");
+
+
+    const auto output = repository->executeGitCommand("cat-file", "-p", "HEAD:file.txt");
+
+
+    ASSERT_EQ(output.return_code, 0);
+    content.pop_back();
+    EXPECT_EQ(output.stdout, content);
+    EXPECT_EQ(output.stderr, "");
+}
+
+TEST_F(GitCommandExecutorTests, stdoutAndStderrTogether)
+{
+    const auto output = repository->executeGitCommand("cat-file", "-p", "HEAD");
+
+
+    EXPECT_NE(output.return_code, 0);
+    EXPECT_EQ(output.stdout, "");
+    EXPECT_NE(output.stderr, "");
+}
+
+TEST_F(GitCommandExecutorTests, manyCommandsDontLeakDescriptors)
+{
+    for (auto i = 0; i < 2'000; ++i)
+    {
+        const auto output = repository->executeGitCommand("rev-parse", "--git-dir");
+        ASSERT_EQ(output.return_code, 0);
+    }
+}
+
+TEST_F(GitCommandExecutorTests, forkAndPosixSpawnGiveSameOutput)
+{
+    auto spawnExecutor = CppGit::GitCommandExecutorUnix{ CppGit::GitCommandExecutorUnix::LaunchMethod::PosixSpawn };
+    auto forkExecutor = CppGit::GitCommandExecutorUnix{ CppGit::GitCommandExecutorUnix::LaunchMethod::Fork };
+    const auto environment = std::vector<std::string>{ "GIT_AUTHOR_NAME=TestName" };
+
+
+    const auto spawnOutput = spawnExecutor.execute(environment, repositoryPath.string(), "var", "GIT_AUTHOR_IDENT");
+    const auto forkOutput = forkExecutor.execute(environment, repositoryPath.string(), "var", "GIT_AUTHOR_IDENT");
+
+
+    ASSERT_EQ(spawnOutput.return_code, 0);
+    EXPECT_TRUE(spawnOutput.stdout.starts_with("TestName "));
+    EXPECT_EQ(spawnOutput.return_code, forkOutput.return_code);
+    EXPECT_EQ(spawnOutput.stdout.substr(0, spawnOutput.stdout.find('>')), forkOutput.stdout.substr(0, forkOutput.stdout.find('>')));
+    EXPECT_EQ(spawnOutput.stderr, forkOutput.stderr);
+}
+
+TEST_F(GitCommandExecutorTests, recordAndReplay)
+{
+    CppGit::_details::FileUtility::createOrOverwriteFile(repositoryPath / "file.txt", "Hello, World!");
+    repository->IndexManager().add("file.txt");
+    repository->CommitsManager().createCommit("Initial commit");
+
+    auto recordingExecutor = std::make_shared<CppGit::GitCommandExecutorRecording>(std::make_shared<CppGit::GitCommandExecutorUnix>());
+    const auto recordingRepository = CppGit::Repository{ repositoryPath, recordingExecutor };
+    const auto recordedFiles = recordingRepository.IndexManager().getFilesInIndexList();
+    const auto recordedLog = recordingRepository.CommitsLogManager().getCommitsLogDetailed();
+
+    // Replay must not depend on the repository at all
+    std::filesystem::remove_all(repositoryPath / "file.txt");
+    auto replayExecutor = std::make_shared<CppGit::GitCommandExecutorReplay>(recordingExecutor->getRecords());
+    const auto replayRepository = CppGit::Repository{ repositoryPath, replayExecutor };
+
+
+    const auto replayedFiles = replayRepository.IndexManager().getFilesInIndexList();
+    const auto replayedLog = replayRepository.CommitsLogManager().getCommitsLogDetailed();
+
+
+    EXPECT_TRUE(replayExecutor->isFinished());
+    EXPECT_EQ(replayedFiles, recordedFiles);
+    ASSERT_EQ(replayedLog.size(), 1);
+    EXPECT_EQ(replayedLog[0].getHash(), recordedLog[0].getHash());
+    EXPECT_EQ(replayedLog[0].getMessage(), "Initial commit");
+}
+
+TEST_F(GitCommandExecutorTests, recordAndReplaySession)
+{
+    CppGit::_details::FileUtility::createOrOverwriteFile(repositoryPath / "file.txt", "Hello, World!");
+    repository->IndexManager().add("file.txt");
+    repository->CommitsManager().createCommit("Initial commit");
+
+    auto recordingExecutor = std::make_shared<CppGit::GitCommandExecutorRecording>(std::make_shared<CppGit::GitCommandExecutorUnix>());
+    const auto recordingRepository = CppGit::Repository{ repositoryPath, recordingExecutor };
+    const auto recordedBlob = recordingRepository.readObject("HEAD:file.txt");
+    const auto recordedFiles = recordingRepository.IndexManager().getFilesInIndexList();
+
+    std::filesystem::remove_all(repositoryPath / "file.txt");
+    auto replayExecutor = std::make_shared<CppGit::GitCommandExecutorReplay>(recordingExecutor->getRecords());
+    const auto replayRepository = CppGit::Repository{ repositoryPath, replayExecutor };
+
+
+    const auto replayedBlob = replayRepository.readObject("HEAD:file.txt");
+    const auto replayedFiles = replayRepository.IndexManager().getFilesInIndexList();
+
+
+    EXPECT_TRUE(replayExecutor->isFinished());
+    ASSERT_TRUE(recordedBlob.has_value());
+    ASSERT_TRUE(replayedBlob.has_value());
+    EXPECT_EQ(replayedBlob->content, "Hello, World!");
+    EXPECT_EQ(replayedBlob->hash, recordedBlob->hash);
+    EXPECT_EQ(replayedFiles, recordedFiles);
+
+    const auto records = recordingExecutor->getRecords();
+    ASSERT_FALSE(records.empty());
+    EXPECT_EQ(records[0].command, "cat-file");
+    EXPECT_EQ(records[0].input, "HEAD:file.txt\n");
+}
+
+TEST_F(GitCommandExecutorTests, replayDifferentCommand)
+{
+    auto replayExecutor = CppGit::GitCommandExecutorReplay{ { CppGit::GitCommandRecord{ .environmentVariables = {}, .command = "rev-parse", .args = { "HEAD" }, .output = { .return_code = 0, .stdout = "hash", .stderr = "" } } } };
+
+
+    EXPECT_THROW(replayExecutor.execute(std::vector<std::string>{}, repositoryPath.string(), "rev-parse", "--git-dir"), std::runtime_error);
+    EXPECT_EQ(replayExecutor.execute(std::vector<std::string>{}, repositoryPath.string(), "rev-parse", "HEAD").stdout, "hash");
+    EXPECT_THROW(replayExecutor.execute(std::vector<std::string>{}, repositoryPath.string(), "rev-parse", "HEAD"), std::runtime_error);
+}
+
+TEST_F(GitCommandExecutorTests, commandMetrics)
+{
+    auto& metrics = repository->getCommandMetrics();
+    metrics.reset();
+    auto observedCommands = std::vector<std::string>{};
+    metrics.setObserver([&observedCommands](const CppGit::GitCommandMetric& metric) { observedCommands.emplace_back(metric.command); });
+
+
+    repository->executeGitCommand("rev-parse", "--git-dir");
+    repository->executeGitCommand("rev-parse", "--show-toplevel");
+    repository->executeGitCommand("cat-file", "-p", "HEAD");
+
+
+    EXPECT_EQ(metrics.getTotalCount(), 3);
+    EXPECT_EQ(observedCommands, (std::vector<std::string>{ "rev-parse", "rev-parse", "cat-file" }));
+
+    const auto revParseStatistics = metrics.getStatistics("rev-parse");
+    ASSERT_TRUE(revParseStatistics.has_value());
+    EXPECT_EQ(revParseStatistics->count, 2);
+    EXPECT_EQ(revParseStatistics->failedCount, 0);
+    EXPECT_EQ(revParseStatistics->argumentsCount, 2);
+    EXPECT_GT(revParseStatistics->stdoutBytes, 0);
+    EXPECT_GT(revParseStatistics->totalWallTime.count(), 0);
+    EXPECT_LE(revParseStatistics->minWallTime, revParseStatistics->maxWallTime);
+
+    const auto catFileStatistics = metrics.getStatistics("cat-file");
+    ASSERT_TRUE(catFileStatistics.has_value());
+    EXPECT_EQ(catFileStatistics->failedCount, 1);
+    EXPECT_GT(catFileStatistics->stderrBytes, 0);
+
+    EXPECT_FALSE(metrics.getStatistics("log").has_value());
+    EXPECT_TRUE(metrics.exportCsv().contains("\nrev-parse,2,0,2,"));
+}
+
+TEST_F(GitCommandExecutorTests, sessionMetrics)
+{
+    repository->CommitsManager().createCommit("Initial commit");
+    const auto metrics = std::make_shared<CppGit::GitCommandMetrics>();
+    auto measuringExecutor = CppGit::GitCommandExecutorMeasuring{ std::make_shared<CppGit::GitCommandExecutorUnix>(), metrics };
+
+
+    auto session = measuringExecutor.startSession(std::vector<std::string>{}, repositoryPath.string(), "cat-file", "--batch-check");
+    const auto written = session->write("HEAD\nHEAD\n");
+    auto output = std::string{};
+    while (std::ranges::count(output, '\n') < 2 && session->read(output))
+    {
+    }
+    const auto metricsCountBeforeClose = metrics->getTotalCount();
+    const auto returnCode = session->close();
+
+
+    EXPECT_TRUE(written);
+    EXPECT_EQ(std::ranges::count(output, '\n'), 2);
+    EXPECT_TRUE(output.contains(" commit "));
+    EXPECT_EQ(returnCode, 0);
+    EXPECT_EQ(metricsCountBeforeClose, 0);
+
+    const auto catFileStatistics = metrics->getStatistics("cat-file");
+    ASSERT_TRUE(catFileStatistics.has_value());
+    EXPECT_EQ(catFileStatistics->count, 1);
+    EXPECT_EQ(catFileStatistics->stdoutBytes, output.size());
+}
+
+TEST_F(GitCommandExecutorTests, inputPassedToStdin)
+{
+    const auto output = repository->executeGitCommandWithInput("Hello, World!\n", "hash-object", "--stdin");
+
+
+    ASSERT_EQ(output.return_code, 0);
+    EXPECT_EQ(output.stdout, "8ab686eafeb1f44702738c8b0f24f2567c36da6d");
+}
+
+TEST_F(GitCommandExecutorTests, inputBiggerThanPipeCapacity)
+{
+    auto input = std::string{};
+    for (auto i = 0; i < 100'000; ++i)
+    {
+        input += "Line number " + std::to_string(i) + "\n";
+    }
+
+
+    const auto output = repository->executeGitCommandWithInput(input, "stripspace");
+
+
+    ASSERT_EQ(output.return_code, 0);
+    input.pop_back();
+    EXPECT_EQ(output.stdout, input);
+}
+
+TEST_F(GitCommandExecutorTests, inputNotReadByCommand)
+{
+    const auto input = std::string(1024 * 1024, 'a');
+
+
+    const auto output = repository->executeGitCommandWithInput(input, "rev-parse", "--git-dir");
+
+
+    EXPECT_EQ(output.return_code, 0);
+    EXPECT_EQ(output.stdout, ".git");
+}
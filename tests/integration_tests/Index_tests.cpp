@@ -2,8 +2,10 @@
 
 #include <CppGit/CommitsManager.hpp>
 #include <CppGit/IndexManager.hpp>
+#include <CppGit/Repository.hpp>
 #include <CppGit/_details/FileUtility.hpp>
 #include <gtest/gtest.h>
+#include <string>
 #include <vector>
 
 class IndexTests : public BaseRepositoryFixture
@@ -504,6 +506,50 @@ TEST_F(IndexTests, restoreAllStaged_multipleFile_notAllStaged)
     EXPECT_EQ(stagedFiles.size(), 0);
 }
 
+TEST_F(IndexTests, restoreAllStaged_specialCharactersInPath)
+{
+    const auto indexManager = repository->IndexManager();
+    const auto commitsManager = repository->CommitsManager();
+
+
+    CppGit::_details::FileUtility::createOrOverwriteFile(repositoryPath / "file with spaces.txt", "Hello, World!");
+    indexManager.add("file with spaces.txt");
+    commitsManager.createCommit("Initial commit");
+    CppGit::_details::FileUtility::createOrOverwriteFile(repositoryPath / "file with spaces.txt", "Changed");
+    CppGit::_details::FileUtility::createOrOverwriteFile(repositoryPath / "zażółć.txt", "Hello, World!");
+    indexManager.add("*");
+    auto stagedFiles = indexManager.getStagedFilesList();
+    ASSERT_EQ(stagedFiles.size(), 2);
+
+    indexManager.restoreAllStaged();
+
+
+    stagedFiles = indexManager.getStagedFilesList();
+    EXPECT_EQ(stagedFiles.size(), 0);
+    const auto indexFiles = indexManager.getFilesInIndexList();
+    ASSERT_EQ(indexFiles.size(), 1);
+    EXPECT_EQ(indexFiles[0], "file with spaces.txt");
+}
+
+TEST_F(IndexTests, addAndRemoveManyFiles)
+{
+    const auto indexManager = repository->IndexManager();
+
+    constexpr auto FILES_COUNT = 5'000;
+    for (auto i = 0; i < FILES_COUNT; ++i)
+    {
+        CppGit::_details::FileUtility::createOrOverwriteFile(repositoryPath / ("file" + std::to_string(i) + ".txt"), "");
+    }
+
+
+    indexManager.add(".");
+    EXPECT_EQ(indexManager.getFilesInIndexList().size(), FILES_COUNT);
+    indexManager.remove(".", true);
+
+
+    EXPECT_EQ(indexManager.getFilesInIndexList().size(), 0);
+}
+
 TEST_F(IndexTests, notDirty)
 {
     const auto indexManager = repository->IndexManager();
@@ -1150,3 +1196,91 @@ TEST_F(IndexTests, getStagedFiles_noCommits_pattern)
     ASSERT_EQ(stagedFiles.size(), 1);
     EXPECT_EQ(stagedFiles[0], "file2.txt");
 }
+
+TEST_F(IndexTests, getFilesInIndexList_pattern)
+{
+    const auto indexManager = repository->IndexManager();
+
+
+    std::filesystem::create_directories(repositoryPath / "dir" / "subdir");
+    CppGit::_details::FileUtility::createOrOverwriteFile(repositoryPath / "file.txt", "");
+    CppGit::_details::FileUtility::createOrOverwriteFile(repositoryPath / "dir.txt", "");
+    CppGit::_details::FileUtility::createOrOverwriteFile(repositoryPath / "dir" / "file.txt", "");
+    CppGit::_details::FileUtility::createOrOverwriteFile(repositoryPath / "dir" / "subdir" / "file.cpp", "");
+    indexManager.add("");
+
+
+    EXPECT_EQ(indexManager.getFilesInIndexList(), (std::vector<std::string>{ "dir.txt", "dir/file.txt", "dir/subdir/file.cpp", "file.txt" }));
+    EXPECT_EQ(indexManager.getFilesInIndexList("dir"), (std::vector<std::string>{ "dir/file.txt", "dir/subdir/file.cpp" }));
+    EXPECT_EQ(indexManager.getFilesInIndexList("dir/"), (std::vector<std::string>{ "dir/file.txt", "dir/subdir/file.cpp" }));
+    EXPECT_EQ(indexManager.getFilesInIndexList("*.txt"), (std::vector<std::string>{ "dir.txt", "dir/file.txt", "file.txt" }));
+    EXPECT_EQ(indexManager.getFilesInIndexList("dir/*.cpp"), (std::vector<std::string>{ "dir/subdir/file.cpp" }));
+    EXPECT_EQ(indexManager.getFilesInIndexList(":(glob)dir/*.cpp"), (std::vector<std::string>{}));
+}
+
+TEST_F(IndexTests, getFilesInIndexList_repositoryOpenedInSubdirectory)
+{
+    const auto indexManager = repository->IndexManager();
+    std::filesystem::create_directories(repositoryPath / "sub");
+    CppGit::_details::FileUtility::createOrOverwriteFile(repositoryPath / "top.txt", "");
+    CppGit::_details::FileUtility::createOrOverwriteFile(repositoryPath / "sub" / "x.txt", "");
+    indexManager.add("");
+
+
+    const auto subdirectoryRepository = CppGit::Repository{ repositoryPath / "sub" };
+    const auto indexFiles = subdirectoryRepository.IndexManager().getFilesInIndexList();
+
+
+    EXPECT_EQ(indexFiles, (std::vector<std::string>{ "x.txt" }));
+}
+
+TEST_F(IndexTests, getFilesInIndexDetailedList_indexVersion4)
+{
+    const auto indexManager = repository->IndexManager();
+
+
+    std::filesystem::create_directories(repositoryPath / "dir" / "subdir");
+    CppGit::_details::FileUtility::createOrOverwriteFile(repositoryPath / "file.txt", "Hello, World!");
+    CppGit::_details::FileUtility::createOrOverwriteFile(repositoryPath / "dir" / "file.txt", "Hello");
+    CppGit::_details::FileUtility::createOrOverwriteFile(repositoryPath / "dir" / "file2.txt", "World");
+    CppGit::_details::FileUtility::createOrOverwriteFile(repositoryPath / "dir" / "subdir" / "file.txt", "");
+    indexManager.add("");
+    const auto indexFilesVersion2 = indexManager.getFilesInIndexDetailedList();
+    repository->executeGitCommand("update-index", "--index-version", "4");
+    const auto commandsCountBefore = repository->getCommandMetrics().getTotalCount();
+    const auto indexFilesVersion4 = indexManager.getFilesInIndexDetailedList();
+
+
+    EXPECT_EQ(repository->getCommandMetrics().getTotalCount(), commandsCountBefore);
+    ASSERT_EQ(indexFilesVersion4.size(), 4);
+    ASSERT_EQ(indexFilesVersion2.size(), indexFilesVersion4.size());
+    for (auto i = std::size_t{ 0 }; i < indexFilesVersion4.size(); ++i)
+    {
+        EXPECT_EQ(indexFilesVersion4[i].fileMode, indexFilesVersion2[i].fileMode);
+        EXPECT_EQ(indexFilesVersion4[i].stageNumber, indexFilesVersion2[i].stageNumber);
+        EXPECT_EQ(indexFilesVersion4[i].objectHash, indexFilesVersion2[i].objectHash);
+        EXPECT_EQ(indexFilesVersion4[i].path, indexFilesVersion2[i].path);
+    }
+    EXPECT_EQ(indexFilesVersion4[0].path, "dir/file.txt");
+    EXPECT_EQ(indexFilesVersion4[1].path, "dir/file2.txt");
+    EXPECT_EQ(indexFilesVersion4[2].path, "dir/subdir/file.txt");
+    EXPECT_EQ(indexFilesVersion4[3].path, "file.txt");
+    EXPECT_EQ(indexFilesVersion4[3].fileMode, 100'644);
+    EXPECT_EQ(indexFilesVersion4[3].objectHash, "b45ef6fec89518d314f546fd6c3025367b721684");
+}
+
+TEST_F(IndexTests, getFilesInIndexDetailedList_intentToAdd)
+{
+    const auto indexManager = repository->IndexManager();
+
+
+    CppGit::_details::FileUtility::createOrOverwriteFile(repositoryPath / "file.txt", "Hello, World!");
+    repository->executeGitCommand("add", "--intent-to-add", "file.txt");
+
+
+    const auto indexFiles = indexManager.getFilesInIndexDetailedList();
+    ASSERT_EQ(indexFiles.size(), 1);
+    EXPECT_EQ(indexFiles[0].path, "file.txt");
+    EXPECT_EQ(indexFiles[0].stageNumber, 0);
+    EXPECT_EQ(indexFiles[0].objectHash, "e69de29bb2d1d6434b8b29ae775ad8c2e48c5391");
+}
@@ -0,0 +1,217 @@
+#include "BaseRepositoryFixture.hpp"
+
+#include <CppGit/CommitsManager.hpp>
+#include <CppGit/Merger.hpp>
+#include <CppGit/_details/ReferencesManager.hpp>
+#include <cstddef>
+#include <gtest/gtest.h>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+class MergeBaseTests : public BaseRepositoryFixture
+{
+protected:
+    auto createCommit(const std::string_view message, const std::vector<std::string>& parents) const -> std::string
+    {
+        auto args = std::vector<std::string>{ treeHash, "-m", std::string{ message } };
+        for (const auto& parent : parents)
+        {
+            args.emplace_back("-p");
+            args.push_back(parent);
+        }
+
+        return repository->executeGitCommand("commit-tree", args).stdout;
+    }
+
+    // Root - A1 - A2 ------ MergeA(A2, B1) - A3
+    //     \          \       /
+    //      \          CrissA(A2, B2), CrissB(B2, A2)
+    //       \                /      /
+    //        B1 ------------ B2 ----
+    // Orphan is unrelated to everything, CrissA and CrissB have two merge bases (criss-cross)
+    auto createHistory() -> std::vector<std::string>
+    {
+        repository->CommitsManager().createCommit("Initial commit");
+        treeHash = repository->executeGitCommand("rev-parse", "HEAD^{tree}").stdout;
+
+        const auto root = repository->executeGitCommand("rev-parse", "HEAD").stdout;
+        const auto commitA1 = createCommit("A1", { root });
+        const auto commitA2 = createCommit("A2", { commitA1 });
+        const auto commitB1 = createCommit("B1", { root });
+        const auto mergeA = createCommit("MergeA", { commitA2, commitB1 });
+        const auto commitA3 = createCommit("A3", { mergeA });
+        const auto commitB2 = createCommit("B2", { commitB1 });
+        const auto crissB = createCommit("CrissB", { commitB2, commitA2 });
+        const auto crissA = createCommit("CrissA", { commitA2, commitB2 });
+        const auto orphan = createCommit("Orphan", {});
+
+        const auto referencesManager = CppGit::_details::ReferencesManager{ *repository };
+        referencesManager.createRef("refs/heads/branchA", commitA3);
+        referencesManager.createRef("refs/heads/branchB", crissB);
+        referencesManager.createRef("refs/heads/crissA", crissA);
+        referencesManager.createRef("refs/heads/orphan", orphan);
+        repository->executeGitCommand("tag", "-a", "-m", "Tag message", "tagB1", commitB1);
+
+        return { root, commitA1, commitA2, commitB1, mergeA, commitA3, commitB2, crissB, crissA, orphan, "branchA", "branchB", "crissA", "orphan", "tagB1", "HEAD" };
+    }
+
+    auto expectBatchMergeBasesSameAsGit(const std::vector<std::string>& commits) const -> void
+    {
+        // Every commit against two shared ones, in both orders, and the shared commit against itself
+        auto pairs = std::vector<std::pair<std::string, std::string>>{};
+        for (const auto& commit : commits)
+        {
+            pairs.emplace_back(commit, "branchB");
+            pairs.emplace_back("crissA", commit);
+        }
+
+
+        const auto mergeBases = repository->Merger().getMergeBases(pairs);
+
+
+        ASSERT_EQ(mergeBases.size(), pairs.size());
+        for (auto i = std::size_t{ 0 }; i < pairs.size(); ++i)
+        {
+            EXPECT_EQ(mergeBases[i], repository->executeGitCommand("merge-base", pairs[i].first, pairs[i].second).stdout) << pairs[i].first << " " << pairs[i].second;
+        }
+    }
+
+    auto expectMergeBasesSameAsGit(const std::vector<std::string>& commits) const -> void
+    {
+        const auto merger = repository->Merger();
+        for (const auto& first : commits)
+        {
+            for (const auto& second : commits)
+            {
+                const auto gitMergeBase = repository->executeGitCommand("merge-base", first, second).stdout;
+                const auto gitIsAncestor = repository->executeGitCommand("merge-base", "--is-ancestor", first, second).return_code == 0;
+
+                EXPECT_EQ(merger.getMergeBase(first, second), gitMergeBase) << first << " " << second;
+                EXPECT_EQ(merger.isAncestor(first, second), gitIsAncestor) << first << " " << second;
+            }
+        }
+    }
+
+private:
+    std::string treeHash;
+};
+
+TEST_F(MergeBaseTests, withoutCommitGraph)
+{
+    const auto commits = createHistory();
+
+
+    expectMergeBasesSameAsGit(commits);
+}
+
+TEST_F(MergeBaseTests, withCommitGraph)
+{
+    const auto commits = createHistory();
+    repository->executeGitCommand("commit-graph", "write", "--reachable");
+
+
+    expectMergeBasesSameAsGit(commits);
+}
+
+TEST_F(MergeBaseTests, commitsPartiallyInCommitGraph)
+{
+    auto commits = createHistory();
+    repository->executeGitCommand("commit-graph", "write", "--reachable");
+    const auto newCommitHash = repository->CommitsManager().createCommit("New commit");
+    commits.push_back(newCommitHash);
+
+
+    expectMergeBasesSameAsGit(commits);
+}
+
+TEST_F(MergeBaseTests, withoutGitCommands)
+{
+    const auto commits = createHistory();
+    repository->executeGitCommand("commit-graph", "write", "--reachable");
+    const auto merger = repository->Merger();
+    const auto gitMergeBase = repository->executeGitCommand("merge-base", "branchA", "crissA").stdout;
+    const auto commandsCountBefore = repository->getCommandMetrics().getTotalCount();
+
+
+    const auto mergeBase = merger.getMergeBase("branchA", "crissA");
+    const auto canFastForward = merger.canFastForward("branchA");
+    const auto isAnythingToMerge = merger.isAnythingToMerge("HEAD", "branchB");
+
+
+    EXPECT_EQ(mergeBase, gitMergeBase);
+    EXPECT_TRUE(canFastForward);
+    EXPECT_FALSE(isAnythingToMerge);
+    EXPECT_EQ(repository->getCommandMetrics().getTotalCount(), commandsCountBefore);
+}
+
+TEST_F(MergeBaseTests, getMergeBases_batch)
+{
+    const auto commits = createHistory();
+    const auto merger = repository->Merger();
+    const auto pairs = std::vector<std::pair<std::string, std::string>>{
+        { "branchA",   "branchB" },
+        { "branchA",   "orphan"  },
+        { "HEAD",      "tagB1"   },
+        { "crissA",    "branchB" },
+        { "branchA~1", "branchB" }
+    };
+
+
+    const auto mergeBases = merger.getMergeBases(pairs);
+
+
+    ASSERT_EQ(mergeBases.size(), pairs.size());
+    for (auto i = std::size_t{ 0 }; i < pairs.size(); ++i)
+    {
+        EXPECT_EQ(mergeBases[i], repository->executeGitCommand("merge-base", pairs[i].first, pairs[i].second).stdout) << i;
+    }
+    EXPECT_EQ(mergeBases[1], "");
+}
+
+TEST_F(MergeBaseTests, getMergeBases_sharedSide_withoutCommitGraph)
+{
+    const auto commits = createHistory();
+
+
+    expectBatchMergeBasesSameAsGit(commits);
+}
+
+TEST_F(MergeBaseTests, getMergeBases_sharedSide_withCommitGraph)
+{
+    const auto commits = createHistory();
+    repository->executeGitCommand("commit-graph", "write", "--reachable");
+
+
+    expectBatchMergeBasesSameAsGit(commits);
+}
+
+TEST_F(MergeBaseTests, areAncestors)
+{
+    const auto commits = createHistory();
+    repository->executeGitCommand("commit-graph", "write", "--reachable");
+    const auto merger = repository->Merger();
+
+
+    const auto result = merger.areAncestors({ commits[0], commits[2], commits[3], commits[6], "orphan", "branchA" }, "branchA");
+
+
+    EXPECT_EQ(result, (std::vector<bool>{ true, true, true, false, false, true }));
+}
+
+TEST_F(MergeBaseTests, sameMerger_branchMoved)
+{
+    const auto commits = createHistory();
+    const auto merger = repository->Merger();
+    const auto mergeBaseBefore = merger.getMergeBase("branchA", "crissA");
+
+
+    CppGit::_details::ReferencesManager{ *repository }.updateRefHash("refs/heads/crissA", commits[6]);
+    const auto mergeBaseAfter = merger.getMergeBase("branchA", "crissA");
+
+
+    EXPECT_EQ(mergeBaseBefore, commits[2]);
+    EXPECT_EQ(mergeBaseAfter, commits[3]);
+    EXPECT_EQ(mergeBaseAfter, repository->executeGitCommand("merge-base", "branchA", "crissA").stdout);
+}
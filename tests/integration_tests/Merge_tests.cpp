@@ -4,7 +4,10 @@
 #include <CppGit/CommitsManager.hpp>
 #include <CppGit/Merger.hpp>
 #include <CppGit/_details/FileUtility.hpp>
+#include <filesystem>
 #include <gtest/gtest.h>
+#include <string>
+#include <string_view>
 
 class MergeTests : public BaseRepositoryFixture
 {
@@ -535,6 +538,125 @@ TEST_F(MergeTests, mergeNoFastForward_conflictTwoFiles)
     EXPECT_EQ(CppGit::_details::FileUtility::readFile(repositoryPath / "file2.txt"), "<<<<<<< HEAD\nHello, World 2! Modified 2!\n=======\nHello, World 2! Modified 1!\n>>>>>>> main\n");
 }
 
+TEST_F(MergeTests, mergeNoFastForward_conflictDiff3Style)
+{
+    const auto merger = repository->Merger();
+    const auto commitsManager = repository->CommitsManager();
+    const auto indexManager = repository->IndexManager();
+    const auto branchesManager = repository->BranchesManager();
+
+
+    repository->executeGitCommand("config", "merge.conflictStyle", "diff3");
+    CppGit::_details::FileUtility::createOrOverwriteFile(repositoryPath / "file.txt", "Hello, World!");
+    indexManager.add("file.txt");
+    commitsManager.createCommit("Initial commit");
+
+    branchesManager.createBranch("second_branch");
+
+    CppGit::_details::FileUtility::createOrOverwriteFile(repositoryPath / "file.txt", "Hello, World! Modified 1!");
+    indexManager.add("file.txt");
+    commitsManager.createCommit("Second commit");
+
+    branchesManager.changeBranch("second_branch");
+
+    CppGit::_details::FileUtility::createOrOverwriteFile(repositoryPath / "file.txt", "Hello, World! Modified 2!");
+    indexManager.add("file.txt");
+    commitsManager.createCommit("Third commit");
+
+    const auto mergeNoFFResult = merger.mergeNoFastForward("main", "Merge commit");
+
+
+    ASSERT_FALSE(mergeNoFFResult.has_value());
+    EXPECT_EQ(mergeNoFFResult.error(), CppGit::MergeResult::NO_FF_CONFLICT);
+    EXPECT_EQ(CppGit::_details::FileUtility::readFile(repositoryPath / "file.txt"), "<<<<<<< HEAD\nHello, World! Modified 2!\n||||||| ancestor\nHello, World!\n=======\nHello, World! Modified 1!\n>>>>>>> main\n");
+    for (const auto& entry : std::filesystem::directory_iterator{ repositoryPath / ".git" })
+    {
+        EXPECT_FALSE(entry.path().filename().string().starts_with(".merge_file_"));
+    }
+}
+
+TEST_F(MergeTests, mergeNoFastForward_conflictBinaryFile)
+{
+    using namespace std::string_view_literals;
+
+    const auto merger = repository->Merger();
+    const auto commitsManager = repository->CommitsManager();
+    const auto indexManager = repository->IndexManager();
+    const auto branchesManager = repository->BranchesManager();
+
+
+    CppGit::_details::FileUtility::createOrOverwriteFile(repositoryPath / "file.bin", "a\0b\n"sv);
+    indexManager.add("file.bin");
+    commitsManager.createCommit("Initial commit");
+
+    branchesManager.createBranch("second_branch");
+
+    CppGit::_details::FileUtility::createOrOverwriteFile(repositoryPath / "file.bin", "a\0X\n"sv);
+    indexManager.add("file.bin");
+    commitsManager.createCommit("Second commit");
+
+    branchesManager.changeBranch("second_branch");
+
+    CppGit::_details::FileUtility::createOrOverwriteFile(repositoryPath / "file.bin", "a\0Y\n"sv);
+    indexManager.add("file.bin");
+    commitsManager.createCommit("Third commit");
+
+    const auto mergeNoFFResult = merger.mergeNoFastForward("main", "Merge commit");
+
+
+    ASSERT_FALSE(mergeNoFFResult.has_value());
+    EXPECT_EQ(mergeNoFFResult.error(), CppGit::MergeResult::NO_FF_CONFLICT);
+    EXPECT_TRUE(merger.isThereAnyConflict());
+    EXPECT_EQ(CppGit::_details::FileUtility::readFile(repositoryPath / "file.bin"), "a\0Y\n"sv);
+}
+
+TEST_F(MergeTests, mergeNoFastForward_conflictManyFiles)
+{
+    const auto merger = repository->Merger();
+    const auto commitsManager = repository->CommitsManager();
+    const auto indexManager = repository->IndexManager();
+    const auto branchesManager = repository->BranchesManager();
+    constexpr auto filesCount = 20;
+
+
+    const auto writeFiles = [&](const std::string_view changedLine) {
+        for (auto i = 0; i < filesCount; ++i)
+        {
+            const auto fileName = "file" + std::to_string(i) + ".txt";
+            CppGit::_details::FileUtility::createOrOverwriteFile(repositoryPath / fileName, "Line 1\n" + std::string{ changedLine } + "\nLine 3\n");
+            indexManager.add(fileName);
+        }
+    };
+    writeFiles("Line 2");
+    std::filesystem::permissions(repositoryPath / "file0.txt", std::filesystem::perms::owner_exec, std::filesystem::perm_options::add);
+    indexManager.add("file0.txt");
+    commitsManager.createCommit("Initial commit");
+
+    branchesManager.createBranch("second_branch");
+
+    writeFiles("Line 2 Modified 1");
+    commitsManager.createCommit("Second commit");
+
+    branchesManager.changeBranch("second_branch");
+
+    writeFiles("Line 2 Modified 2");
+    commitsManager.createCommit("Third commit");
+
+    const auto mergeNoFFResult = merger.mergeNoFastForward("main", "Merge commit");
+
+
+    ASSERT_FALSE(mergeNoFFResult.has_value());
+    EXPECT_EQ(mergeNoFFResult.error(), CppGit::MergeResult::NO_FF_CONFLICT);
+    EXPECT_TRUE(merger.isThereAnyConflict());
+    for (auto i = 0; i < filesCount; ++i)
+    {
+        EXPECT_EQ(CppGit::_details::FileUtility::readFile(repositoryPath / ("file" + std::to_string(i) + ".txt")), "Line 1\n<<<<<<< HEAD\nLine 2 Modified 2\n=======\nLine 2 Modified 1\n>>>>>>> main\nLine 3\n");
+    }
+    const auto executablePermissions = std::filesystem::perms::owner_exec;
+    EXPECT_EQ(std::filesystem::status(repositoryPath / "file0.txt").permissions() & executablePermissions, executablePermissions);
+    EXPECT_EQ(std::filesystem::status(repositoryPath / "file1.txt").permissions() & executablePermissions, std::filesystem::perms::none);
+}
+
 TEST_F(MergeTests, mergeNoFastForward_resolveConflict)
 {
     const auto merger = repository->Merger();
@@ -0,0 +1,137 @@
+#include "BaseRepositoryFixture.hpp"
+
+#include <CppGit/CommitsManager.hpp>
+#include <CppGit/IndexManager.hpp>
+#include <CppGit/Repository.hpp>
+#include <CppGit/_details/FileUtility.hpp>
+#include <cstddef>
+#include <gtest/gtest.h>
+#include <string>
+#include <thread>
+#include <vector>
+
+class ObjectReaderTests : public BaseRepositoryFixture
+{
+};
+
+TEST_F(ObjectReaderTests, readBlob)
+{
+    const auto commitsManager = repository->CommitsManager();
+    const auto indexManager = repository->IndexManager();
+
+    CppGit::_details::FileUtility::createOrOverwriteFile(repositoryPath / "file.txt", "Hello, World!\nSecond line\n");
+    indexManager.add("file.txt");
+    commitsManager.createCommit("Initial commit");
+
+
+    const auto blob = repository->readObject("HEAD:file.txt");
+
+
+    ASSERT_TRUE(blob.has_value());
+    EXPECT_EQ(blob->type, "blob");
+    EXPECT_EQ(blob->hash.size(), 40);
+    EXPECT_EQ(blob->content, "Hello, World!\nSecond line\n");
+}
+
+TEST_F(ObjectReaderTests, readCommit)
+{
+    const auto commitsManager = repository->CommitsManager();
+
+    const auto initialCommitHash = commitsManager.createCommit("Initial commit");
+
+
+    const auto commit = repository->readObject(initialCommitHash);
+
+
+    ASSERT_TRUE(commit.has_value());
+    EXPECT_EQ(commit->type, "commit");
+    EXPECT_EQ(commit->hash, initialCommitHash);
+    EXPECT_TRUE(commit->content.starts_with("tree "));
+    EXPECT_TRUE(commit->content.ends_with("Initial commit\n"));
+}
+
+TEST_F(ObjectReaderTests, readMissingObject)
+{
+    const auto commitsManager = repository->CommitsManager();
+
+    commitsManager.createCommit("Initial commit");
+
+
+    EXPECT_FALSE(repository->readObject("0123456789012345678901234567890123456789").has_value());
+    EXPECT_FALSE(repository->readObject("HEAD:notExistingFile.txt").has_value());
+    EXPECT_FALSE(repository->readObject("").has_value());
+}
+
+TEST_F(ObjectReaderTests, readManyObjects_seesNewlyCreatedObjects)
+{
+    const auto commitsManager = repository->CommitsManager();
+
+    auto hashes = std::vector<std::string>{};
+    for (auto i = 0; i < 20; ++i)
+    {
+        hashes.push_back(commitsManager.createCommit("Commit " + std::to_string(i)));
+
+        // objects created after the reader has started must be visible too
+        const auto commit = commitsManager.getCommitInfo(hashes.back());
+        EXPECT_EQ(commit.getMessage(), "Commit " + std::to_string(i));
+    }
+
+    for (auto i = std::size_t{ 1 }; i < hashes.size(); ++i)
+    {
+        const auto commit = commitsManager.getCommitInfo(hashes[i]);
+        EXPECT_EQ(commit.getHash(), hashes[i]);
+        ASSERT_EQ(commit.getParents().size(), 1);
+        EXPECT_EQ(commit.getParents()[0], hashes[i - 1]);
+    }
+}
+
+TEST_F(ObjectReaderTests, getCommitInfo_byRevision)
+{
+    const auto commitsManager = repository->CommitsManager();
+
+    const auto initialCommitHash = commitsManager.createCommit("Initial commit");
+    const auto secondCommitHash = commitsManager.createCommit("Second commit", "Description");
+
+
+    const auto commit = commitsManager.getCommitInfo("HEAD");
+    const auto parent = commitsManager.getCommitInfo("HEAD~1");
+
+
+    EXPECT_EQ(commit.getHash(), secondCommitHash);
+    EXPECT_EQ(commit.getMessage(), "Second commit");
+    EXPECT_EQ(commit.getDescription(), "Description");
+    EXPECT_EQ(parent.getHash(), initialCommitHash);
+    EXPECT_EQ(parent.getMessage(), "Initial commit");
+}
+
+TEST_F(ObjectReaderTests, copiedRepository_concurrentReads)
+{
+    const auto commitsManager = repository->CommitsManager();
+
+    const auto initialCommitHash = commitsManager.createCommit("Initial commit");
+    const auto repositoryCopy = *repository;
+
+
+    auto threads = std::vector<std::thread>{};
+    auto readCounts = std::vector<int>(4, 0);
+    for (auto i = std::size_t{ 0 }; i < readCounts.size(); ++i)
+    {
+        const auto& readingRepository = i % 2 == 0 ? *repository : repositoryCopy;
+        threads.emplace_back([&readingRepository, &initialCommitHash, &readCount = readCounts[i]] {
+            for (auto j = 0; j < 50; ++j)
+            {
+                if (const auto commit = readingRepository.readObject(initialCommitHash); commit && commit->hash == initialCommitHash)
+                {
+                    ++readCount;
+                }
+            }
+        });
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+
+    EXPECT_EQ(readCounts, (std::vector<int>{ 50, 50, 50, 50 }));
+}
@@ -7,7 +7,12 @@
 #include <CppGit/IndexManager.hpp>
 #include <CppGit/Rebaser.hpp>
 #include <CppGit/_details/FileUtility.hpp>
+#include <CppGit/_details/GitCommandExecutor/GitCommandMetrics.hpp>
+#include <algorithm>
+#include <filesystem>
 #include <gtest/gtest.h>
+#include <string>
+#include <vector>
 
 class RebaseBasicTests : public RebaseFixture
 {
@@ -498,3 +503,134 @@ TEST_F(RebaseBasicTests, dontSkipEmptyCommit)
     EXPECT_FALSE(std::filesystem::exists(repositoryPath / ".git" / "REBASE_HEAD"));
     EXPECT_EQ(CppGit::_details::FileUtility::readFile(repositoryPath / ".git" / "ORIG_HEAD"), fourthCommitHash);
 }
+
+TEST_F(RebaseBasicTests, conflict_continueWithGit)
+{
+    const auto rebaser = repository->Rebaser();
+    const auto commitsManager = repository->CommitsManager();
+    const auto branchesManager = repository->BranchesManager();
+    const auto indexManager = repository->IndexManager();
+    auto commitsLogManager = repository->CommitsLogManager();
+    commitsLogManager.setOrder(CppGit::CommitsLogManager::Order::REVERSE);
+
+    const auto initialCommitHash = commitsManager.createCommit("Initial commit");
+    branchesManager.createBranch("second_branch");
+    CppGit::_details::FileUtility::createOrOverwriteFile(repositoryPath / "file.txt", "Main");
+    indexManager.add("file.txt");
+    const auto secondCommitHash = commitsManager.createCommit("Second commit");
+
+    branchesManager.changeBranch("second_branch");
+    CppGit::_details::FileUtility::createOrOverwriteFile(repositoryPath / "file.txt", "Second");
+    indexManager.add("file.txt");
+    createCommitWithTestAuthorCommiter("Third commit", initialCommitHash);
+    CppGit::_details::FileUtility::createOrOverwriteFile(repositoryPath / "file2.txt", "Fourth");
+    indexManager.add("file2.txt");
+    commitsManager.createCommit("Fourth commit");
+    CppGit::_details::FileUtility::createOrOverwriteFile(repositoryPath / "file3.txt", "Fifth");
+    indexManager.add("file3.txt");
+    commitsManager.createCommit("Fifth commit");
+
+    const auto rebaseResult = rebaser.rebase("main");
+    ASSERT_FALSE(rebaseResult.has_value());
+    EXPECT_EQ(rebaseResult.error(), CppGit::RebaseResult::CONFLICT);
+
+    CppGit::_details::FileUtility::createOrOverwriteFile(repositoryPath / "file.txt", "Resolved");
+    indexManager.add("file.txt");
+    const auto gitContinueOutput = repository->executeGitCommand(std::vector<std::string>{ "GIT_EDITOR=true" }, "rebase", "--continue");
+
+
+    EXPECT_EQ(gitContinueOutput.return_code, 0) << gitContinueOutput.stderr;
+    EXPECT_EQ(branchesManager.getCurrentBranchName(), "refs/heads/second_branch");
+
+    const auto log = commitsLogManager.getCommitsLogDetailed();
+    ASSERT_EQ(log.size(), 5);
+    EXPECT_EQ(log[1].getHash(), secondCommitHash);
+    EXPECT_EQ(log[2].getMessage(), "Third commit");
+    EXPECT_EQ(log[3].getMessage(), "Fourth commit");
+    EXPECT_EQ(log[4].getMessage(), "Fifth commit");
+
+    EXPECT_EQ(CppGit::_details::FileUtility::readFile(repositoryPath / "file.txt"), "Resolved");
+    EXPECT_FALSE(std::filesystem::exists(rebaseDirPath));
+}
+
+TEST_F(RebaseBasicTests, todoCheckpoints)
+{
+    auto rebaser = repository->Rebaser();
+    const auto commitsManager = repository->CommitsManager();
+    const auto branchesManager = repository->BranchesManager();
+    const auto indexManager = repository->IndexManager();
+
+    const auto initialCommitHash = commitsManager.createCommit("Initial commit");
+    branchesManager.createBranch("second_branch");
+    CppGit::_details::FileUtility::createOrOverwriteFile(repositoryPath / "file1.txt", "");
+    indexManager.add("file1.txt");
+    commitsManager.createCommit("Second commit");
+
+    branchesManager.changeBranch("second_branch");
+    for (const auto* const fileName : { "file2.txt", "file3.txt", "file4.txt" })
+    {
+        CppGit::_details::FileUtility::createOrOverwriteFile(repositoryPath / fileName, "");
+        indexManager.add(fileName);
+        commitsManager.createCommit(fileName);
+    }
+
+    // Number of done commands written to disk when every commit is created, -1 if there is no done file yet
+    auto doneCountsAtCommits = std::vector<int>{};
+    repository->getCommandMetrics().setObserver([this, &doneCountsAtCommits](const CppGit::GitCommandMetric& metric) {
+        if (metric.command == "commit-tree")
+        {
+            const auto doneFilePath = rebaseDirPath / "done";
+            const auto doneFile = CppGit::_details::FileUtility::readFile(doneFilePath);
+            doneCountsAtCommits.push_back(std::filesystem::exists(doneFilePath) ? static_cast<int>(std::ranges::count(doneFile, '\n')) : -1);
+        }
+    });
+    rebaser.setTodoCheckpointInterval(1);
+
+
+    const auto rebaseResult = rebaser.rebase("main");
+
+
+    ASSERT_TRUE(rebaseResult.has_value());
+    EXPECT_EQ(doneCountsAtCommits, (std::vector<int>{ -1, 1, 2 }));
+    EXPECT_FALSE(std::filesystem::exists(rebaseDirPath));
+}
+
+TEST_F(RebaseBasicTests, todoNotWrittenUntilStop)
+{
+    const auto rebaser = repository->Rebaser();
+    const auto commitsManager = repository->CommitsManager();
+    const auto branchesManager = repository->BranchesManager();
+    const auto indexManager = repository->IndexManager();
+
+    const auto initialCommitHash = commitsManager.createCommit("Initial commit");
+    branchesManager.createBranch("second_branch");
+    CppGit::_details::FileUtility::createOrOverwriteFile(repositoryPath / "file1.txt", "");
+    indexManager.add("file1.txt");
+    commitsManager.createCommit("Second commit");
+
+    branchesManager.changeBranch("second_branch");
+    for (const auto* const fileName : { "file2.txt", "file3.txt", "file4.txt" })
+    {
+        CppGit::_details::FileUtility::createOrOverwriteFile(repositoryPath / fileName, "");
+        indexManager.add(fileName);
+        commitsManager.createCommit(fileName);
+    }
+
+    auto todoFilesAtCommits = std::vector<std::string>{};
+    repository->getCommandMetrics().setObserver([this, &todoFilesAtCommits](const CppGit::GitCommandMetric& metric) {
+        if (metric.command == "commit-tree")
+        {
+            todoFilesAtCommits.push_back(CppGit::_details::FileUtility::readFile(rebaseDirPath / "git-rebase-todo"));
+            EXPECT_FALSE(std::filesystem::exists(rebaseDirPath / "done"));
+        }
+    });
+
+
+    const auto rebaseResult = rebaser.rebase("main");
+
+
+    ASSERT_TRUE(rebaseResult.has_value());
+    ASSERT_EQ(todoFilesAtCommits.size(), 3);
+    EXPECT_EQ(todoFilesAtCommits[0], todoFilesAtCommits[2]);
+    EXPECT_EQ(std::ranges::count(todoFilesAtCommits[2], '\n'), 3);
+}
@@ -0,0 +1,345 @@
+#include "RebaseFixture.hpp"
+
+#include <CppGit/BranchesManager.hpp>
+#include <CppGit/CommitsLogManager.hpp>
+#include <CppGit/CommitsManager.hpp>
+#include <CppGit/IndexManager.hpp>
+#include <CppGit/Rebaser.hpp>
+#include <CppGit/_details/FileUtility.hpp>
+#include <gtest/gtest.h>
+#include <stdexcept>
+#include <string>
+
+class RebaseInMemoryTests : public RebaseFixture
+{
+protected:
+    struct History
+    {
+        std::string initialCommitHash;
+        std::string secondCommitHash;
+        std::string thirdCommitHash;
+        std::string fourthCommitHash;
+    };
+
+    // main: Initial - Second (file1.txt)
+    // second_branch: Initial - Third (file2.txt) - Fourth (file2.txt changed, file3.txt)
+    // second_branch stays checked out
+    auto createHistory() const -> History
+    {
+        const auto commitsManager = repository->CommitsManager();
+        const auto branchesManager = repository->BranchesManager();
+        const auto indexManager = repository->IndexManager();
+
+        auto history = History{};
+        history.initialCommitHash = commitsManager.createCommit("Initial commit");
+        branchesManager.createBranch("second_branch");
+        CppGit::_details::FileUtility::createOrOverwriteFile(repositoryPath / "file1.txt", "Main");
+        indexManager.add("file1.txt");
+        history.secondCommitHash = commitsManager.createCommit("Second commit");
+
+        branchesManager.changeBranch("second_branch");
+        CppGit::_details::FileUtility::createOrOverwriteFile(repositoryPath / "file2.txt", "Second branch");
+        indexManager.add("file2.txt");
+        history.thirdCommitHash = createCommitWithTestAuthorCommiter("Third commit", history.initialCommitHash);
+        CppGit::_details::FileUtility::createOrOverwriteFile(repositoryPath / "file2.txt", "Second branch changed");
+        CppGit::_details::FileUtility::createOrOverwriteFile(repositoryPath / "file3.txt", "Third file");
+        indexManager.add("file2.txt");
+        indexManager.add("file3.txt");
+        history.fourthCommitHash = createCommitWithTestAuthorCommiter("Fourth commit", "Fourth description", history.thirdCommitHash);
+
+        return history;
+    }
+
+    auto checkRebasedLog(const History& history, const std::string& rebasedHeadHash) const -> void
+    {
+        auto commitsLogManager = repository->CommitsLogManager();
+        commitsLogManager.setOrder(CppGit::CommitsLogManager::Order::REVERSE);
+
+        const auto log = commitsLogManager.getCommitsLogDetailed(rebasedHeadHash);
+        ASSERT_EQ(log.size(), 4);
+        EXPECT_EQ(log[0].getHash(), history.initialCommitHash);
+        EXPECT_EQ(log[1].getHash(), history.secondCommitHash);
+        EXPECT_EQ(log[2].getMessage(), "Third commit");
+        EXPECT_EQ(log[2].getDescription(), "");
+        checkTestAuthorPreservedCommitterModified(log[2]);
+        EXPECT_EQ(log[3].getMessage(), "Fourth commit");
+        EXPECT_EQ(log[3].getDescription(), "Fourth description");
+        checkTestAuthorPreservedCommitterModified(log[3]);
+
+        const auto filesList = repository->executeGitCommand("ls-tree", "--name-only", rebasedHeadHash).stdout;
+        EXPECT_EQ(filesList, "file1.txt\nfile2.txt\nfile3.txt");
+    }
+};
+
+TEST_F(RebaseInMemoryTests, checkedOutBranch)
+{
+    const auto rebaser = repository->Rebaser();
+    const auto commitsManager = repository->CommitsManager();
+    const auto branchesManager = repository->BranchesManager();
+    const auto history = createHistory();
+    repository->getCommandMetrics().reset();
+
+
+    const auto rebaseResult = rebaser.rebaseInMemory("main");
+
+
+    ASSERT_TRUE(rebaseResult.has_value());
+    checkRebasedLog(history, rebaseResult.value());
+
+    EXPECT_EQ(commitsManager.getHeadCommitHash(), rebaseResult.value());
+    EXPECT_EQ(branchesManager.getCurrentBranchName(), "refs/heads/second_branch");
+    EXPECT_EQ(branchesManager.getHashBranchRefersTo("refs/heads/second_branch"), rebaseResult.value());
+
+    EXPECT_EQ(CppGit::_details::FileUtility::readFile(repositoryPath / "file1.txt"), "Main");
+    EXPECT_EQ(CppGit::_details::FileUtility::readFile(repositoryPath / "file2.txt"), "Second branch changed");
+    EXPECT_EQ(CppGit::_details::FileUtility::readFile(repositoryPath / "file3.txt"), "Third file");
+    EXPECT_FALSE(repository->IndexManager().areAnyStagedFiles());
+
+    const auto& metrics = repository->getCommandMetrics();
+    EXPECT_FALSE(metrics.getStatistics("apply").has_value());
+    EXPECT_EQ(metrics.getStatistics("checkout-index")->count, 1);
+    EXPECT_EQ(metrics.getStatistics("read-tree")->count, 1);
+
+    EXPECT_FALSE(std::filesystem::exists(rebaseDirPath));
+    EXPECT_EQ(CppGit::_details::FileUtility::readFile(repositoryPath / ".git" / "ORIG_HEAD"), history.fourthCommitHash);
+}
+
+TEST_F(RebaseInMemoryTests, notCheckedOutBranch)
+{
+    const auto rebaser = repository->Rebaser();
+    const auto commitsManager = repository->CommitsManager();
+    const auto branchesManager = repository->BranchesManager();
+    const auto history = createHistory();
+    branchesManager.changeBranch("main");
+
+
+    const auto rebaseResult = rebaser.rebaseInMemory("second_branch", "main");
+
+
+    ASSERT_TRUE(rebaseResult.has_value());
+    checkRebasedLog(history, rebaseResult.value());
+
+    EXPECT_EQ(branchesManager.getCurrentBranchName(), "refs/heads/main");
+    EXPECT_EQ(commitsManager.getHeadCommitHash(), history.secondCommitHash);
+    EXPECT_EQ(branchesManager.getHashBranchRefersTo("refs/heads/second_branch"), rebaseResult.value());
+
+    EXPECT_TRUE(std::filesystem::exists(repositoryPath / "file1.txt"));
+    EXPECT_FALSE(std::filesystem::exists(repositoryPath / "file2.txt"));
+    EXPECT_FALSE(std::filesystem::exists(repositoryPath / "file3.txt"));
+    EXPECT_FALSE(repository->IndexManager().areAnyStagedFiles());
+}
+
+TEST_F(RebaseInMemoryTests, notExistingBranch)
+{
+    const auto rebaser = repository->Rebaser();
+    const auto branchesManager = repository->BranchesManager();
+    createHistory();
+
+
+    EXPECT_THROW(static_cast<void>(rebaser.rebaseInMemory("not_existing_branch", "main")), std::runtime_error);
+
+
+    EXPECT_FALSE(branchesManager.branchExists("not_existing_branch"));
+}
+
+TEST_F(RebaseInMemoryTests, detachedHead)
+{
+    const auto rebaser = repository->Rebaser();
+    const auto branchesManager = repository->BranchesManager();
+    const auto history = createHistory();
+    branchesManager.detachHead(history.fourthCommitHash);
+
+
+    EXPECT_THROW(static_cast<void>(rebaser.rebaseInMemory("main")), std::runtime_error);
+
+
+    EXPECT_EQ(repository->CommitsManager().getHeadCommitHash(), history.fourthCommitHash);
+}
+
+TEST_F(RebaseInMemoryTests, bareRepository)
+{
+    const auto history = createHistory();
+    const auto bareRepositoryPath = repositoryPath / "bare.git";
+    repository->executeGitCommand("clone", "--bare", "--quiet", ".", bareRepositoryPath.string());
+    const auto bareRepository = CppGit::Repository{ bareRepositoryPath };
+
+
+    const auto rebaseResult = bareRepository.Rebaser().rebaseInMemory("second_branch", "main");
+
+
+    ASSERT_TRUE(rebaseResult.has_value());
+    EXPECT_EQ(bareRepository.BranchesManager().getHashBranchRefersTo("refs/heads/second_branch"), rebaseResult.value());
+    EXPECT_EQ(bareRepository.executeGitCommand("rev-parse", "second_branch~2").stdout, history.secondCommitHash);
+    EXPECT_EQ(bareRepository.executeGitCommand("ls-tree", "--name-only", rebaseResult.value()).stdout, "file1.txt\nfile2.txt\nfile3.txt");
+    EXPECT_FALSE(std::filesystem::exists(bareRepositoryPath / "rebase-merge"));
+}
+
+TEST_F(RebaseInMemoryTests, skipPreviouslyAppliedCommit_keepEmptyCommit)
+{
+    const auto rebaser = repository->Rebaser();
+    const auto commitsManager = repository->CommitsManager();
+    const auto branchesManager = repository->BranchesManager();
+    const auto indexManager = repository->IndexManager();
+    auto commitsLogManager = repository->CommitsLogManager();
+    commitsLogManager.setOrder(CppGit::CommitsLogManager::Order::REVERSE);
+
+    CppGit::_details::FileUtility::createOrOverwriteFile(repositoryPath / "file.txt", "Line 1");
+    indexManager.add("file.txt");
+    const auto initialCommitHash = commitsManager.createCommit("Initial commit");
+    branchesManager.createBranch("second_branch");
+    CppGit::_details::FileUtility::createOrOverwriteFile(repositoryPath / "file.txt", "Line changed");
+    indexManager.add("file.txt");
+    const auto secondCommitHash = commitsManager.createCommit("Second commit");
+
+    branchesManager.changeBranch("second_branch");
+    CppGit::_details::FileUtility::createOrOverwriteFile(repositoryPath / "file.txt", "Line changed");
+    indexManager.add("file.txt");
+    commitsManager.createCommit("Third commit");
+    commitsManager.createCommit("Empty commit");
+    CppGit::_details::FileUtility::createOrOverwriteFile(repositoryPath / "file.txt", "Line changed again");
+    indexManager.add("file.txt");
+    commitsManager.createCommit("Fifth commit");
+
+
+    const auto rebaseResult = rebaser.rebaseInMemory("main");
+
+
+    ASSERT_TRUE(rebaseResult.has_value());
+    EXPECT_EQ(commitsManager.getHeadCommitHash(), rebaseResult.value());
+
+    const auto log = commitsLogManager.getCommitsLogDetailed();
+    ASSERT_EQ(log.size(), 4);
+    EXPECT_EQ(log[0].getHash(), initialCommitHash);
+    EXPECT_EQ(log[1].getHash(), secondCommitHash);
+    EXPECT_EQ(log[2].getMessage(), "Empty commit");
+    EXPECT_EQ(log[2].getTreeHash(), log[1].getTreeHash());
+    EXPECT_EQ(log[3].getMessage(), "Fifth commit");
+
+    EXPECT_EQ(CppGit::_details::FileUtility::readFile(repositoryPath / "file.txt"), "Line changed again");
+}
+
+TEST_F(RebaseInMemoryTests, conflict_notCheckedOutBranch)
+{
+    const auto rebaser = repository->Rebaser();
+    const auto branchesManager = repository->BranchesManager();
+    const auto indexManager = repository->IndexManager();
+    const auto history = createHistory();
+    branchesManager.changeBranch("main");
+    CppGit::_details::FileUtility::createOrOverwriteFile(repositoryPath / "file2.txt", "Main");
+    indexManager.add("file2.txt");
+    const auto mainHeadHash = repository->CommitsManager().createCommit("Conflicting commit");
+
+
+    const auto rebaseResult = rebaser.rebaseInMemory("second_branch", "main");
+
+
+    ASSERT_FALSE(rebaseResult.has_value());
+    EXPECT_EQ(rebaseResult.error(), CppGit::RebaseResult::CONFLICT);
+
+    EXPECT_EQ(branchesManager.getCurrentBranchName(), "refs/heads/main");
+    EXPECT_EQ(branchesManager.getHashBranchRefersTo("refs/heads/main"), mainHeadHash);
+    EXPECT_EQ(branchesManager.getHashBranchRefersTo("refs/heads/second_branch"), history.fourthCommitHash);
+    EXPECT_EQ(CppGit::_details::FileUtility::readFile(repositoryPath / "file2.txt"), "Main");
+    EXPECT_FALSE(rebaser.isRebaseInProgress());
+    EXPECT_FALSE(std::filesystem::exists(rebaseDirPath));
+}
+
+TEST_F(RebaseInMemoryTests, conflict_checkedOutBranch_stopAtConflictingCommit)
+{
+    const auto rebaser = repository->Rebaser();
+    const auto commitsManager = repository->CommitsManager();
+    const auto branchesManager = repository->BranchesManager();
+    const auto indexManager = repository->IndexManager();
+    auto commitsLogManager = repository->CommitsLogManager();
+    commitsLogManager.setOrder(CppGit::CommitsLogManager::Order::REVERSE);
+
+    const auto initialCommitHash = commitsManager.createCommit("Initial commit");
+    branchesManager.createBranch("second_branch");
+    CppGit::_details::FileUtility::createOrOverwriteFile(repositoryPath / "file.txt", "Main");
+    indexManager.add("file.txt");
+    const auto secondCommitHash = commitsManager.createCommit("Second commit");
+
+    branchesManager.changeBranch("second_branch");
+    const auto thirdCommitHash = createCommitWithTestAuthorCommiter("Third commit", initialCommitHash);
+    CppGit::_details::FileUtility::createOrOverwriteFile(repositoryPath / "file.txt", "Second");
+    indexManager.add("file.txt");
+    const auto fourthCommitHash = createCommitWithTestAuthorCommiter("Fourth commit", thirdCommitHash);
+
+
+    const auto rebaseResult = rebaser.rebaseInMemory("main");
+
+
+    ASSERT_FALSE(rebaseResult.has_value());
+    EXPECT_EQ(rebaseResult.error(), CppGit::RebaseResult::CONFLICT);
+
+    const auto log = commitsLogManager.getCommitsLogDetailed();
+    ASSERT_EQ(log.size(), 3);
+    EXPECT_EQ(log[0].getHash(), initialCommitHash);
+    EXPECT_EQ(log[1].getHash(), secondCommitHash);
+    EXPECT_EQ(log[2].getMessage(), "Third commit");
+    checkTestAuthorPreservedCommitterModified(log[2]);
+
+    EXPECT_EQ(CppGit::_details::FileUtility::readFile(repositoryPath / "file.txt"), "<<<<<<< HEAD\nMain\n=======\nSecond\n>>>>>>> " + fourthCommitHash + "\n");
+
+    const auto doneFileExpected = "pick " + thirdCommitHash + " Third commit\n"
+                                + "pick " + fourthCommitHash + " Fourth commit\n";
+    ASSERT_TRUE(std::filesystem::exists(rebaseDirPath));
+    EXPECT_EQ(CppGit::_details::FileUtility::readFile(repositoryPath / ".git" / "REBASE_HEAD"), fourthCommitHash);
+    EXPECT_EQ(CppGit::_details::FileUtility::readFile(rebaseDirPath / "author-script"), expectedAuthorScript);
+    EXPECT_EQ(CppGit::_details::FileUtility::readFile(rebaseDirPath / "done"), doneFileExpected);
+    EXPECT_EQ(CppGit::_details::FileUtility::readFile(rebaseDirPath / "git-rebase-todo"), "");
+    EXPECT_EQ(CppGit::_details::FileUtility::readFile(rebaseDirPath / "head-name"), "refs/heads/second_branch");
+    EXPECT_EQ(CppGit::_details::FileUtility::readFile(rebaseDirPath / "onto"), secondCommitHash);
+    EXPECT_EQ(CppGit::_details::FileUtility::readFile(rebaseDirPath / "orig-head"), fourthCommitHash);
+    EXPECT_EQ(CppGit::_details::FileUtility::readFile(rebaseDirPath / "rewritten-list"), thirdCommitHash + " " + log[2].getHash() + "\n");
+    EXPECT_EQ(CppGit::_details::FileUtility::readFile(repositoryPath / ".git" / "ORIG_HEAD"), fourthCommitHash);
+}
+
+TEST_F(RebaseInMemoryTests, conflict_checkedOutBranch_continue)
+{
+    const auto rebaser = repository->Rebaser();
+    const auto commitsManager = repository->CommitsManager();
+    const auto branchesManager = repository->BranchesManager();
+    const auto indexManager = repository->IndexManager();
+    auto commitsLogManager = repository->CommitsLogManager();
+    commitsLogManager.setOrder(CppGit::CommitsLogManager::Order::REVERSE);
+
+    const auto initialCommitHash = commitsManager.createCommit("Initial commit");
+    branchesManager.createBranch("second_branch");
+    CppGit::_details::FileUtility::createOrOverwriteFile(repositoryPath / "file.txt", "Main");
+    indexManager.add("file.txt");
+    const auto secondCommitHash = commitsManager.createCommit("Second commit");
+
+    branchesManager.changeBranch("second_branch");
+    CppGit::_details::FileUtility::createOrOverwriteFile(repositoryPath / "file.txt", "Second");
+    indexManager.add("file.txt");
+    createCommitWithTestAuthorCommiter("Third commit", initialCommitHash);
+    CppGit::_details::FileUtility::createOrOverwriteFile(repositoryPath / "file2.txt", "Fourth");
+    indexManager.add("file2.txt");
+    commitsManager.createCommit("Fourth commit");
+
+    const auto rebaseResult = rebaser.rebaseInMemory("main");
+    CppGit::_details::FileUtility::createOrOverwriteFile(repositoryPath / "file.txt", "Resolved");
+    indexManager.add("file.txt");
+
+
+    const auto continueResult = rebaser.continueRebase();
+
+
+    ASSERT_FALSE(rebaseResult.has_value());
+    EXPECT_EQ(rebaseResult.error(), CppGit::RebaseResult::CONFLICT);
+    ASSERT_TRUE(continueResult.has_value());
+    EXPECT_EQ(branchesManager.getCurrentBranchName(), "refs/heads/second_branch");
+    EXPECT_EQ(commitsManager.getHeadCommitHash(), continueResult.value());
+
+    const auto log = commitsLogManager.getCommitsLogDetailed();
+    ASSERT_EQ(log.size(), 4);
+    EXPECT_EQ(log[1].getHash(), secondCommitHash);
+    EXPECT_EQ(log[2].getMessage(), "Third commit");
+    checkTestAuthorPreservedCommitterModified(log[2]);
+    EXPECT_EQ(log[3].getMessage(), "Fourth commit");
+
+    EXPECT_EQ(CppGit::_details::FileUtility::readFile(repositoryPath / "file.txt"), "Resolved");
+    EXPECT_EQ(CppGit::_details::FileUtility::readFile(repositoryPath / "file2.txt"), "Fourth");
+    EXPECT_FALSE(std::filesystem::exists(rebaseDirPath));
+}
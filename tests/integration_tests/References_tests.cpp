@@ -0,0 +1,105 @@
+#include "BaseRepositoryFixture.hpp"
+
+#include <CppGit/CommitsManager.hpp>
+#include <CppGit/_details/ReferencesManager.hpp>
+#include <gtest/gtest.h>
+#include <string>
+
+class ReferencesTests : public BaseRepositoryFixture
+{
+};
+
+TEST_F(ReferencesTests, looseRefs)
+{
+    const auto commitsManager = repository->CommitsManager();
+    const auto referencesManager = CppGit::_details::ReferencesManager{ *repository };
+
+    const auto commitHash = commitsManager.createCommit("Initial commit");
+    referencesManager.createRef("refs/heads/branch", commitHash);
+    const auto commandsCountBefore = repository->getCommandMetrics().getTotalCount();
+
+
+    EXPECT_EQ(referencesManager.getRefHash("HEAD"), commitHash);
+    EXPECT_EQ(referencesManager.getRefHash("branch"), commitHash);
+    EXPECT_EQ(referencesManager.getRefHash("refs/heads/branch"), commitHash);
+    EXPECT_EQ(referencesManager.getRefHash(commitHash), commitHash);
+    EXPECT_EQ(referencesManager.getSymbolicRef("HEAD"), "refs/heads/main");
+    EXPECT_TRUE(referencesManager.refExists("HEAD"));
+    EXPECT_TRUE(referencesManager.refExists("refs/heads/branch"));
+    EXPECT_FALSE(referencesManager.refExists("refs/heads/notExisting"));
+    EXPECT_FALSE(referencesManager.refExists("refs/heads"));
+    EXPECT_EQ(repository->getCommandMetrics().getTotalCount(), commandsCountBefore);
+}
+
+TEST_F(ReferencesTests, packedRefs)
+{
+    const auto commitsManager = repository->CommitsManager();
+    const auto referencesManager = CppGit::_details::ReferencesManager{ *repository };
+
+    const auto initialCommitHash = commitsManager.createCommit("Initial commit");
+    const auto secondCommitHash = commitsManager.createCommit("Second commit");
+    for (auto i = 0; i < 100; ++i)
+    {
+        referencesManager.createRef("refs/heads/branch" + std::to_string(i), (i % 2 == 0 ? initialCommitHash : secondCommitHash));
+    }
+    repository->executeGitCommand("tag", "-a", "-m", "Tag message", "annotated_tag", initialCommitHash);
+    repository->executeGitCommand("pack-refs", "--all", "--prune");
+    const auto tagHash = repository->executeGitCommand("rev-parse", "refs/tags/annotated_tag").stdout;
+    const auto commandsCountBefore = repository->getCommandMetrics().getTotalCount();
+
+
+    for (auto i = 0; i < 100; ++i)
+    {
+        const auto refName = "refs/heads/branch" + std::to_string(i);
+        EXPECT_EQ(referencesManager.getRefHash(refName), (i % 2 == 0 ? initialCommitHash : secondCommitHash));
+        EXPECT_TRUE(referencesManager.refExists(refName));
+    }
+    EXPECT_EQ(referencesManager.getRefHash("main"), secondCommitHash);
+    EXPECT_EQ(referencesManager.getRefHash("HEAD"), secondCommitHash);
+    EXPECT_EQ(referencesManager.getRefHash("annotated_tag"), tagHash);
+    EXPECT_FALSE(referencesManager.refExists("refs/heads/branch100"));
+    EXPECT_FALSE(referencesManager.refExists("refs/heads/a"));
+    EXPECT_FALSE(referencesManager.refExists("refs/heads/z"));
+    EXPECT_EQ(repository->getCommandMetrics().getTotalCount(), commandsCountBefore);
+}
+
+TEST_F(ReferencesTests, looseRefOverridesPackedRef)
+{
+    const auto commitsManager = repository->CommitsManager();
+    const auto referencesManager = CppGit::_details::ReferencesManager{ *repository };
+
+    const auto initialCommitHash = commitsManager.createCommit("Initial commit");
+    referencesManager.createRef("refs/heads/branch", initialCommitHash);
+    repository->executeGitCommand("pack-refs", "--all", "--prune");
+    const auto secondCommitHash = commitsManager.createCommit("Second commit");
+    referencesManager.updateRefHash("refs/heads/branch", secondCommitHash);
+
+
+    EXPECT_EQ(referencesManager.getRefHash("branch"), secondCommitHash);
+}
+
+TEST_F(ReferencesTests, symbolicRef_detachedHead)
+{
+    const auto commitsManager = repository->CommitsManager();
+    const auto referencesManager = CppGit::_details::ReferencesManager{ *repository };
+
+    const auto commitHash = commitsManager.createCommit("Initial commit");
+    referencesManager.detachHead(commitHash);
+
+
+    EXPECT_EQ(referencesManager.getSymbolicRef("HEAD"), "");
+    EXPECT_EQ(referencesManager.getRefHash("HEAD"), commitHash);
+}
+
+TEST_F(ReferencesTests, revisionExpressionResolvedByGit)
+{
+    const auto commitsManager = repository->CommitsManager();
+    const auto referencesManager = CppGit::_details::ReferencesManager{ *repository };
+
+    const auto initialCommitHash = commitsManager.createCommit("Initial commit");
+    commitsManager.createCommit("Second commit");
+
+
+    EXPECT_EQ(referencesManager.getRefHash("HEAD~1"), initialCommitHash);
+    EXPECT_EQ(referencesManager.getRefHash(initialCommitHash.substr(0, 10)), initialCommitHash);
+}
@@ -0,0 +1,125 @@
+#include "BaseRepositoryFixture.hpp"
+
+#include <CppGit/CommitsManager.hpp>
+#include <CppGit/Repository.hpp>
+#include <CppGit/_details/ReferencesManager.hpp>
+#include <CppGit/_details/RepositoryContext.hpp>
+#include <filesystem>
+#include <gtest/gtest.h>
+
+class RepositoryContextTests : public BaseRepositoryFixture
+{
+};
+
+TEST_F(RepositoryContextTests, discoveredWithoutGit)
+{
+    const auto canonicalRepositoryPath = std::filesystem::canonical(repositoryPath);
+    const auto gitTopLevelPath = repository->executeGitCommand("rev-parse", "--show-toplevel").stdout;
+    repository->invalidateRepositoryContext();
+    const auto commandsCountBefore = repository->getCommandMetrics().getTotalCount();
+
+
+    EXPECT_EQ(repository->getTopLevelPath(), gitTopLevelPath);
+    EXPECT_EQ(repository->getTopLevelPath(), canonicalRepositoryPath);
+    EXPECT_EQ(repository->getGitDirectoryPath(), canonicalRepositoryPath / ".git");
+    EXPECT_EQ(repository->getCommonDirectoryPath(), canonicalRepositoryPath / ".git");
+    EXPECT_EQ(repository->getObjectFormat(), "sha1");
+    EXPECT_EQ(repository->getCommandMetrics().getTotalCount(), commandsCountBefore);
+}
+
+TEST_F(RepositoryContextTests, subdirectory)
+{
+    std::filesystem::create_directories(repositoryPath / "dir" / "subdir");
+
+
+    const auto subdirectoryRepository = CppGit::Repository{ repositoryPath / "dir" / "subdir" };
+
+
+    EXPECT_EQ(subdirectoryRepository.getTopLevelPath(), std::filesystem::canonical(repositoryPath));
+    EXPECT_EQ(subdirectoryRepository.getGitDirectoryPath(), std::filesystem::canonical(repositoryPath) / ".git");
+}
+
+TEST_F(RepositoryContextTests, linkedWorktree)
+{
+    const auto commitHash = repository->CommitsManager().createCommit("Initial commit");
+    repository->executeGitCommand("worktree", "add", "-b", "worktree_branch", "worktree");
+    const auto canonicalRepositoryPath = std::filesystem::canonical(repositoryPath);
+
+
+    const auto worktreeRepository = CppGit::Repository{ repositoryPath / "worktree" };
+    const auto referencesManager = CppGit::_details::ReferencesManager{ worktreeRepository };
+
+
+    EXPECT_EQ(worktreeRepository.getTopLevelPath(), canonicalRepositoryPath / "worktree");
+    EXPECT_EQ(worktreeRepository.getGitDirectoryPath(), canonicalRepositoryPath / ".git" / "worktrees" / "worktree");
+    EXPECT_EQ(worktreeRepository.getCommonDirectoryPath(), canonicalRepositoryPath / ".git");
+    EXPECT_EQ(referencesManager.getSymbolicRef("HEAD"), "refs/heads/worktree_branch");
+    EXPECT_EQ(referencesManager.getRefHash("HEAD"), commitHash);
+    EXPECT_EQ(referencesManager.getRefHash("main"), commitHash);
+}
+
+TEST_F(RepositoryContextTests, worktreeConfig_fallsBackToGit)
+{
+    repository->executeGitCommand("config", "extensions.worktreeConfig", "true");
+    repository->executeGitCommand("config", "--worktree", "core.bare", "true");
+
+
+    const auto context = CppGit::_details::discoverRepositoryContext(repositoryPath);
+
+
+    EXPECT_FALSE(context.has_value());
+    EXPECT_EQ(repository->executeGitCommand("rev-parse", "--is-bare-repository").stdout, "true");
+}
+
+TEST_F(RepositoryContextTests, configInclude_fallsBackToGit)
+{
+    repository->executeGitCommand("config", "include.path", "included.config");
+
+
+    const auto context = CppGit::_details::discoverRepositoryContext(repositoryPath);
+
+
+    EXPECT_FALSE(context.has_value());
+}
+
+TEST_F(RepositoryContextTests, bareRepository)
+{
+    const auto bareRepository = CppGit::Repository{ repositoryPath / "bare.git" };
+    bareRepository.initRepository(true);
+
+
+    EXPECT_EQ(bareRepository.getTopLevelPath(), "");
+    EXPECT_EQ(bareRepository.getGitDirectoryPath(), std::filesystem::canonical(repositoryPath / "bare.git"));
+    EXPECT_EQ(bareRepository.getCommonDirectoryPath(), std::filesystem::canonical(repositoryPath / "bare.git"));
+}
+
+TEST_F(RepositoryContextTests, invalidation)
+{
+    auto nestedRepository = CppGit::Repository{ repositoryPath / "nested" };
+    std::filesystem::create_directory(repositoryPath / "nested");
+    ASSERT_EQ(nestedRepository.getTopLevelPath(), std::filesystem::canonical(repositoryPath));
+    repository->executeGitCommand("init", "nested");
+
+
+    const auto cachedTopLevelPath = nestedRepository.getTopLevelPath();
+    nestedRepository.invalidateRepositoryContext();
+    const auto invalidatedTopLevelPath = nestedRepository.getTopLevelPath();
+
+
+    EXPECT_EQ(cachedTopLevelPath, std::filesystem::canonical(repositoryPath));
+    EXPECT_EQ(invalidatedTopLevelPath, std::filesystem::canonical(repositoryPath / "nested"));
+}
+
+TEST_F(RepositoryContextTests, validation)
+{
+    auto nestedRepository = CppGit::Repository{ repositoryPath / "nested" };
+    repository->executeGitCommand("init", "nested");
+    ASSERT_EQ(nestedRepository.getTopLevelPath(), std::filesystem::canonical(repositoryPath / "nested"));
+
+
+    nestedRepository.setRepositoryContextValidation(true);
+    std::filesystem::remove_all(repositoryPath / "nested" / ".git");
+
+
+    EXPECT_EQ(nestedRepository.getTopLevelPath(), std::filesystem::canonical(repositoryPath));
+}
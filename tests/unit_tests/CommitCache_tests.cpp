@@ -0,0 +1,90 @@
+#include <CppGit/Commit.hpp>
+#include <CppGit/ObjectId.hpp>
+#include <CppGit/_details/CommitCache.hpp>
+#include <gtest/gtest.h>
+#include <string>
+
+namespace {
+
+auto createCommit(const std::string& hash, const std::string& message) -> CppGit::Commit
+{
+    return CppGit::Commit{ hash, {}, "Author", "author@email.com", "1722791195 +0200", "Author", "author@email.com", "1722791195 +0200", message, "", "4b825dc642cb6eb9a060e54bf8d69288fbee4904" };
+}
+
+} // namespace
+
+TEST(CommitCacheTests, hitAndMiss)
+{
+    auto commitCache = CppGit::CommitCache{};
+    const auto commitId = CppGit::ObjectId::fromHex("8120cca3edbd848e900b41d3d217ca2803dd0e74");
+
+    EXPECT_FALSE(commitCache.get(commitId).has_value());
+    commitCache.insert(createCommit("8120cca3edbd848e900b41d3d217ca2803dd0e74", "message"));
+    const auto cachedCommit = commitCache.get(commitId);
+
+    ASSERT_TRUE(cachedCommit.has_value());
+    EXPECT_EQ(cachedCommit->getHash(), "8120cca3edbd848e900b41d3d217ca2803dd0e74");
+    EXPECT_EQ(cachedCommit->getMessage(), "message");
+    const auto statistics = commitCache.getStatistics();
+    EXPECT_EQ(statistics.hits, 1);
+    EXPECT_EQ(statistics.misses, 1);
+    EXPECT_EQ(statistics.size, 1);
+    EXPECT_GT(statistics.memoryUsage, 0);
+}
+
+TEST(CommitCacheTests, commitWithoutId)
+{
+    auto commitCache = CppGit::CommitCache{};
+
+    commitCache.insert(createCommit("", "message"));
+
+    EXPECT_EQ(commitCache.getStatistics().size, 0);
+}
+
+TEST(CommitCacheTests, evictLeastRecentlyUsed)
+{
+    auto commitCache = CppGit::CommitCache{};
+    commitCache.insert(createCommit("1111111111111111111111111111111111111111", "first"));
+    const auto commitMemoryUsage = commitCache.getStatistics().memoryUsage;
+    commitCache.setMemoryBudget(commitMemoryUsage * 2);
+    commitCache.insert(createCommit("2222222222222222222222222222222222222222", "second"));
+
+    static_cast<void>(commitCache.get(CppGit::ObjectId::fromHex("1111111111111111111111111111111111111111")));
+    commitCache.insert(createCommit("3333333333333333333333333333333333333333", "third"));
+
+    EXPECT_TRUE(commitCache.get(CppGit::ObjectId::fromHex("1111111111111111111111111111111111111111")).has_value());
+    EXPECT_FALSE(commitCache.get(CppGit::ObjectId::fromHex("2222222222222222222222222222222222222222")).has_value());
+    EXPECT_TRUE(commitCache.get(CppGit::ObjectId::fromHex("3333333333333333333333333333333333333333")).has_value());
+    const auto statistics = commitCache.getStatistics();
+    EXPECT_EQ(statistics.size, 2);
+    EXPECT_EQ(statistics.evictions, 1);
+    EXPECT_LE(statistics.memoryUsage, commitCache.getMemoryBudget());
+}
+
+TEST(CommitCacheTests, zeroBudgetDisablesCache)
+{
+    auto commitCache = CppGit::CommitCache{};
+    commitCache.insert(createCommit("1111111111111111111111111111111111111111", "first"));
+
+    commitCache.setMemoryBudget(0);
+    commitCache.insert(createCommit("2222222222222222222222222222222222222222", "second"));
+
+    const auto statistics = commitCache.getStatistics();
+    EXPECT_EQ(statistics.size, 0);
+    EXPECT_EQ(statistics.memoryUsage, 0);
+    EXPECT_EQ(statistics.evictions, 1);
+}
+
+TEST(CommitCacheTests, clear)
+{
+    auto commitCache = CppGit::CommitCache{};
+    commitCache.insert(createCommit("1111111111111111111111111111111111111111", "first"));
+    static_cast<void>(commitCache.get(CppGit::ObjectId::fromHex("1111111111111111111111111111111111111111")));
+
+    commitCache.clear();
+
+    const auto statistics = commitCache.getStatistics();
+    EXPECT_EQ(statistics.size, 0);
+    EXPECT_EQ(statistics.hits, 0);
+    EXPECT_FALSE(commitCache.get(CppGit::ObjectId::fromHex("1111111111111111111111111111111111111111")).has_value());
+}
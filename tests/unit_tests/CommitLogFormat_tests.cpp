@@ -0,0 +1,93 @@
+#include <CppGit/_details/Parser/CommitLogFormat.hpp>
+#include <gtest/gtest.h>
+#include <string>
+#include <vector>
+
+using CppGit::CommitLogField;
+
+TEST(CommitLogFormatTests, prettyFormat)
+{
+    using Format = CppGit::CommitLogFormat<CommitLogField::HASH, CommitLogField::PARENTS, CommitLogField::AUTHOR_NAME, CommitLogField::DESCRIPTION>;
+
+    static_assert(Format::getPrettyFormat() == "%H%x1f%P%x1f%an%x1f%b");
+    EXPECT_EQ(Format::getPrettyFormat(), "%H%x1f%P%x1f%an%x1f%b");
+}
+
+TEST(CommitLogFormatTests, parseAllFields)
+{
+    using Format = CppGit::CommitLogFormat<CommitLogField::HASH,
+                                           CommitLogField::PARENTS,
+                                           CommitLogField::AUTHOR_NAME,
+                                           CommitLogField::AUTHOR_EMAIL,
+                                           CommitLogField::AUTHOR_DATE,
+                                           CommitLogField::COMMITTER_NAME,
+                                           CommitLogField::COMMITTER_EMAIL,
+                                           CommitLogField::COMMITTER_DATE,
+                                           CommitLogField::TREE_HASH,
+                                           CommitLogField::MESSAGE,
+                                           CommitLogField::DESCRIPTION>;
+    const auto commitLog = std::string{ "8120cca3edbd848e900b41d3d217ca2803dd0e74\x1f"
+                                        "1d89a1850b82787e2766aa3c724048fc74ea4fbc 180cf8328022becee9aaa2577a8f84ea2b9f3827\x1f"
+                                        "Author Name\x1f"
+                                        "author@email.com\x1f"
+                                        "1722791195 +0200\x1f"
+                                        "Committer Name\x1f"
+                                        "committer@email.com\x1f"
+                                        "1722791196 +0200\x1f"
+                                        "4b825dc642cb6eb9a060e54bf8d69288fbee4904\x1f"
+                                        "Message; with; semicolons\x1f"
+                                        "Description\n\nSecond paragraph\n" };
+
+    const auto commit = Format::parse(commitLog);
+
+    EXPECT_EQ(commit.getHash(), "8120cca3edbd848e900b41d3d217ca2803dd0e74");
+    const auto expectedParents = std::vector<std::string>{ "1d89a1850b82787e2766aa3c724048fc74ea4fbc", "180cf8328022becee9aaa2577a8f84ea2b9f3827" };
+    EXPECT_EQ(commit.getParents(), expectedParents);
+    EXPECT_EQ(commit.getAuthor().name, "Author Name");
+    EXPECT_EQ(commit.getAuthor().email, "author@email.com");
+    EXPECT_EQ(commit.getAuthorDate(), "1722791195 +0200");
+    EXPECT_EQ(commit.getCommitter().name, "Committer Name");
+    EXPECT_EQ(commit.getCommitter().email, "committer@email.com");
+    EXPECT_EQ(commit.getCommitterDate(), "1722791196 +0200");
+    EXPECT_EQ(commit.getTreeHash(), "4b825dc642cb6eb9a060e54bf8d69288fbee4904");
+    EXPECT_EQ(commit.getMessage(), "Message; with; semicolons");
+    EXPECT_EQ(commit.getDescription(), "Description\n\nSecond paragraph");
+}
+
+TEST(CommitLogFormatTests, parseSomeFields)
+{
+    using Format = CppGit::CommitLogFormat<CommitLogField::MESSAGE, CommitLogField::HASH>;
+
+    const auto commit = Format::parse("Message\x1f"
+                                      "8120cca3edbd848e900b41d3d217ca2803dd0e74");
+
+    EXPECT_EQ(commit.getHash(), "8120cca3edbd848e900b41d3d217ca2803dd0e74");
+    EXPECT_EQ(commit.getMessage(), "Message");
+    EXPECT_EQ(commit.getParents().size(), 0);
+    EXPECT_EQ(commit.getAuthor().name, "");
+    EXPECT_EQ(commit.getDescription(), "");
+}
+
+TEST(CommitLogFormatTests, parseMissingFields)
+{
+    using Format = CppGit::CommitLogFormat<CommitLogField::HASH, CommitLogField::PARENTS, CommitLogField::MESSAGE>;
+
+    const auto commit = Format::parse("8120cca3edbd848e900b41d3d217ca2803dd0e74");
+
+    EXPECT_EQ(commit.getHash(), "8120cca3edbd848e900b41d3d217ca2803dd0e74");
+    EXPECT_EQ(commit.getParents().size(), 0);
+    EXPECT_EQ(commit.getMessage(), "");
+}
+
+TEST(CommitLogFormatTests, parseRawMessage)
+{
+    using Format = CppGit::CommitLogFormat<CommitLogField::HASH, CommitLogField::RAW_MESSAGE>;
+    const auto commitLog = std::string{ "8120cca3edbd848e900b41d3d217ca2803dd0e74\x1f"
+                                        "Message\nin two lines\n\n\nDescription\n\nSecond paragraph\n" };
+
+    const auto commit = Format::parse(commitLog);
+
+    EXPECT_EQ(Format::getPrettyFormat(), "%H%x1f%B");
+    EXPECT_EQ(commit.getMessage(), "Message\nin two lines");
+    EXPECT_EQ(commit.getDescription(), "Description\n\nSecond paragraph");
+}
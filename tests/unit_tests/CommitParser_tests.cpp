@@ -1,6 +1,10 @@
+#include <CppGit/ObjectId.hpp>
 #include <CppGit/Signature.hpp>
+#include <CppGit/Timestamp.hpp>
 #include <CppGit/_details/Parser/CommitParser.hpp>
 #include <gtest/gtest.h>
+#include <stdexcept>
+#include <string>
 
 TEST(CommitParserTests, parseCatfile_onlySingleLineMsg)
 {
@@ -162,44 +166,138 @@ msg msg msg)";
 }
 
 
+TEST(CommitParserTests, parseCatfile_withExtraHeaders)
+{
+    constexpr auto commit = R"(tree 4b825dc642cb6eb9a060e54bf8d69288fbee4904
+parent 8120cca3edbd848e900b41d3d217ca2803dd0e74
+parent 8120cca3edbd848e900b41d3d217ca2803dd0e75
+author Firstauthor Secondauthor <author@email.com> 1722791195 +0200
+committer Firstcommiter Secondcommiter <committer@email.com> 1722791195 +0200
+encoding ISO-8859-1
+mergetag object 8120cca3edbd848e900b41d3d217ca2803dd0e75
+ type commit
+ tag v1.0
+ tagger Firstauthor Secondauthor <author@email.com> 1722791195 +0200
+ 
+ Release
+gpgsig -----BEGIN PGP SIGNATURE-----
+ 
+ iQEzBAABCAAdFiEE
+ -----END PGP SIGNATURE-----
+
+msg msg msg
+
+desc)";
+
+    const CppGit::Commit parsedCommit = CppGit::CommitParser::parseCommit_CatFile(commit);
+    const CppGit::Signature& author = parsedCommit.getAuthor();
+    const CppGit::Signature& committer = parsedCommit.getCommitter();
+
+    EXPECT_EQ(parsedCommit.getTreeHash(), "4b825dc642cb6eb9a060e54bf8d69288fbee4904");
+    ASSERT_EQ(parsedCommit.getParents().size(), 2);
+    EXPECT_EQ(parsedCommit.getParents()[1], "8120cca3edbd848e900b41d3d217ca2803dd0e75");
+    EXPECT_EQ(author.name, "Firstauthor Secondauthor");
+    EXPECT_EQ(author.email, "author@email.com");
+    EXPECT_EQ(parsedCommit.getAuthorDate(), "1722791195 +0200");
+    EXPECT_EQ(committer.name, "Firstcommiter Secondcommiter");
+    EXPECT_EQ(committer.email, "committer@email.com");
+    EXPECT_EQ(parsedCommit.getCommitterDate(), "1722791195 +0200");
+    EXPECT_EQ(parsedCommit.getMessage(), "msg msg msg");
+    EXPECT_EQ(parsedCommit.getDescription(), "desc");
+}
+
+TEST(CommitParserTests, parseCatfileBatch)
+{
+    const auto firstCommit = std::string{ "tree 4b825dc642cb6eb9a060e54bf8d69288fbee4904\n"
+                                          "author Firstauthor <author@email.com> 1722791195 +0200\n"
+                                          "committer Firstcommiter <committer@email.com> 1722791195 +0200\n"
+                                          "\n"
+                                          "first\n" };
+    const auto secondCommit = std::string{ "tree 4b825dc642cb6eb9a060e54bf8d69288fbee4904\n"
+                                           "parent 8120cca3edbd848e900b41d3d217ca2803dd0e74\n"
+                                           "author Firstauthor <author@email.com> 1722791196 +0200\n"
+                                           "committer Firstcommiter <committer@email.com> 1722791196 +0200\n"
+                                           "\n"
+                                           "second\n\ndesc\n" };
+    const auto blob = std::string{ "tree 4b825dc642cb6eb9a060e54bf8d69288fbee4904\n" };
+    const auto batchOutput = "8120cca3edbd848e900b41d3d217ca2803dd0e74 commit " + std::to_string(firstCommit.size()) + "\n" + firstCommit + "\n"
+                           + "HEAD~5 missing\n"
+                           + "180cf8328022becee9aaa2577a8f84ea2b9f3827 blob " + std::to_string(blob.size()) + "\n" + blob + "\n"
+                           + "1d89a1850b82787e2766aa3c724048fc74ea4fbc commit " + std::to_string(secondCommit.size()) + "\n" + secondCommit + "\n";
+
+    const auto commits = CppGit::CommitParser::parseCommits_CatFileBatch(batchOutput);
+
+    ASSERT_EQ(commits.size(), 2);
+    EXPECT_EQ(commits[0].getHash(), "8120cca3edbd848e900b41d3d217ca2803dd0e74");
+    EXPECT_EQ(commits[0].getParents().size(), 0);
+    EXPECT_EQ(commits[0].getAuthor().name, "Firstauthor");
+    EXPECT_EQ(commits[0].getMessage(), "first");
+    EXPECT_EQ(commits[0].getDescription(), "");
+    EXPECT_EQ(commits[1].getHash(), "1d89a1850b82787e2766aa3c724048fc74ea4fbc");
+    ASSERT_EQ(commits[1].getParents().size(), 1);
+    EXPECT_EQ(commits[1].getParents()[0], "8120cca3edbd848e900b41d3d217ca2803dd0e74");
+    EXPECT_EQ(commits[1].getCommitterDate(), "1722791196 +0200");
+    EXPECT_EQ(commits[1].getMessage(), "second");
+    EXPECT_EQ(commits[1].getDescription(), "desc");
+}
+
+TEST(CommitParserTests, parseCatfileBatch_sharedSignatures)
+{
+    const auto commitContent = std::string{ "tree 4b825dc642cb6eb9a060e54bf8d69288fbee4904\n"
+                                            "author Firstauthor <author@email.com> 1722791195 +0200\n"
+                                            "committer Firstauthor <author@email.com> 1722791195 +0200\n"
+                                            "\n"
+                                            "message\n" };
+    const auto batchOutput = "8120cca3edbd848e900b41d3d217ca2803dd0e74 commit " + std::to_string(commitContent.size()) + "\n" + commitContent + "\n"
+                           + "1d89a1850b82787e2766aa3c724048fc74ea4fbc commit " + std::to_string(commitContent.size()) + "\n" + commitContent + "\n";
+
+    const auto commits = CppGit::CommitParser::parseCommits_CatFileBatch(batchOutput);
+
+    ASSERT_EQ(commits.size(), 2);
+    EXPECT_EQ(&commits[0].getAuthor(), &commits[0].getCommitter());
+    EXPECT_EQ(&commits[0].getAuthor(), &commits[1].getAuthor());
+    EXPECT_EQ(commits[1].getAuthorTimestamp(), (CppGit::Timestamp{ .secondsSinceEpoch = 1722791195, .timezoneOffsetMinutes = 120 }));
+    EXPECT_EQ(commits[1].getTreeId(), CppGit::ObjectId::fromHex("4b825dc642cb6eb9a060e54bf8d69288fbee4904"));
+}
+
 TEST(CommitParserTests, parseFormat_defaultFormat_fullCommit)
 {
-    const std::string commitLog = "hash;parent1 parent2;authorName;authorEmail;authorDate;committerName;committerEmail;committerDate;message;description";
+    const std::string commitLog = "8c2c3ebb2aa6d3a9b4e1b49b0f7e3a6e57a7ba32;e1d1a5fd3ab1e1dd74c15b8a0e9ab1ea21f2e2bb 5e5a0a3b4b6c1d2e3f405162738495a6b7c8d9e0;authorName;authorEmail;1722791195 +0200;committerName;committerEmail;1722791196 -0130;message;description";
     const CppGit::Commit commit = CppGit::CommitParser::parseCommit_PrettyFormat(commitLog);
     const auto& authorSignature = commit.getAuthor();
     const auto& committerSignature = commit.getCommitter();
 
-    EXPECT_EQ(commit.getHash(), "hash");
+    EXPECT_EQ(commit.getHash(), "8c2c3ebb2aa6d3a9b4e1b49b0f7e3a6e57a7ba32");
     EXPECT_EQ(commit.getParents().size(), 2);
-    EXPECT_EQ(commit.getParents()[0], "parent1");
-    EXPECT_EQ(commit.getParents()[1], "parent2");
+    EXPECT_EQ(commit.getParents()[0], "e1d1a5fd3ab1e1dd74c15b8a0e9ab1ea21f2e2bb");
+    EXPECT_EQ(commit.getParents()[1], "5e5a0a3b4b6c1d2e3f405162738495a6b7c8d9e0");
     EXPECT_EQ(authorSignature.name, "authorName");
     EXPECT_EQ(authorSignature.email, "authorEmail");
-    EXPECT_EQ(commit.getAuthorDate(), "authorDate");
+    EXPECT_EQ(commit.getAuthorDate(), "1722791195 +0200");
     EXPECT_EQ(committerSignature.name, "committerName");
     EXPECT_EQ(committerSignature.email, "committerEmail");
-    EXPECT_EQ(commit.getCommitterDate(), "committerDate");
+    EXPECT_EQ(commit.getCommitterDate(), "1722791196 -0130");
     EXPECT_EQ(commit.getMessage(), "message");
     EXPECT_EQ(commit.getDescription(), "description");
     EXPECT_EQ(commit.getMessageAndDescription(), "message\n\ndescription");
 }
 TEST(CommitParserTests, parseFormat_defaultFormat_fullCommit_multiLineDescription)
 {
-    const std::string commitLog = "hash;parent1 parent2;authorName;authorEmail;authorDate;committerName;committerEmail;committerDate;message;description\nline1\nline2";
+    const std::string commitLog = "8c2c3ebb2aa6d3a9b4e1b49b0f7e3a6e57a7ba32;e1d1a5fd3ab1e1dd74c15b8a0e9ab1ea21f2e2bb 5e5a0a3b4b6c1d2e3f405162738495a6b7c8d9e0;authorName;authorEmail;1722791195 +0200;committerName;committerEmail;1722791196 -0130;message;description\nline1\nline2";
     const CppGit::Commit commit = CppGit::CommitParser::parseCommit_PrettyFormat(commitLog);
     const auto& authorSignature = commit.getAuthor();
     const auto& committerSignature = commit.getCommitter();
 
-    EXPECT_EQ(commit.getHash(), "hash");
+    EXPECT_EQ(commit.getHash(), "8c2c3ebb2aa6d3a9b4e1b49b0f7e3a6e57a7ba32");
     EXPECT_EQ(commit.getParents().size(), 2);
-    EXPECT_EQ(commit.getParents()[0], "parent1");
-    EXPECT_EQ(commit.getParents()[1], "parent2");
+    EXPECT_EQ(commit.getParents()[0], "e1d1a5fd3ab1e1dd74c15b8a0e9ab1ea21f2e2bb");
+    EXPECT_EQ(commit.getParents()[1], "5e5a0a3b4b6c1d2e3f405162738495a6b7c8d9e0");
     EXPECT_EQ(authorSignature.name, "authorName");
     EXPECT_EQ(authorSignature.email, "authorEmail");
-    EXPECT_EQ(commit.getAuthorDate(), "authorDate");
+    EXPECT_EQ(commit.getAuthorDate(), "1722791195 +0200");
     EXPECT_EQ(committerSignature.name, "committerName");
     EXPECT_EQ(committerSignature.email, "committerEmail");
-    EXPECT_EQ(commit.getCommitterDate(), "committerDate");
+    EXPECT_EQ(commit.getCommitterDate(), "1722791196 -0130");
     EXPECT_EQ(commit.getMessage(), "message");
     EXPECT_EQ(commit.getDescription(), "description\nline1\nline2");
     EXPECT_EQ(commit.getMessageAndDescription(), "message\n\ndescription\nline1\nline2");
@@ -207,20 +305,20 @@ TEST(CommitParserTests, parseFormat_defaultFormat_fullCommit_multiLineDescriptio
 
 TEST(CommitParserTests, parseFormat_defaultFormat_fullCommit_singleParent)
 {
-    const std::string commitLog = "hash;parent1;authorName;authorEmail;authorDate;committerName;committerEmail;committerDate;message;description";
+    const std::string commitLog = "8c2c3ebb2aa6d3a9b4e1b49b0f7e3a6e57a7ba32;e1d1a5fd3ab1e1dd74c15b8a0e9ab1ea21f2e2bb;authorName;authorEmail;1722791195 +0200;committerName;committerEmail;1722791196 -0130;message;description";
     const CppGit::Commit commit = CppGit::CommitParser::parseCommit_PrettyFormat(commitLog);
     const auto& authorSignature = commit.getAuthor();
     const auto& committerSignature = commit.getCommitter();
 
-    EXPECT_EQ(commit.getHash(), "hash");
+    EXPECT_EQ(commit.getHash(), "8c2c3ebb2aa6d3a9b4e1b49b0f7e3a6e57a7ba32");
     EXPECT_EQ(commit.getParents().size(), 1);
-    EXPECT_EQ(commit.getParents()[0], "parent1");
+    EXPECT_EQ(commit.getParents()[0], "e1d1a5fd3ab1e1dd74c15b8a0e9ab1ea21f2e2bb");
     EXPECT_EQ(authorSignature.name, "authorName");
     EXPECT_EQ(authorSignature.email, "authorEmail");
-    EXPECT_EQ(commit.getAuthorDate(), "authorDate");
+    EXPECT_EQ(commit.getAuthorDate(), "1722791195 +0200");
     EXPECT_EQ(committerSignature.name, "committerName");
     EXPECT_EQ(committerSignature.email, "committerEmail");
-    EXPECT_EQ(commit.getCommitterDate(), "committerDate");
+    EXPECT_EQ(commit.getCommitterDate(), "1722791196 -0130");
     EXPECT_EQ(commit.getMessage(), "message");
     EXPECT_EQ(commit.getDescription(), "description");
     EXPECT_EQ(commit.getMessageAndDescription(), "message\n\ndescription");
@@ -228,19 +326,19 @@ TEST(CommitParserTests, parseFormat_defaultFormat_fullCommit_singleParent)
 
 TEST(CommitParserTests, parseFormat_defaultFormat_noParents)
 {
-    const std::string commitLog = "hash;;authorName;authorEmail;authorDate;committerName;committerEmail;committerDate;message;description";
+    const std::string commitLog = "8c2c3ebb2aa6d3a9b4e1b49b0f7e3a6e57a7ba32;;authorName;authorEmail;1722791195 +0200;committerName;committerEmail;1722791196 -0130;message;description";
     const CppGit::Commit commit = CppGit::CommitParser::parseCommit_PrettyFormat(commitLog);
     const auto& authorSignature = commit.getAuthor();
     const auto& committerSignature = commit.getCommitter();
 
-    EXPECT_EQ(commit.getHash(), "hash");
+    EXPECT_EQ(commit.getHash(), "8c2c3ebb2aa6d3a9b4e1b49b0f7e3a6e57a7ba32");
     EXPECT_EQ(commit.getParents().size(), 0);
     EXPECT_EQ(authorSignature.name, "authorName");
     EXPECT_EQ(authorSignature.email, "authorEmail");
-    EXPECT_EQ(commit.getAuthorDate(), "authorDate");
+    EXPECT_EQ(commit.getAuthorDate(), "1722791195 +0200");
     EXPECT_EQ(committerSignature.name, "committerName");
     EXPECT_EQ(committerSignature.email, "committerEmail");
-    EXPECT_EQ(commit.getCommitterDate(), "committerDate");
+    EXPECT_EQ(commit.getCommitterDate(), "1722791196 -0130");
     EXPECT_EQ(commit.getMessage(), "message");
     EXPECT_EQ(commit.getDescription(), "description");
     EXPECT_EQ(commit.getMessageAndDescription(), "message\n\ndescription");
@@ -248,21 +346,21 @@ TEST(CommitParserTests, parseFormat_defaultFormat_noParents)
 
 TEST(CommitParserTests, parseFormat_defaultFormat_noDescription)
 {
-    const std::string commitLog = "hash;parent1 parent2;authorName;authorEmail;authorDate;committerName;committerEmail;committerDate;message;";
+    const std::string commitLog = "8c2c3ebb2aa6d3a9b4e1b49b0f7e3a6e57a7ba32;e1d1a5fd3ab1e1dd74c15b8a0e9ab1ea21f2e2bb 5e5a0a3b4b6c1d2e3f405162738495a6b7c8d9e0;authorName;authorEmail;1722791195 +0200;committerName;committerEmail;1722791196 -0130;message;";
     const CppGit::Commit commit = CppGit::CommitParser::parseCommit_PrettyFormat(commitLog);
     const auto& authorSignature = commit.getAuthor();
     const auto& committerSignature = commit.getCommitter();
 
-    EXPECT_EQ(commit.getHash(), "hash");
+    EXPECT_EQ(commit.getHash(), "8c2c3ebb2aa6d3a9b4e1b49b0f7e3a6e57a7ba32");
     EXPECT_EQ(commit.getParents().size(), 2);
-    EXPECT_EQ(commit.getParents()[0], "parent1");
-    EXPECT_EQ(commit.getParents()[1], "parent2");
+    EXPECT_EQ(commit.getParents()[0], "e1d1a5fd3ab1e1dd74c15b8a0e9ab1ea21f2e2bb");
+    EXPECT_EQ(commit.getParents()[1], "5e5a0a3b4b6c1d2e3f405162738495a6b7c8d9e0");
     EXPECT_EQ(authorSignature.name, "authorName");
     EXPECT_EQ(authorSignature.email, "authorEmail");
-    EXPECT_EQ(commit.getAuthorDate(), "authorDate");
+    EXPECT_EQ(commit.getAuthorDate(), "1722791195 +0200");
     EXPECT_EQ(committerSignature.name, "committerName");
     EXPECT_EQ(committerSignature.email, "committerEmail");
-    EXPECT_EQ(commit.getCommitterDate(), "committerDate");
+    EXPECT_EQ(commit.getCommitterDate(), "1722791196 -0130");
     EXPECT_EQ(commit.getMessage(), "message");
     EXPECT_EQ(commit.getDescription(), "");
     EXPECT_EQ(commit.getMessageAndDescription(), "message");
@@ -309,3 +407,21 @@ TEST(CommitParserTests, parseFormat_customFormat)
     EXPECT_EQ(commit.getDescription(), "");
     EXPECT_EQ(commit.getMessageAndDescription(), "message");
 }
+
+TEST(CommitParserTests, parseFormat_notRawDate)
+{
+    EXPECT_THROW(static_cast<void>(CppGit::CommitParser::parseCommit_PrettyFormat("8c2c3ebb2aa6d3a9b4e1b49b0f7e3a6e57a7ba32;2024-08-04 17:06:35 +0200", "%H;%ai", ";")), std::runtime_error);
+    EXPECT_THROW(static_cast<void>(CppGit::CommitParser::parseCommit_PrettyFormat("8c2c3ebb2aa6d3a9b4e1b49b0f7e3a6e57a7ba32;2024-08-04 17:06:35 +0200", "%H;%ad", ";")), std::runtime_error);
+}
+
+TEST(CommitParserTests, parseFormat_invalidHash)
+{
+    EXPECT_THROW(static_cast<void>(CppGit::CommitParser::parseCommit_PrettyFormat("not a hash;message", "%H;%s", ";")), std::runtime_error);
+}
+
+TEST(CommitParserTests, commitStringConstructor_invalidFields)
+{
+    EXPECT_THROW(CppGit::Commit("8c2c3ebb", {}, "name", "email", "2024-08-04 17:06:35 +0200", "name", "email", "1722791195 +0200", "message", "", ""), std::runtime_error);
+    EXPECT_THROW(CppGit::Commit("8c2c3ebb", { "parent" }, "name", "email", "1722791195 +0200", "name", "email", "1722791195 +0200", "message", "", ""), std::runtime_error);
+    EXPECT_NO_THROW(CppGit::Commit("", {}, "", "", "", "", "", "", "", "", ""));
+}
@@ -0,0 +1,98 @@
+#include <CppGit/_details/Parser/ConfigParser.hpp>
+#include <gtest/gtest.h>
+#include <stdexcept>
+
+TEST(ConfigParserTests, parseConfigFile_sectionsAndSubsections)
+{
+    constexpr auto* configContent = "[core]\n"
+                                    "\tbare = false\n"
+                                    "[Remote \"Origin\"]\n"
+                                    "\tURL = https://example.com/repo.git\n"
+                                    "\tfetch = +refs/heads/*:refs/remotes/origin/*\n"
+                                    "[branch.Main]\n"
+                                    "\tremote = origin\n";
+    const auto entries = CppGit::ConfigParser::parseConfigFile(configContent);
+
+    ASSERT_EQ(entries.size(), 4);
+    EXPECT_EQ(entries[0].key, "core.bare");
+    EXPECT_EQ(entries[0].value, "false");
+    EXPECT_EQ(entries[1].key, "remote.Origin.url");
+    EXPECT_EQ(entries[1].value, "https://example.com/repo.git");
+    EXPECT_EQ(entries[2].key, "remote.Origin.fetch");
+    EXPECT_EQ(entries[2].value, "+refs/heads/*:refs/remotes/origin/*");
+    EXPECT_EQ(entries[3].key, "branch.main.remote");
+    EXPECT_EQ(entries[3].value, "origin");
+}
+
+TEST(ConfigParserTests, parseConfigFile_values)
+{
+    constexpr auto* configContent = "[section]\n"
+                                    "\timplicit\n"
+                                    "\tempty =\n"
+                                    "\tspaces =   a   b  ; comment\n"
+                                    "\tquoted = \" a ; b \" c\n"
+                                    "\tescapes = a\\tb\\\\c\\\"d\\n\n"
+                                    "\tcontinued = first \\\n"
+                                    "second\r\n"
+                                    "\tcomment # comment\n";
+    const auto entries = CppGit::ConfigParser::parseConfigFile(configContent);
+
+    ASSERT_EQ(entries.size(), 7);
+    EXPECT_EQ(entries[0].key, "section.implicit");
+    EXPECT_FALSE(entries[0].value.has_value());
+    EXPECT_EQ(entries[1].value, "");
+    EXPECT_EQ(entries[2].value, "a   b");
+    EXPECT_EQ(entries[3].value, " a ; b  c");
+    EXPECT_EQ(entries[4].value, "a\tb\\c\"d\n");
+    EXPECT_EQ(entries[5].value, "first second");
+    EXPECT_EQ(entries[6].key, "section.comment");
+    EXPECT_FALSE(entries[6].value.has_value());
+}
+
+TEST(ConfigParserTests, parseConfigFile_subsectionEscapes)
+{
+    constexpr auto* configContent = "[section \"a \\\"b\\\" \\\\c\"] key = value";
+    const auto entries = CppGit::ConfigParser::parseConfigFile(configContent);
+
+    ASSERT_EQ(entries.size(), 1);
+    EXPECT_EQ(entries[0].key, "section.a \"b\" \\c.key");
+    EXPECT_EQ(entries[0].value, "value");
+}
+
+TEST(ConfigParserTests, parseConfigFile_multiValuedKey)
+{
+    constexpr auto* configContent = "[include]\n"
+                                    "\tpath = first.inc\n"
+                                    "\tpath = second.inc\n";
+    const auto entries = CppGit::ConfigParser::parseConfigFile(configContent);
+
+    ASSERT_EQ(entries.size(), 2);
+    EXPECT_EQ(entries[0].key, "include.path");
+    EXPECT_EQ(entries[0].value, "first.inc");
+    EXPECT_EQ(entries[1].key, "include.path");
+    EXPECT_EQ(entries[1].value, "second.inc");
+}
+
+TEST(ConfigParserTests, parseConfigFile_Empty)
+{
+    const auto entries = CppGit::ConfigParser::parseConfigFile("\xEF\xBB\xBF# only comment\n\n");
+
+    EXPECT_EQ(entries.size(), 0);
+}
+
+TEST(ConfigParserTests, parseConfigFile_invalid)
+{
+    EXPECT_THROW(static_cast<void>(CppGit::ConfigParser::parseConfigFile("key = value")), std::runtime_error);
+    EXPECT_THROW(static_cast<void>(CppGit::ConfigParser::parseConfigFile("[section\n")), std::runtime_error);
+    EXPECT_THROW(static_cast<void>(CppGit::ConfigParser::parseConfigFile("[section \"sub]\n")), std::runtime_error);
+    EXPECT_THROW(static_cast<void>(CppGit::ConfigParser::parseConfigFile("[section]\n\tkey = \"value\n")), std::runtime_error);
+    EXPECT_THROW(static_cast<void>(CppGit::ConfigParser::parseConfigFile("[section]\n\tkey = \\x\n")), std::runtime_error);
+    EXPECT_THROW(static_cast<void>(CppGit::ConfigParser::parseConfigFile("[section]\n\t1key = value\n")), std::runtime_error);
+}
+
+TEST(ConfigParserTests, normalizeKey)
+{
+    EXPECT_EQ(CppGit::ConfigParser::normalizeKey("Core.Bare"), "core.bare");
+    EXPECT_EQ(CppGit::ConfigParser::normalizeKey("Remote.Origin.URL"), "remote.Origin.url");
+    EXPECT_EQ(CppGit::ConfigParser::normalizeKey("url.https://Example.com/.insteadOf"), "url.https://Example.com/.insteadof");
+}
@@ -1,5 +1,8 @@
 #include <CppGit/_details/Parser/DiffParser.hpp>
 #include <gtest/gtest.h>
+#include <string>
+#include <string_view>
+#include <vector>
 
 TEST(DiffParserTests, fileAdded)
 {
@@ -593,3 +596,94 @@ TEST(DiffParserTests, emptyDiff)
 
     ASSERT_EQ(diffFiles.size(), 0);
 }
+
+TEST(DiffParserTests, feedByteByByte)
+{
+    constexpr auto diff = std::string_view{ R"(diff --git a/test.txt b/test.txt
+index 3406f99e1a810bac7e2f890286787350ce2601d3..6fefc78134f4d22c90a778f555c4137feded408e 100644
+--- a/test.txt
++++ b/test.txt
+@@ -1,2 +1,3 @@
+ test
+ content
++__added
+diff --git a/test2.txt b/test2.txt
+new file mode 100644
+index 0000000000000000000000000000000000000000..180cf8328022becee9aaa2577a8f84ea2b9f3827
+--- /dev/null
++++ b/test2.txt
+@@ -0,0 +1 @@
++test2
+)" };
+
+    auto diffFiles = std::vector<CppGit::DiffFile>{};
+    auto diffParser = CppGit::DiffParser{ [&diffFiles](CppGit::DiffFile&& diffFile) { diffFiles.push_back(std::move(diffFile)); } };
+    for (const auto character : diff)
+    {
+        diffParser.feed(std::string_view{ &character, 1 });
+    }
+    diffParser.finish();
+
+    ASSERT_EQ(diffFiles.size(), 2);
+    EXPECT_EQ(diffFiles[0].diffStatus, CppGit::DiffStatus::MODDIFIED);
+    EXPECT_EQ(diffFiles[0].fileA, "test.txt");
+    EXPECT_EQ(diffFiles[0].indexAfter, "6fefc78134f4d22c90a778f555c4137feded408e");
+    EXPECT_EQ(diffFiles[0].newMode, 100'644);
+    const auto expectedContent1 = std::vector<std::string>{ " test", " content", "+__added" };
+    EXPECT_EQ(diffFiles[0].hunkContent, expectedContent1);
+    EXPECT_EQ(diffFiles[1].diffStatus, CppGit::DiffStatus::NEW);
+    EXPECT_EQ(diffFiles[1].fileB, "test2.txt");
+    const auto expectedContent2 = std::vector<std::string>{ "+test2" };
+    EXPECT_EQ(diffFiles[1].hunkContent, expectedContent2);
+}
+
+TEST(DiffParserTests, feedPassesFileWhenNextBegins)
+{
+    auto diffFiles = std::vector<CppGit::DiffFile>{};
+    auto diffParser = CppGit::DiffParser{ [&diffFiles](CppGit::DiffFile&& diffFile) { diffFiles.push_back(std::move(diffFile)); } };
+
+    diffParser.feed("diff --git a/image.png b/image.png\nindex 180cf83..1d89a18\nBinary files differ\n");
+    EXPECT_TRUE(diffFiles.empty());
+    diffParser.feed("diff --git a/test2.txt b/test2.txt\nnew file mode 100644\nindex 0000000..180cf83\n--- /dev/null\n+++ b/te");
+    ASSERT_EQ(diffFiles.size(), 1);
+    EXPECT_EQ(diffFiles[0].diffStatus, CppGit::DiffStatus::BINARY_CHANGED);
+    EXPECT_EQ(diffFiles[0].fileB, "image.png");
+    diffParser.feed("st2.txt\n@@ -0,0 +1 @@\n+test2");
+    EXPECT_EQ(diffFiles.size(), 1);
+    diffParser.finish();
+
+    ASSERT_EQ(diffFiles.size(), 2);
+    EXPECT_EQ(diffFiles[1].diffStatus, CppGit::DiffStatus::NEW);
+    EXPECT_EQ(diffFiles[1].fileB, "test2.txt");
+    ASSERT_EQ(diffFiles[1].hunkContent.size(), 1);
+    EXPECT_EQ(diffFiles[1].hunkContent[0], "+test2");
+}
+
+TEST(DiffParserTests, hunkHeaderWithFunctionName)
+{
+    constexpr auto diff = R"(diff --git a/main.cpp b/main.cpp
+index 180cf8328022becee9aaa2577a8f84ea2b9f3827..1d89a1850b82787e2766aa3c724048fc74ea4fbc 100644
+--- a/main.cpp
++++ b/main.cpp
+@@ -10,3 +10,4 @@ int main()
+ Line 10
++Line 10a
+ Line 11
+ Line 12)";
+
+    auto diffParser = CppGit::DiffParser{};
+    const auto diffFiles = diffParser.parse(diff);
+
+    ASSERT_EQ(diffFiles.size(), 1);
+
+    const auto& diffFile = diffFiles[0];
+
+    EXPECT_EQ(diffFile.diffStatus, CppGit::DiffStatus::MODDIFIED);
+    ASSERT_EQ(diffFile.hunkRangesBefore.size(), 1);
+    EXPECT_EQ(diffFile.hunkRangesBefore[0].first, 10);
+    EXPECT_EQ(diffFile.hunkRangesBefore[0].second, 3);
+    EXPECT_EQ(diffFile.hunkRangeAfter.first, 10);
+    EXPECT_EQ(diffFile.hunkRangeAfter.second, 4);
+    ASSERT_EQ(diffFile.hunkContent.size(), 4);
+    EXPECT_EQ(diffFile.hunkContent[1], "+Line 10a");
+}
@@ -0,0 +1,106 @@
+#include <CppGit/_details/FileMerger.hpp>
+#include <gtest/gtest.h>
+#include <string_view>
+
+using CppGit::_details::FileMerger;
+
+TEST(FileMergerTests, noChanges)
+{
+    const auto result = FileMerger::mergeFile("a\nb\n", "a\nb\n", "a\nb\n", "ours", "theirs");
+
+    EXPECT_EQ(result.content, "a\nb\n");
+    EXPECT_EQ(result.conflictsCount, 0);
+}
+
+TEST(FileMergerTests, onlyOneSideChanged)
+{
+    const auto oursResult = FileMerger::mergeFile("a\nb\n", "a\nX\n", "a\nb\n", "ours", "theirs");
+    const auto theirsResult = FileMerger::mergeFile("a\nb\n", "a\nb\n", "a\nY", "ours", "theirs");
+
+    EXPECT_EQ(oursResult.content, "a\nX\n");
+    EXPECT_EQ(oursResult.conflictsCount, 0);
+    EXPECT_EQ(theirsResult.content, "a\nY");
+    EXPECT_EQ(theirsResult.conflictsCount, 0);
+}
+
+TEST(FileMergerTests, bothSidesChangedDifferentLines)
+{
+    const auto result = FileMerger::mergeFile("a\nb\nc\nd\ne\n", "X\nb\nc\nd\ne\n", "a\nb\nc\nd\nY\n", "ours", "theirs");
+
+    EXPECT_EQ(result.content, "X\nb\nc\nd\nY\n");
+    EXPECT_EQ(result.conflictsCount, 0);
+}
+
+TEST(FileMergerTests, bothSidesChangedSameLinesTheSameWay)
+{
+    const auto result = FileMerger::mergeFile("a\nb\nc\n", "a\nX\nc\n", "a\nX\nc\n", "ours", "theirs");
+
+    EXPECT_EQ(result.content, "a\nX\nc\n");
+    EXPECT_EQ(result.conflictsCount, 0);
+}
+
+TEST(FileMergerTests, conflict)
+{
+    const auto result = FileMerger::mergeFile("a\nb\nc\n", "a\nX\nc\n", "a\nY\nc\n", "HEAD", "feature");
+
+    EXPECT_EQ(result.content, "a\n<<<<<<< HEAD\nX\n=======\nY\n>>>>>>> feature\nc\n");
+    EXPECT_EQ(result.conflictsCount, 1);
+}
+
+TEST(FileMergerTests, conflict_commonLinesAreLeftOut)
+{
+    const auto result = FileMerger::mergeFile("a\n", "X\nsame\nZ\n", "Y\nsame\nZ\n", "ours", "theirs");
+
+    EXPECT_EQ(result.content, "<<<<<<< ours\nX\n=======\nY\n>>>>>>> theirs\nsame\nZ\n");
+    EXPECT_EQ(result.conflictsCount, 1);
+}
+
+TEST(FileMergerTests, conflict_noNewLineAtEnd)
+{
+    const auto result = FileMerger::mergeFile("a\nb\nc", "a\nb\nX", "a\nb\nY", "ours", "theirs");
+
+    EXPECT_EQ(result.content, "a\nb\n<<<<<<< ours\nX\n=======\nY\n>>>>>>> theirs\n");
+    EXPECT_EQ(result.conflictsCount, 1);
+}
+
+TEST(FileMergerTests, conflict_emptyBase)
+{
+    const auto result = FileMerger::mergeFile("", "X\n", "Y\n", "ours", "theirs");
+
+    EXPECT_EQ(result.content, "<<<<<<< ours\nX\n=======\nY\n>>>>>>> theirs\n");
+    EXPECT_EQ(result.conflictsCount, 1);
+}
+
+TEST(FileMergerTests, conflictsSeparatedByLinesWithoutAlnumAreJoined)
+{
+    const auto result = FileMerger::mergeFile("a\n}\n}\n}\n}\nb\n", "X\n}\n}\n}\n}\nY\n", "P\n}\n}\n}\n}\nQ\n", "ours", "theirs");
+
+    EXPECT_EQ(result.content, "<<<<<<< ours\nX\n}\n}\n}\n}\nY\n=======\nP\n}\n}\n}\n}\nQ\n>>>>>>> theirs\n");
+    EXPECT_EQ(result.conflictsCount, 1);
+}
+
+TEST(FileMergerTests, conflictsSeparatedByLinesWithAlnumAreKept)
+{
+    const auto result = FileMerger::mergeFile("a\n1\n2\n3\n4\nb\n", "X\n1\n2\n3\n4\nY\n", "P\n1\n2\n3\n4\nQ\n", "ours", "theirs");
+
+    EXPECT_EQ(result.content, "<<<<<<< ours\nX\n=======\nP\n>>>>>>> theirs\n1\n2\n3\n4\n<<<<<<< ours\nY\n=======\nQ\n>>>>>>> theirs\n");
+    EXPECT_EQ(result.conflictsCount, 2);
+}
+
+TEST(FileMergerTests, conflict_crLfLineEndings)
+{
+    const auto result = FileMerger::mergeFile("a\r\nb\r\nc\r\n", "a\r\nX\r\nc\r\n", "a\r\nY\r\nc\r\n", "ours", "theirs");
+
+    EXPECT_EQ(result.content, "a\r\n<<<<<<< ours\r\nX\r\n=======\r\nY\r\n>>>>>>> theirs\r\nc\r\n");
+    EXPECT_EQ(result.conflictsCount, 1);
+}
+
+TEST(FileMergerTests, binaryContent)
+{
+    using namespace std::string_view_literals;
+
+    const auto result = FileMerger::mergeFile("a\0b\n"sv, "a\0X\n"sv, "a\0Y\n"sv, "ours", "theirs");
+
+    EXPECT_EQ(result.content, "a\0X\n"sv);
+    EXPECT_EQ(result.conflictsCount, 1);
+}
@@ -0,0 +1,123 @@
+#include <CppGit/_details/LineDiff.hpp>
+#include <gtest/gtest.h>
+
+using CppGit::_details::LineDiff;
+
+TEST(LineDiffTests, splitLines)
+{
+    const auto lines = LineDiff::splitLines("a\nb\r\n\nc");
+
+    ASSERT_EQ(lines.size(), 4);
+    EXPECT_EQ(lines[0], "a\n");
+    EXPECT_EQ(lines[1], "b\r\n");
+    EXPECT_EQ(lines[2], "\n");
+    EXPECT_EQ(lines[3], "c");
+}
+
+TEST(LineDiffTests, splitLines_empty)
+{
+    EXPECT_TRUE(LineDiff::splitLines("").empty());
+}
+
+TEST(LineDiffTests, noChanges)
+{
+    const auto lines = LineDiff::splitLines("a\nb\n");
+
+    const auto changes = LineDiff::diff(lines, lines);
+
+    EXPECT_TRUE(changes.empty());
+}
+
+TEST(LineDiffTests, insertionDeletionAndModification)
+{
+    const auto oldLines = LineDiff::splitLines("a\nb\nc\nd\ne\n");
+    const auto newLines = LineDiff::splitLines("new\na\nc\nD\ne\n");
+
+    const auto changes = LineDiff::diff(oldLines, newLines);
+
+    ASSERT_EQ(changes.size(), 3);
+    EXPECT_EQ(changes[0].oldStart, 0);
+    EXPECT_EQ(changes[0].oldCount, 0);
+    EXPECT_EQ(changes[0].newStart, 0);
+    EXPECT_EQ(changes[0].newCount, 1);
+    EXPECT_EQ(changes[1].oldStart, 1);
+    EXPECT_EQ(changes[1].oldCount, 1);
+    EXPECT_EQ(changes[1].newStart, 2);
+    EXPECT_EQ(changes[1].newCount, 0);
+    EXPECT_EQ(changes[2].oldStart, 3);
+    EXPECT_EQ(changes[2].oldCount, 1);
+    EXPECT_EQ(changes[2].newStart, 3);
+    EXPECT_EQ(changes[2].newCount, 1);
+}
+
+TEST(LineDiffTests, ambiguousInsertionIsShiftedDown)
+{
+    const auto oldLines = LineDiff::splitLines("a\nb\n");
+    const auto newLines = LineDiff::splitLines("a\nb\na\nb\n");
+
+    const auto changes = LineDiff::diff(oldLines, newLines);
+
+    ASSERT_EQ(changes.size(), 1);
+    EXPECT_EQ(changes[0].oldStart, 2);
+    EXPECT_EQ(changes[0].oldCount, 0);
+    EXPECT_EQ(changes[0].newStart, 2);
+    EXPECT_EQ(changes[0].newCount, 2);
+}
+
+TEST(LineDiffTests, lastLineWithoutNewLineDiffers)
+{
+    const auto oldLines = LineDiff::splitLines("a\nb");
+    const auto newLines = LineDiff::splitLines("a\nb\n");
+
+    const auto changes = LineDiff::diff(oldLines, newLines);
+
+    ASSERT_EQ(changes.size(), 1);
+    EXPECT_EQ(changes[0].oldStart, 1);
+    EXPECT_EQ(changes[0].oldCount, 1);
+    EXPECT_EQ(changes[0].newStart, 1);
+    EXPECT_EQ(changes[0].newCount, 1);
+}
+
+TEST(LineDiffTests, indentHeuristic)
+{
+    const auto oldLines = LineDiff::splitLines("d\n}\n");
+    const auto newLines = LineDiff::splitLines("d\n  a\n  c\nd\nd\n}\n");
+
+    const auto changes = LineDiff::diff(oldLines, newLines, CppGit::DiffAlgorithm::MYERS, false);
+    const auto indentHeuristicChanges = LineDiff::diff(oldLines, newLines, CppGit::DiffAlgorithm::MYERS, true);
+
+    ASSERT_EQ(changes.size(), 1);
+    EXPECT_EQ(changes[0].oldStart, 1);
+    EXPECT_EQ(changes[0].oldCount, 0);
+    EXPECT_EQ(changes[0].newStart, 1);
+    EXPECT_EQ(changes[0].newCount, 4);
+    ASSERT_EQ(indentHeuristicChanges.size(), 1);
+    EXPECT_EQ(indentHeuristicChanges[0].oldStart, 0);
+    EXPECT_EQ(indentHeuristicChanges[0].oldCount, 0);
+    EXPECT_EQ(indentHeuristicChanges[0].newStart, 0);
+    EXPECT_EQ(indentHeuristicChanges[0].newCount, 4);
+}
+
+TEST(LineDiffTests, patienceAndHistogram)
+{
+    const auto oldLines = LineDiff::splitLines("{\n\n{\n\n}\nbar();\nfoo();\n\n");
+    const auto newLines = LineDiff::splitLines("{\n\n\n{\n{\n\n\n}\nbar();\nfoo();\n\n");
+
+    const auto myersChanges = LineDiff::diff(oldLines, newLines, CppGit::DiffAlgorithm::MYERS);
+    const auto patienceChanges = LineDiff::diff(oldLines, newLines, CppGit::DiffAlgorithm::PATIENCE);
+    const auto histogramChanges = LineDiff::diff(oldLines, newLines, CppGit::DiffAlgorithm::HISTOGRAM);
+
+    ASSERT_EQ(myersChanges.size(), 2);
+    EXPECT_EQ(myersChanges[0].newStart, 2);
+    EXPECT_EQ(myersChanges[0].newCount, 2);
+    EXPECT_EQ(myersChanges[1].newStart, 6);
+    EXPECT_EQ(myersChanges[1].newCount, 1);
+    ASSERT_EQ(patienceChanges.size(), 2);
+    EXPECT_EQ(patienceChanges[0].newStart, 2);
+    EXPECT_EQ(patienceChanges[0].newCount, 1);
+    EXPECT_EQ(patienceChanges[1].newStart, 4);
+    EXPECT_EQ(patienceChanges[1].newCount, 2);
+    ASSERT_EQ(histogramChanges.size(), 2);
+    EXPECT_EQ(histogramChanges[1].newStart, 4);
+    EXPECT_EQ(histogramChanges[1].newCount, 2);
+}
@@ -0,0 +1,121 @@
+#include <CppGit/ObjectId.hpp>
+#include <algorithm>
+#include <array>
+#include <cctype>
+#include <cstddef>
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <string>
+#include <unordered_set>
+
+TEST(ObjectIdTests, sha1)
+{
+    const auto objectId = CppGit::ObjectId::fromHex("8120cca3edbd848e900b41d3d217ca2803dd0e74");
+
+    EXPECT_FALSE(objectId.isEmpty());
+    EXPECT_EQ(objectId.getHexSize(), 40);
+    EXPECT_EQ(objectId.getBytes().size(), CppGit::ObjectId::SHA1_SIZE);
+    EXPECT_EQ(objectId.getBytes()[0], 0x81);
+    EXPECT_EQ(objectId.getBytes()[19], 0x74);
+    EXPECT_EQ(objectId.toHex(), "8120cca3edbd848e900b41d3d217ca2803dd0e74");
+}
+
+TEST(ObjectIdTests, sha256)
+{
+    const auto hash = std::string{ "6c2d4d4b1e47dd1f2a3f0b5c7e9a8d6f4b2c1e0a9d8c7b6a5f4e3d2c1b0a9f8e" };
+
+    const auto objectId = CppGit::ObjectId::fromHex(hash);
+
+    EXPECT_EQ(objectId.getBytes().size(), CppGit::ObjectId::SHA256_SIZE);
+    EXPECT_EQ(objectId.toHex(), hash);
+}
+
+TEST(ObjectIdTests, abbreviatedAndUpperCase)
+{
+    const auto objectId = CppGit::ObjectId::fromHex("AD34F5B");
+
+    EXPECT_EQ(objectId.getHexSize(), 7);
+    EXPECT_EQ(objectId.getBytes().size(), 4);
+    EXPECT_EQ(objectId.toHex(), "ad34f5b");
+    EXPECT_EQ(objectId, CppGit::ObjectId::fromHex("ad34f5b"));
+    EXPECT_NE(objectId, CppGit::ObjectId::fromHex("ad34f5b0"));
+}
+
+TEST(ObjectIdTests, notHash)
+{
+    EXPECT_TRUE(CppGit::ObjectId::fromHex("").isEmpty());
+    EXPECT_TRUE(CppGit::ObjectId::fromHex("HEAD").isEmpty());
+    EXPECT_TRUE(CppGit::ObjectId::fromHex("8120cca3edbd848e900b41d3d217ca2803dd0e7g").isEmpty());
+    EXPECT_TRUE(CppGit::ObjectId::fromHex(std::string(65, 'a')).isEmpty());
+    EXPECT_EQ(CppGit::ObjectId{}.toHex(), "");
+}
+
+TEST(ObjectIdTests, unorderedSet)
+{
+    auto objectIds = std::unordered_set<CppGit::ObjectId>{};
+
+    objectIds.insert(CppGit::ObjectId::fromHex("8120cca3edbd848e900b41d3d217ca2803dd0e74"));
+    objectIds.insert(CppGit::ObjectId::fromHex("1d89a1850b82787e2766aa3c724048fc74ea4fbc"));
+    objectIds.insert(CppGit::ObjectId::fromHex("8120CCA3EDBD848E900B41D3D217CA2803DD0E74"));
+
+    EXPECT_EQ(objectIds.size(), 2);
+    EXPECT_TRUE(objectIds.contains(CppGit::ObjectId::fromHex("1d89a1850b82787e2766aa3c724048fc74ea4fbc")));
+}
+
+TEST(ObjectIdTests, notHexDigitAtAnyPosition)
+{
+    const auto hash = std::string{ "8120cca3edbd848e900b41d3d217ca2803dd0e74" };
+
+    for (auto position = std::size_t{ 0 }; position < hash.size(); ++position)
+    {
+        for (const auto character : { 'g', 'G', '/', ':', '@', '`', '\0', '\x80', ' ' })
+        {
+            auto invalidHash = hash;
+            invalidHash[position] = character;
+
+            EXPECT_TRUE(CppGit::ObjectId::fromHex(invalidHash).isEmpty()) << position << " " << static_cast<int>(character);
+            EXPECT_FALSE(CppGit::ObjectId::isHex(invalidHash)) << position << " " << static_cast<int>(character);
+        }
+    }
+}
+
+TEST(ObjectIdTests, allLengths)
+{
+    const auto hash = std::string{ "0123456789abcdefABCDEF0123456789abcdefABCDEF0123456789abcdef0123" };
+
+    for (auto size = std::size_t{ 1 }; size <= hash.size(); ++size)
+    {
+        auto expectedHex = hash.substr(0, size);
+        std::ranges::transform(expectedHex, expectedHex.begin(), [](const char character) { return static_cast<char>(std::tolower(character)); });
+
+        const auto objectId = CppGit::ObjectId::fromHex(hash.substr(0, size));
+
+        EXPECT_TRUE(CppGit::ObjectId::isHex(hash.substr(0, size)));
+        EXPECT_EQ(objectId.getHexSize(), size);
+        EXPECT_EQ(objectId.toHex(), expectedHex);
+    }
+}
+
+TEST(ObjectIdTests, fromBytes)
+{
+    const auto bytes = std::array<std::uint8_t, CppGit::ObjectId::SHA1_SIZE>{ 0x81, 0x20, 0xcc, 0xa3, 0xed, 0xbd, 0x84, 0x8e, 0x90, 0x0b, 0x41, 0xd3, 0xd2, 0x17, 0xca, 0x28, 0x03, 0xdd, 0x0e, 0x74 };
+
+    const auto objectId = CppGit::ObjectId::fromBytes(bytes);
+
+    EXPECT_EQ(objectId.toHex(), "8120cca3edbd848e900b41d3d217ca2803dd0e74");
+    EXPECT_EQ(objectId, CppGit::ObjectId::fromHex("8120cca3edbd848e900b41d3d217ca2803dd0e74"));
+}
+
+TEST(ObjectIdTests, compareWithHex)
+{
+    const auto objectId = CppGit::ObjectId::fromHex("8120cca3edbd848e900b41d3d217ca2803dd0e74");
+
+    EXPECT_TRUE(objectId == "8120cca3edbd848e900b41d3d217ca2803dd0e74");
+    EXPECT_TRUE(objectId == "8120CCA3EDBD848E900B41D3D217CA2803DD0E74");
+    EXPECT_TRUE(std::string{ "8120cca3edbd848e900b41d3d217ca2803dd0e74" } == objectId);
+    EXPECT_FALSE(objectId == "8120cca3edbd848e900b41d3d217ca2803dd0e75");
+    EXPECT_FALSE(objectId == "8120cca");
+    EXPECT_FALSE(objectId == "");
+    EXPECT_FALSE(CppGit::ObjectId{} == "HEAD");
+    EXPECT_TRUE(CppGit::ObjectId{} == "");
+}
@@ -0,0 +1,61 @@
+#include <CppGit/RebaseTodoCommand.hpp>
+#include <CppGit/_details/RebaseTodoList.hpp>
+#include <gtest/gtest.h>
+#include <vector>
+
+TEST(RebaseTodoListTests, empty)
+{
+    auto todoList = CppGit::_details::RebaseTodoList{};
+
+    EXPECT_FALSE(todoList.peek().has_value());
+    EXPECT_FALSE(todoList.pop().has_value());
+    EXPECT_TRUE(todoList.getRemainingCommands().empty());
+    EXPECT_TRUE(todoList.getNotFlushedDoneCommands().empty());
+}
+
+TEST(RebaseTodoListTests, peekAndPop)
+{
+    const auto commands = std::vector<CppGit::RebaseTodoCommand>{
+        { CppGit::RebaseTodoCommandType::PICK, "hash1", "First" },
+        { CppGit::RebaseTodoCommandType::BREAK },
+        { CppGit::RebaseTodoCommandType::FIXUP, "hash2", "Second" }
+    };
+    auto todoList = CppGit::_details::RebaseTodoList{ commands };
+
+    EXPECT_EQ(todoList.peek(), commands[0]);
+    EXPECT_EQ(todoList.peek(), commands[0]);
+    EXPECT_EQ(todoList.pop(), commands[0]);
+    EXPECT_EQ(todoList.peek(), commands[1]);
+    EXPECT_EQ(todoList.pop(), commands[1]);
+    EXPECT_EQ(todoList.pop(), commands[2]);
+    EXPECT_FALSE(todoList.peek().has_value());
+    EXPECT_FALSE(todoList.pop().has_value());
+}
+
+TEST(RebaseTodoListTests, remainingAndNotFlushedDone)
+{
+    const auto commands = std::vector<CppGit::RebaseTodoCommand>{
+        { CppGit::RebaseTodoCommandType::PICK, "hash1", "First" },
+        { CppGit::RebaseTodoCommandType::PICK, "hash2", "Second" },
+        { CppGit::RebaseTodoCommandType::PICK, "hash3", "Third" },
+        { CppGit::RebaseTodoCommandType::PICK, "hash4", "Fourth" }
+    };
+    auto todoList = CppGit::_details::RebaseTodoList{ commands };
+
+    todoList.pop();
+    todoList.pop();
+
+    ASSERT_EQ(todoList.getNotFlushedDoneCommands().size(), 2);
+    EXPECT_EQ(todoList.getNotFlushedDoneCommands()[0], commands[0]);
+    EXPECT_EQ(todoList.getNotFlushedDoneCommands()[1], commands[1]);
+    ASSERT_EQ(todoList.getRemainingCommands().size(), 2);
+    EXPECT_EQ(todoList.getRemainingCommands()[0], commands[2]);
+
+    todoList.markFlushed();
+    todoList.pop();
+
+    ASSERT_EQ(todoList.getNotFlushedDoneCommands().size(), 1);
+    EXPECT_EQ(todoList.getNotFlushedDoneCommands()[0], commands[2]);
+    ASSERT_EQ(todoList.getRemainingCommands().size(), 1);
+    EXPECT_EQ(todoList.getRemainingCommands()[0], commands[3]);
+}
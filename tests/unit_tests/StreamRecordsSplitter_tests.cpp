@@ -0,0 +1,94 @@
+#include <CppGit/_details/StreamRecordsSplitter.hpp>
+#include <gtest/gtest.h>
+#include <string>
+#include <string_view>
+#include <vector>
+
+TEST(StreamRecordsSplitterTests, wholeStreamInOneChunk)
+{
+    auto records = std::vector<std::string>{};
+    auto splitter = CppGit::_details::StreamRecordsSplitter{ "$:>\n", 0, [&records](const std::string_view record) { records.emplace_back(record); } };
+
+    splitter.feed("record1$:>\nrecord2$:>\nrecord3");
+    splitter.finish();
+
+    ASSERT_EQ(records.size(), 3);
+    EXPECT_EQ(records[0], "record1");
+    EXPECT_EQ(records[1], "record2");
+    EXPECT_EQ(records[2], "record3");
+}
+
+TEST(StreamRecordsSplitterTests, separatorAtTheEnd)
+{
+    auto records = std::vector<std::string>{};
+    auto splitter = CppGit::_details::StreamRecordsSplitter{ "$:>\n", 0, [&records](const std::string_view record) { records.emplace_back(record); } };
+
+    splitter.feed("record1$:>\nrecord2$:>\n");
+    splitter.finish();
+
+    ASSERT_EQ(records.size(), 2);
+    EXPECT_EQ(records[0], "record1");
+    EXPECT_EQ(records[1], "record2");
+}
+
+TEST(StreamRecordsSplitterTests, separatorCutBetweenChunks)
+{
+    auto records = std::vector<std::string>{};
+    auto splitter = CppGit::_details::StreamRecordsSplitter{ "$:>\n", 0, [&records](const std::string_view record) { records.emplace_back(record); } };
+
+    splitter.feed("record1$:");
+    EXPECT_TRUE(records.empty());
+    splitter.feed(">\nrec");
+    ASSERT_EQ(records.size(), 1);
+    splitter.feed("ord2$");
+    splitter.feed(":");
+    splitter.feed(">");
+    splitter.feed("\n");
+    splitter.finish();
+
+    ASSERT_EQ(records.size(), 2);
+    EXPECT_EQ(records[0], "record1");
+    EXPECT_EQ(records[1], "record2");
+}
+
+TEST(StreamRecordsSplitterTests, byteByByte)
+{
+    constexpr auto stream = std::string_view{ "diff a\n+line\ndiff b\n-line\ndiff c" };
+
+    auto records = std::vector<std::string>{};
+    auto splitter = CppGit::_details::StreamRecordsSplitter{ "\ndiff ", 5, [&records](const std::string_view record) { records.emplace_back(record); } };
+
+    for (const auto character : stream)
+    {
+        splitter.feed(std::string_view{ &character, 1 });
+    }
+    splitter.finish();
+
+    ASSERT_EQ(records.size(), 3);
+    EXPECT_EQ(records[0], "diff a\n+line");
+    EXPECT_EQ(records[1], "diff b\n-line");
+    EXPECT_EQ(records[2], "diff c");
+}
+
+TEST(StreamRecordsSplitterTests, separatorTailBelongsToNextRecord)
+{
+    auto records = std::vector<std::string>{};
+    auto splitter = CppGit::_details::StreamRecordsSplitter{ "\ndiff ", 5, [&records](const std::string_view record) { records.emplace_back(record); } };
+
+    splitter.feed("diff --git a/file1 b/file1\n+a\ndiff --git a/file2 b/file2\n-b\n");
+    splitter.finish();
+
+    ASSERT_EQ(records.size(), 2);
+    EXPECT_EQ(records[0], "diff --git a/file1 b/file1\n+a");
+    EXPECT_EQ(records[1], "diff --git a/file2 b/file2\n-b\n");
+}
+
+TEST(StreamRecordsSplitterTests, emptyStream)
+{
+    auto records = std::vector<std::string>{};
+    auto splitter = CppGit::_details::StreamRecordsSplitter{ "$:>\n", 0, [&records](const std::string_view record) { records.emplace_back(record); } };
+
+    splitter.finish();
+
+    EXPECT_TRUE(records.empty());
+}
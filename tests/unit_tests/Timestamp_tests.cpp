@@ -0,0 +1,52 @@
+#include <CppGit/Timestamp.hpp>
+#include <gtest/gtest.h>
+
+TEST(TimestampTests, parse)
+{
+    const auto timestamp = CppGit::Timestamp::parse("1722791195 +0200");
+
+    ASSERT_TRUE(timestamp.has_value());
+    EXPECT_EQ(timestamp->secondsSinceEpoch, 1722791195);
+    EXPECT_EQ(timestamp->timezoneOffsetMinutes, 120);
+    EXPECT_EQ(timestamp->toString(), "1722791195 +0200");
+}
+
+TEST(TimestampTests, parse_negativeOffset)
+{
+    const auto timestamp = CppGit::Timestamp::parse("1722791195 -0930");
+
+    ASSERT_TRUE(timestamp.has_value());
+    EXPECT_EQ(timestamp->timezoneOffsetMinutes, -570);
+    EXPECT_EQ(timestamp->toString(), "1722791195 -0930");
+}
+
+TEST(TimestampTests, parse_utc)
+{
+    const auto timestamp = CppGit::Timestamp::parse("0 +0000");
+
+    ASSERT_TRUE(timestamp.has_value());
+    EXPECT_EQ(timestamp->secondsSinceEpoch, 0);
+    EXPECT_EQ(timestamp->timezoneOffsetMinutes, 0);
+    EXPECT_EQ(timestamp->toString(), "0 +0000");
+}
+
+TEST(TimestampTests, parse_negativeUtc)
+{
+    const auto timestamp = CppGit::Timestamp::parse("123 -0000");
+
+    ASSERT_TRUE(timestamp.has_value());
+    EXPECT_EQ(timestamp->secondsSinceEpoch, 123);
+    EXPECT_EQ(timestamp->timezoneOffsetMinutes, 0);
+    EXPECT_TRUE(timestamp->negativeUtcOffset);
+    EXPECT_EQ(timestamp->toString(), "123 -0000");
+    EXPECT_NE(*timestamp, CppGit::Timestamp::parse("123 +0000"));
+}
+
+TEST(TimestampTests, parse_notRawFormat)
+{
+    EXPECT_FALSE(CppGit::Timestamp::parse("").has_value());
+    EXPECT_FALSE(CppGit::Timestamp::parse("1722791195").has_value());
+    EXPECT_FALSE(CppGit::Timestamp::parse("1722791195 0200").has_value());
+    EXPECT_FALSE(CppGit::Timestamp::parse("1722791195 +02:00").has_value());
+    EXPECT_FALSE(CppGit::Timestamp::parse("2024-08-04 19:06:35 +0200").has_value());
+}